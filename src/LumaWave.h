@@ -21,6 +21,7 @@ using HslColor = lw::colors::HslColor;
 
 template <typename TColor> using PixelView = lw::PixelView<TColor>;
 
+using lw::fillPixelBatches;
 using lw::fillPixels;
 using lw::fillPixelsIndexed;
 
@@ -29,6 +30,11 @@ template <typename TProtocol, typename TTransport = lw::busses::PlatformDefaultT
           typename TShader =
               lw::NilShader<typename lw::busses::detail::ResolveProtocolType<TProtocol>::Type::ColorType>>
 using Strip = lw::busses::PixelBus<TProtocol, TTransport, TShader>;
+
+template <size_t NPixelCount, typename TProtocol, typename TTransport = lw::busses::PlatformDefaultTransport,
+          typename TShader =
+              lw::NilShader<typename lw::busses::detail::ResolveProtocolType<TProtocol>::Type::ColorType>>
+using StaticStrip = lw::busses::StaticPixelBus<NPixelCount, TProtocol, TTransport, TShader>;
 #endif
 
 template <typename TColor = lw::colors::DefaultColorType,
@@ -164,6 +170,8 @@ using CurrentSettings = lw::shaders::CurrentLimiterShaderSettings<TColor>;
 
 template <typename TColor = lw::colors::DefaultColorType> using Current = lw::shaders::CurrentLimiterShader<TColor>;
 
+template <typename TColor = lw::Rgb16Color> using TemporalDither = lw::shaders::TemporalDitherShader<TColor>;
+
 template <typename TColor = lw::colors::DefaultColorType>
 using AutoWhiteBalanceSettings = lw::shaders::AutoWhiteBalanceShaderSettings<TColor>;
 
@@ -3,6 +3,10 @@
 #include <memory>
 #include <vector>
 
+#include "buses/BusBuffers.h"
+#include "buses/FrameBarrier.h"
+#include "buses/ShowCompletionGroup.h"
+#include "core/Executor.h"
 #include "core/IPixelBus.h"
 
 namespace lw::busses
@@ -85,6 +89,18 @@ template <typename TColor> class ReferenceAggregateBus : public IPixelBus<TColor
         return true;
     }
 
+    // Every member records into `timing`, so a show counts once per member.
+    void setFrameTiming(FrameTiming* timing) override
+    {
+        for (auto* bus : _buses)
+        {
+            if (bus != nullptr)
+            {
+                bus->setFrameTiming(timing);
+            }
+        }
+    }
+
     PixelView<TColor>& pixels() override { return _pixels; }
 
     const PixelView<TColor>& pixels() const override { return _pixels; }
@@ -103,7 +119,7 @@ template <typename TColor> class AggregateBus : public IPixelBus<TColor>
 
     explicit AggregateBus(std::vector<std::unique_ptr<BusType>> buses)
         : _buses(std::move(buses)), _pixelChunks(detail::collectAggregateChunks<TColor>(_buses)),
-          _pixels(span<ChunkType>{_pixelChunks.data(), _pixelChunks.size()})
+          _pixels(span<ChunkType>{_pixelChunks.data(), _pixelChunks.size()}), _barrier(_buses.size())
     {
     }
 
@@ -120,6 +136,19 @@ template <typename TColor> class AggregateBus : public IPixelBus<TColor>
 
     void show() override
     {
+        if (_frameBarrierEnabled)
+        {
+            _barrier.show(_buses, memberExecutor());
+            return;
+        }
+
+        if (memberExecutor() != nullptr)
+        {
+            prepareShow();
+            commitShow();
+            return;
+        }
+
         for (const auto& bus : _buses)
         {
             if (bus)
@@ -129,6 +158,103 @@ template <typename TColor> class AggregateBus : public IPixelBus<TColor>
         }
     }
 
+    // Members queue their frames one after another and `completion` runs once the last
+    // of them has finished. With the frame barrier or an executor every member is
+    // prepared first and then committed; a barrier refusal reports BusyDropped.
+    ShowStatus showAsync(ShowCompletion completion = {}) override
+    {
+        if (_frameBarrierEnabled)
+        {
+            if (!_completions.begin(_buses, completion))
+            {
+                return ShowStatus::BusyDropped;
+            }
+
+            const bool shown = _barrier.show(_buses, memberExecutor(), [this](BusType& bus) { commitMember(bus); });
+            const ShowStatus status = _completions.finish();
+            return shown ? status : ShowStatus::BusyDropped;
+        }
+
+        if (memberExecutor() != nullptr)
+        {
+            prepareShow();
+            return commitShowAsync(completion);
+        }
+
+        return _completions.show(_buses, completion);
+    }
+
+    ShowStatus commitShowAsync(ShowCompletion completion = {}) override
+    {
+        if (!_completions.begin(_buses, completion))
+        {
+            return ShowStatus::BusyDropped;
+        }
+
+        for (const auto& bus : _buses)
+        {
+            if (bus)
+            {
+                commitMember(*bus);
+            }
+        }
+
+        return _completions.finish();
+    }
+
+    bool pollCompletion() override { return _completions.poll(_buses); }
+
+    void prepareShow() override
+    {
+        parallelFor(memberExecutor(), _buses.size(),
+                    [this](size_t member)
+                    {
+                        if (_buses[member])
+                        {
+                            _buses[member]->prepareShow();
+                        }
+                    });
+    }
+
+    void commitShow() override
+    {
+        for (const auto& bus : _buses)
+        {
+            if (bus)
+            {
+                bus->commitShow();
+            }
+        }
+    }
+
+    // Frame-barrier ("full refresh only") mode: show() encodes every member before any
+    // transmission starts, then starts them back to back, and shows nothing while any
+    // member is busy instead of leaving it a frame behind. See frameBarrier() for
+    // per-member skew and skip counts. Members sharing buffers (shareMemberBuffers)
+    // keep their own protocol buffers while the barrier is on.
+    void setFrameBarrier(bool enabled)
+    {
+        _frameBarrierEnabled = enabled;
+        if (_sharedPool != nullptr)
+        {
+            shareBuffers(*_sharedPool);
+        }
+    }
+
+    bool isFrameBarrier() const { return _frameBarrierEnabled; }
+
+    FrameBarrier& frameBarrier() { return _barrier; }
+
+    const FrameBarrier& frameBarrier() const { return _barrier; }
+
+    // Runs every member's shade and encode stage on `executor`, then starts the
+    // transmissions in member order on the calling thread. The executor is not owned.
+    // Members borrowing shared buffers (shareMemberBuffers) are always prepared one
+    // at a time.
+    void setExecutor(IExecutor* executor) { _executor = executor; }
+
+    IExecutor* executor() const { return _executor; }
+
     bool isReadyToUpdate() const override
     {
         for (const auto& bus : _buses)
@@ -142,14 +268,77 @@ template <typename TColor> class AggregateBus : public IPixelBus<TColor>
         return true;
     }
 
+    // Members show one after another, so they can borrow a single shader scratch and,
+    // where their transports allow it, a single protocol buffer from this bus instead
+    // of each holding their own. See IPixelBus::shareBuffers.
+    void shareMemberBuffers()
+    {
+        if (!_bufferPool)
+        {
+            _bufferPool = std::make_unique<BusBufferPool<TColor>>();
+        }
+
+        shareBuffers(*_bufferPool);
+    }
+
+    // Every member records into `timing`, so a show counts once per member. Members
+    // preparing on the executor record concurrently, which FrameTiming allows.
+    void setFrameTiming(FrameTiming* timing) override
+    {
+        for (const auto& bus : _buses)
+        {
+            if (bus)
+            {
+                bus->setFrameTiming(timing);
+            }
+        }
+    }
+
+    void shareBuffers(BusBufferPool<TColor>& pool) override
+    {
+        _sharesBuffers = true;
+        _sharedPool = &pool;
+
+        // The barrier encodes every member before any transmits, so each needs its own
+        // protocol buffer; the shader scratch is still shared.
+        const bool lendsProtocolBytes = pool.lendsProtocolBytes();
+        pool.setLendsProtocolBytes(lendsProtocolBytes && !_frameBarrierEnabled);
+        for (const auto& bus : _buses)
+        {
+            if (bus)
+            {
+                bus->shareBuffers(pool);
+            }
+        }
+
+        pool.setLendsProtocolBytes(lendsProtocolBytes);
+    }
+
+    const BusBufferPool<TColor>* bufferPool() const { return _bufferPool.get(); }
+
     PixelView<TColor>& pixels() override { return _pixels; }
 
     const PixelView<TColor>& pixels() const override { return _pixels; }
 
   private:
+    // Shared buffers are borrowed by one member at a time.
+    IExecutor* memberExecutor() const { return _sharesBuffers ? nullptr : _executor; }
+
+    void commitMember(BusType& bus)
+    {
+        _completions.add([&bus](ShowCompletion member) { return bus.commitShowAsync(member); });
+    }
+
     std::vector<std::unique_ptr<BusType>> _buses;
     std::vector<ChunkType> _pixelChunks;
     PixelView<TColor> _pixels;
+    std::unique_ptr<BusBufferPool<TColor>> _bufferPool;
+    FrameBarrier _barrier;
+    bool _frameBarrierEnabled{false};
+    IExecutor* _executor{nullptr};
+    bool _sharesBuffers{false};
+    BusBufferPool<TColor>* _sharedPool{nullptr};
+    ShowCompletionGroup _completions;
 };
 
 } // namespace lw::busses
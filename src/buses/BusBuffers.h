@@ -0,0 +1,176 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "core/Compat.h"
+#include "core/PixelView.h"
+
+namespace lw::busses
+{
+
+// Buffer sizes a bus needs for a given pixel count and protocol settings.
+struct BusBufferRequirements
+{
+    size_t rootPixels{0};
+    size_t shaderScratch{0};
+    size_t protocolBytes{0};
+
+    // Worst-case bytes needed to carve all three buffers from a BufferArena, including
+    // alignment padding. Sum this over every bus an arena must back.
+    template <typename TColor> constexpr size_t arenaBytes() const
+    {
+        const size_t padding = alignof(TColor) - 1;
+        const size_t colorBytes = (rootPixels != 0) ? (rootPixels * sizeof(TColor)) + padding : 0;
+        const size_t scratchBytes = (shaderScratch != 0) ? (shaderScratch * sizeof(TColor)) + padding : 0;
+        return colorBytes + scratchBytes + protocolBytes;
+    }
+};
+
+// Externally owned storage for a bus. The owner must keep it alive, and must not use
+// it for anything else, for as long as the bus exists.
+template <typename TColor> struct BusBuffers
+{
+    span<TColor> rootPixels{};
+    span<TColor> shaderScratch{};
+    span<uint8_t> protocolBuffer{};
+
+    bool satisfies(const BusBufferRequirements& requirements) const
+    {
+        return rootPixels.size() >= requirements.rootPixels && shaderScratch.size() >= requirements.shaderScratch &&
+               protocolBuffer.size() >= requirements.protocolBytes;
+    }
+};
+
+// Bump allocator over one caller-owned block, for backing many buses with a single
+// allocation. Nothing is freed individually; the block is released by its owner.
+class BufferArena
+{
+  public:
+    explicit BufferArena(span<uint8_t> storage) : _storage{storage} {}
+
+    // Aligned, value-initialized span of `count` elements, or an empty span when the
+    // remaining storage is too small.
+    template <typename T> span<T> take(size_t count)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "BufferArena elements are never destroyed.");
+
+        if (count == 0)
+        {
+            return span<T>{};
+        }
+
+        void* cursor = _storage.data() + _used;
+        size_t space = _storage.size() - _used;
+        if (std::align(alignof(T), count * sizeof(T), cursor, space) == nullptr)
+        {
+            return span<T>{};
+        }
+
+        T* first = static_cast<T*>(cursor);
+        std::uninitialized_value_construct_n(first, count);
+        _used = static_cast<size_t>(static_cast<uint8_t*>(cursor) - _storage.data()) + (count * sizeof(T));
+        return span<T>{first, count};
+    }
+
+    template <typename TColor> BusBuffers<TColor> takeBusBuffers(const BusBufferRequirements& requirements)
+    {
+        BusBuffers<TColor> buffers;
+        buffers.rootPixels = take<TColor>(requirements.rootPixels);
+        buffers.shaderScratch = take<TColor>(requirements.shaderScratch);
+        buffers.protocolBuffer = take<uint8_t>(requirements.protocolBytes);
+        return buffers;
+    }
+
+    // Spill room for PixelView slices and concatenations of up to `chunkCount` chunks.
+    template <typename TColor> PixelViewStorage<TColor> takePixelViewStorage(size_t chunkCount)
+    {
+        PixelViewStorage<TColor> storage;
+        storage.chunks = take<span<TColor>>(chunkCount);
+        storage.chunkStarts = take<uint32_t>(chunkCount);
+        return storage;
+    }
+
+    size_t used() const { return _used; }
+
+    size_t remaining() const { return _storage.size() - _used; }
+
+  private:
+    span<uint8_t> _storage;
+    size_t _used{0};
+};
+
+// Buffers PixelBus owns: sized at construction, and left empty where caller-supplied
+// or pooled storage stands in. The back buffer and stream chunks exist only while
+// double buffering or streaming is enabled.
+template <typename TColor> struct DynamicBusStorage
+{
+    static constexpr bool Resizable = true;
+
+    std::vector<TColor> pixels;
+    std::vector<TColor> shaderScratch;
+    std::vector<uint8_t> protocolBuffer;
+    std::vector<uint8_t> backBuffer;
+    std::vector<uint8_t> streamChunks;
+};
+
+// Buffers StaticPixelBus keeps inline. A literal type, so the storage of a bus at
+// namespace scope is constant-initialized and needs no startup code.
+template <typename TColor, size_t NPixelCount, size_t NShaderScratch, size_t NProtocolBytes> struct StaticBusStorage
+{
+    static constexpr bool Resizable = false;
+
+    std::array<TColor, NPixelCount> pixels{};
+    std::array<TColor, NShaderScratch> shaderScratch{};
+    std::array<uint8_t, NProtocolBytes> protocolBuffer{};
+};
+
+// Storage an aggregate lends to its members while they show one after another: one
+// shader scratch sized to the largest member and one protocol buffer for members whose
+// transport completes synchronously. A returned span stays valid until a later call
+// asks for more than the pool holds, so members borrow again on every show().
+template <typename TColor> class BusBufferPool
+{
+  public:
+    span<TColor> scratch(size_t count)
+    {
+        if (_scratch.size() < count)
+        {
+            _scratch.resize(count);
+        }
+
+        return (count != 0) ? span<TColor>{_scratch.data(), count} : span<TColor>{};
+    }
+
+    span<uint8_t> protocolBytes(size_t count)
+    {
+        if (_protocolBytes.size() < count)
+        {
+            _protocolBytes.resize(count, static_cast<uint8_t>(0));
+        }
+
+        return (count != 0) ? span<uint8_t>{_protocolBytes.data(), count} : span<uint8_t>{};
+    }
+
+    size_t scratchCapacity() const { return _scratch.size(); }
+
+    size_t protocolCapacity() const { return _protocolBytes.size(); }
+
+    // Whether borrowers may take the protocol buffer. Cleared by an aggregate while it
+    // lends to members that must finish encoding before any of them transmits; a
+    // member that borrowed it before then goes back to a buffer of its own.
+    bool lendsProtocolBytes() const { return _lendsProtocolBytes; }
+
+    void setLendsProtocolBytes(bool lends) { _lendsProtocolBytes = lends; }
+
+  private:
+    std::vector<TColor> _scratch;
+    std::vector<uint8_t> _protocolBytes;
+    bool _lendsProtocolBytes{true};
+};
+
+} // namespace lw::busses
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "buses/AggregateBus.h"
+#include "buses/BusBuffers.h"
+#include "buses/FrameBarrier.h"
+#include "buses/FrameClock.h"
+#include "buses/FrameTiming.h"
 #if !LW_DISABLE_TEMPLATE_COMBINATORIAL_TYPES
 #include "buses/CompositeBus.h"
 #endif
@@ -8,4 +12,6 @@
 #include "buses/PixelBus.h"
 #include "buses/ReferenceBus.h"
 #include "buses/ReferenceLightBus.h"
+#include "buses/ShowCompletionGroup.h"
+#include "buses/StaticPixelBus.h"
 #include "core/Topology.h"
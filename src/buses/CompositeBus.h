@@ -6,6 +6,10 @@
 #include <utility>
 #include <vector>
 
+#include "buses/BusBuffers.h"
+#include "buses/FrameBarrier.h"
+#include "buses/ShowCompletionGroup.h"
+#include "core/Executor.h"
 #include "core/IPixelBus.h"
 
 namespace lw::busses
@@ -28,7 +32,7 @@ class CompositeBus : public IPixelBus<typename std::tuple_element<0, std::tuple<
 
     explicit CompositeBus(TBuses... buses)
         : _buses(std::move(buses)...), _busPointers(makeBusPointers(_buses)), _pixelChunks(collectChunks(_busPointers)),
-          _pixels(span<ChunkType>{_pixelChunks.data(), _pixelChunks.size()})
+          _pixels(span<ChunkType>{_pixelChunks.data(), _pixelChunks.size()}), _barrier(sizeof...(TBuses))
     {
     }
 
@@ -45,6 +49,19 @@ class CompositeBus : public IPixelBus<typename std::tuple_element<0, std::tuple<
 
     void show() override
     {
+        if (_frameBarrierEnabled)
+        {
+            _barrier.show(_busPointers, memberExecutor());
+            return;
+        }
+
+        if (memberExecutor() != nullptr)
+        {
+            prepareShow();
+            commitShow();
+            return;
+        }
+
         for (auto* bus : _busPointers)
         {
             if (bus != nullptr)
@@ -54,6 +71,95 @@ class CompositeBus : public IPixelBus<typename std::tuple_element<0, std::tuple<
         }
     }
 
+    // Joins the members' completions; see AggregateBus::showAsync.
+    ShowStatus showAsync(ShowCompletion completion = {}) override
+    {
+        if (_frameBarrierEnabled)
+        {
+            if (!_completions.begin(_busPointers, completion))
+            {
+                return ShowStatus::BusyDropped;
+            }
+
+            const bool shown =
+                _barrier.show(_busPointers, memberExecutor(), [this](BusBaseType& bus) { commitMember(bus); });
+            const ShowStatus status = _completions.finish();
+            return shown ? status : ShowStatus::BusyDropped;
+        }
+
+        if (memberExecutor() != nullptr)
+        {
+            prepareShow();
+            return commitShowAsync(completion);
+        }
+
+        return _completions.show(_busPointers, completion);
+    }
+
+    ShowStatus commitShowAsync(ShowCompletion completion = {}) override
+    {
+        if (!_completions.begin(_busPointers, completion))
+        {
+            return ShowStatus::BusyDropped;
+        }
+
+        for (auto* bus : _busPointers)
+        {
+            if (bus != nullptr)
+            {
+                commitMember(*bus);
+            }
+        }
+
+        return _completions.finish();
+    }
+
+    bool pollCompletion() override { return _completions.poll(_busPointers); }
+
+    void prepareShow() override
+    {
+        parallelFor(memberExecutor(), _busPointers.size(),
+                    [this](size_t member)
+                    {
+                        if (_busPointers[member] != nullptr)
+                        {
+                            _busPointers[member]->prepareShow();
+                        }
+                    });
+    }
+
+    void commitShow() override
+    {
+        for (auto* bus : _busPointers)
+        {
+            if (bus != nullptr)
+            {
+                bus->commitShow();
+            }
+        }
+    }
+
+    // Frame-barrier ("full refresh only") mode; see AggregateBus::setFrameBarrier.
+    void setFrameBarrier(bool enabled)
+    {
+        _frameBarrierEnabled = enabled;
+        if (_sharedPool != nullptr)
+        {
+            shareBuffers(*_sharedPool);
+        }
+    }
+
+    bool isFrameBarrier() const { return _frameBarrierEnabled; }
+
+    FrameBarrier& frameBarrier() { return _barrier; }
+
+    const FrameBarrier& frameBarrier() const { return _barrier; }
+
+    // Parallel member encoding; see AggregateBus::setExecutor.
+    void setExecutor(IExecutor* executor) { _executor = executor; }
+
+    IExecutor* executor() const { return _executor; }
+
     bool isReadyToUpdate() const override
     {
         for (const auto* bus : _busPointers)
@@ -67,6 +173,44 @@ class CompositeBus : public IPixelBus<typename std::tuple_element<0, std::tuple<
         return true;
     }
 
+    // See AggregateBus::setFrameTiming.
+    void setFrameTiming(FrameTiming* timing) override
+    {
+        for (auto* bus : _busPointers)
+        {
+            if (bus != nullptr)
+            {
+                bus->setFrameTiming(timing);
+            }
+        }
+    }
+
+    // Members show one after another, so they can borrow a single shader scratch and,
+    // where their transports allow it, a single protocol buffer from this bus instead
+    // of each holding their own. See IPixelBus::shareBuffers.
+    void shareMemberBuffers() { shareBuffers(_bufferPool); }
+
+    void shareBuffers(BusBufferPool<ColorType>& pool) override
+    {
+        _sharesBuffers = true;
+        _sharedPool = &pool;
+
+        // No protocol buffer pooling under the barrier; see AggregateBus::shareBuffers.
+        const bool lendsProtocolBytes = pool.lendsProtocolBytes();
+        pool.setLendsProtocolBytes(lendsProtocolBytes && !_frameBarrierEnabled);
+        for (auto* bus : _busPointers)
+        {
+            if (bus != nullptr)
+            {
+                bus->shareBuffers(pool);
+            }
+        }
+
+        pool.setLendsProtocolBytes(lendsProtocolBytes);
+    }
+
+    const BusBufferPool<ColorType>& bufferPool() const { return _bufferPool; }
+
     PixelView<ColorType>& pixels() override { return _pixels; }
 
     const PixelView<ColorType>& pixels() const override { return _pixels; }
@@ -76,6 +220,14 @@ class CompositeBus : public IPixelBus<typename std::tuple_element<0, std::tuple<
     const BusesTupleType& buses() const { return _buses; }
 
   private:
+    // Shared buffers are borrowed by one member at a time.
+    IExecutor* memberExecutor() const { return _sharesBuffers ? nullptr : _executor; }
+
+    void commitMember(BusBaseType& bus)
+    {
+        _completions.add([&bus](ShowCompletion member) { return bus.commitShowAsync(member); });
+    }
+
     template <size_t... TIndices>
     static std::array<BusBaseType*, sizeof...(TBuses)> makeBusPointers(BusesTupleType& buses,
                                                                        std::index_sequence<TIndices...>)
@@ -113,6 +265,13 @@ class CompositeBus : public IPixelBus<typename std::tuple_element<0, std::tuple<
     std::array<BusBaseType*, sizeof...(TBuses)> _busPointers;
     std::vector<ChunkType> _pixelChunks;
     PixelView<ColorType> _pixels;
+    BusBufferPool<ColorType> _bufferPool;
+    FrameBarrier _barrier;
+    bool _frameBarrierEnabled{false};
+    IExecutor* _executor{nullptr};
+    bool _sharesBuffers{false};
+    BusBufferPool<ColorType>* _sharedPool{nullptr};
+    ShowCompletionGroup _completions;
 };
 
 #endif
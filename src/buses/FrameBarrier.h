@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "buses/FrameClock.h"
+#include "core/Compat.h"
+#include "core/Executor.h"
+#include "core/IPixelBus.h"
+
+namespace lw::busses
+{
+
+struct FrameBarrierMemberStats
+{
+    // Microseconds between the first member's transmission start and this member's,
+    // for the most recent frame and the worst so far.
+    uint32_t skewUs{0};
+    uint32_t maxSkewUs{0};
+    // Frames refused because this member's transport was still busy.
+    uint32_t skippedFrames{0};
+};
+
+// Shows a set of buses as one frame: every member is encoded first, then all
+// transmissions start back to back. When any member is busy nothing is shown, so no
+// member ever runs a frame behind the others.
+class FrameBarrier
+{
+  public:
+    explicit FrameBarrier(size_t memberCount = 0, FrameClock clock = defaultFrameClock)
+        : _members(memberCount), _clock{(clock != nullptr) ? clock : defaultFrameClock}
+    {
+    }
+
+    void setClock(FrameClock clock) { _clock = (clock != nullptr) ? clock : defaultFrameClock; }
+
+    // `buses` holds raw or owning pointers to IPixelBus, one per member, and may hold
+    // null entries. Members are prepared on `executor` when one is given. Returns
+    // whether the frame was shown.
+    template <typename TBuses> bool show(const TBuses& buses, IExecutor* executor = nullptr)
+    {
+        return show(buses, executor, [](auto& bus) { bus.commitShow(); });
+    }
+
+    // show() that starts each member's transmission with `commit(bus)` instead of
+    // commitShow(), e.g. to collect per-member completions.
+    template <typename TBuses, typename TCommit> bool show(const TBuses& buses, IExecutor* executor, TCommit&& commit)
+    {
+        bool allReady = true;
+        size_t index = 0;
+        for (const auto& bus : buses)
+        {
+            if (bus != nullptr && !bus->isReadyToUpdate())
+            {
+                ++_members[index].skippedFrames;
+                allReady = false;
+            }
+
+            ++index;
+        }
+
+        if (!allReady)
+        {
+            ++_refusedFrames;
+            return false;
+        }
+
+        parallelFor(executor, buses.size(),
+                    [&buses](size_t member)
+                    {
+                        if (buses[member] != nullptr)
+                        {
+                            buses[member]->prepareShow();
+                        }
+                    });
+
+        bool first = true;
+        uint32_t firstStart = 0;
+        index = 0;
+        for (const auto& bus : buses)
+        {
+            if (bus != nullptr)
+            {
+                const uint32_t start = _clock();
+                if (first)
+                {
+                    firstStart = start;
+                    first = false;
+                }
+
+                auto& stats = _members[index];
+                stats.skewUs = start - firstStart;
+                stats.maxSkewUs = (stats.skewUs > stats.maxSkewUs) ? stats.skewUs : stats.maxSkewUs;
+                commit(*bus);
+            }
+
+            ++index;
+        }
+
+        ++_shownFrames;
+        return true;
+    }
+
+    span<const FrameBarrierMemberStats> memberStats() const
+    {
+        return span<const FrameBarrierMemberStats>{_members.data(), _members.size()};
+    }
+
+    uint32_t shownFrames() const { return _shownFrames; }
+
+    uint32_t refusedFrames() const { return _refusedFrames; }
+
+    void resetStats()
+    {
+        _members.assign(_members.size(), FrameBarrierMemberStats{});
+        _shownFrames = 0;
+        _refusedFrames = 0;
+    }
+
+  private:
+    std::vector<FrameBarrierMemberStats> _members;
+    FrameClock _clock;
+    uint32_t _shownFrames{0};
+    uint32_t _refusedFrames{0};
+};
+
+} // namespace lw::busses
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+#include "core/Compat.h"
+
+#if LW_HAS_ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+namespace lw::busses
+{
+
+// Microsecond timestamp source; wraps like micros().
+using FrameClock = uint32_t (*)();
+
+inline uint32_t defaultFrameClock()
+{
+#if LW_HAS_ARDUINO
+    return static_cast<uint32_t>(micros());
+#else
+    const auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+#endif
+}
+
+} // namespace lw::busses
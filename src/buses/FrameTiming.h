@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "buses/FrameClock.h"
+#include "core/Compat.h"
+#include "core/ShowCompletion.h"
+
+namespace lw::busses
+{
+
+static constexpr bool FrameTimingEnabled = (LW_FRAME_TIMING != 0);
+
+static_assert(LW_FRAME_TIMING_WINDOW > 0, "LW_FRAME_TIMING_WINDOW must be at least one sample.");
+
+enum class FrameStage : uint8_t
+{
+    // The shader pass over the frame.
+    Shade,
+    // protocol update(), including fused shading and the one-wire bit expansion that
+    // Ws2812x, Tm1814 and Tm1914 do there.
+    Serialize,
+    // The transport calls; streaming serializes here too, chunk by chunk.
+    Transmit,
+    Count
+};
+
+// Clock ticks over the most recent samples; microseconds with the default clock.
+struct FrameStageStats
+{
+    uint32_t min{0};
+    uint32_t avg{0};
+    uint32_t max{0};
+    uint32_t p99{0};
+    uint32_t samples{0};
+};
+
+struct FrameTimingStats
+{
+    FrameStageStats shade{};
+    FrameStageStats serialize{};
+    FrameStageStats transmit{};
+    uint32_t shownFrames{0};
+    // Shows that sent nothing because the transport was busy or nothing had changed.
+    uint32_t busySkippedShows{0};
+    uint32_t cleanSkippedShows{0};
+};
+
+// Rolling per-stage timings for the buses it is attached to with setFrameTiming().
+// Keeps the last LW_FRAME_TIMING_WINDOW samples of each stage.
+//
+// One instance may be shared by buses that show concurrently, such as aggregate
+// members preparing on an executor: record() and countShow() only use atomic
+// operations, so they neither lose updates nor block. Stats read while shows are
+// running may miss the samples still being written. setClock() and reset() are not
+// synchronized with shows.
+class FrameTiming
+{
+  public:
+    static constexpr size_t WindowSamples = LW_FRAME_TIMING_WINDOW;
+
+    explicit FrameTiming(FrameClock clock = defaultFrameClock)
+        : _clock{(clock != nullptr) ? clock : defaultFrameClock}
+    {
+    }
+
+    void setClock(FrameClock clock) { _clock = (clock != nullptr) ? clock : defaultFrameClock; }
+
+    uint32_t now() const { return _clock(); }
+
+    void record(FrameStage stage, uint32_t elapsed)
+    {
+        // Each sample claims its own slot, so concurrent records never share one.
+        Window& window = _stages[static_cast<size_t>(stage)];
+        const size_t slot = window.recorded.fetch_add(1, std::memory_order_relaxed) % WindowSamples;
+        window.samples[slot].store(elapsed, std::memory_order_relaxed);
+    }
+
+    void countShow(ShowStatus status)
+    {
+        switch (status)
+        {
+        case ShowStatus::Queued:
+            _shownFrames.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case ShowStatus::BusyDropped:
+            _busySkippedShows.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case ShowStatus::SkippedClean:
+            _cleanSkippedShows.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+    }
+
+    FrameStageStats stage(FrameStage stage) const
+    {
+        const Window& window = _stages[static_cast<size_t>(stage)];
+        const size_t count = std::min(window.recorded.load(std::memory_order_relaxed), WindowSamples);
+        FrameStageStats stats{};
+        if (count == 0)
+        {
+            return stats;
+        }
+
+        std::array<uint32_t, WindowSamples> sorted{};
+        for (size_t index = 0; index < count; ++index)
+        {
+            sorted[index] = window.samples[index].load(std::memory_order_relaxed);
+        }
+        std::sort(sorted.begin(), sorted.begin() + count);
+
+        uint64_t total = 0;
+        for (size_t index = 0; index < count; ++index)
+        {
+            total += sorted[index];
+        }
+
+        stats.min = sorted[0];
+        stats.max = sorted[count - 1];
+        stats.avg = static_cast<uint32_t>(total / count);
+        stats.p99 = sorted[(count * 99 + 99) / 100 - 1];
+        stats.samples = static_cast<uint32_t>(count);
+        return stats;
+    }
+
+    FrameTimingStats stats() const
+    {
+        FrameTimingStats stats{};
+        stats.shade = stage(FrameStage::Shade);
+        stats.serialize = stage(FrameStage::Serialize);
+        stats.transmit = stage(FrameStage::Transmit);
+        stats.shownFrames = _shownFrames.load(std::memory_order_relaxed);
+        stats.busySkippedShows = _busySkippedShows.load(std::memory_order_relaxed);
+        stats.cleanSkippedShows = _cleanSkippedShows.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void reset()
+    {
+        for (Window& window : _stages)
+        {
+            window.recorded.store(0, std::memory_order_relaxed);
+        }
+
+        _shownFrames.store(0, std::memory_order_relaxed);
+        _busySkippedShows.store(0, std::memory_order_relaxed);
+        _cleanSkippedShows.store(0, std::memory_order_relaxed);
+    }
+
+  private:
+    struct Window
+    {
+        std::array<std::atomic<uint32_t>, WindowSamples> samples{};
+        // Samples ever recorded; the next one goes to slot `recorded % WindowSamples`.
+        std::atomic<size_t> recorded{0};
+    };
+
+    FrameClock _clock;
+    std::array<Window, static_cast<size_t>(FrameStage::Count)> _stages{};
+    std::atomic<uint32_t> _shownFrames{0};
+    std::atomic<uint32_t> _busySkippedShows{0};
+    std::atomic<uint32_t> _cleanSkippedShows{0};
+};
+
+// Times one stage into `timing` for the scope's lifetime; does nothing when `timing`
+// is null or LW_FRAME_TIMING is 0.
+class FrameStageTimer
+{
+  public:
+    FrameStageTimer(FrameTiming* timing, FrameStage stage)
+        : _timing{FrameTimingEnabled ? timing : nullptr}, _stage{stage}
+    {
+        if (_timing != nullptr)
+        {
+            _start = _timing->now();
+        }
+    }
+
+    ~FrameStageTimer()
+    {
+        if (_timing != nullptr)
+        {
+            _timing->record(_stage, _timing->now() - _start);
+        }
+    }
+
+    FrameStageTimer(const FrameStageTimer&) = delete;
+    FrameStageTimer& operator=(const FrameStageTimer&) = delete;
+
+  private:
+    FrameTiming* _timing;
+    FrameStage _stage;
+    uint32_t _start{0};
+};
+
+} // namespace lw::busses
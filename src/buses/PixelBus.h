@@ -4,16 +4,21 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "buses/BusBuffers.h"
+#include "buses/FrameTiming.h"
 #include "colors/IShader.h"
 #include "colors/NilShader.h"
+#include "core/DirtyRangeSet.h"
 #include "core/IPixelBus.h"
 #include "protocols/IProtocol.h"
 #include "transports/ITransport.h"
+#include "transports/StreamChunkRing.h"
 #include "transports/Transports.h"
 
 namespace lw::busses
@@ -33,231 +38,49 @@ struct ResolveProtocolType<TProtocolCandidate, std::void_t<typename TProtocolCan
     using Type = typename TProtocolCandidate::ProtocolType;
 };
 
-} // namespace detail
-
-#if defined(ARDUINO_ARCH_ESP32)
-using PlatformDefaultTransport = lw::transports::esp32::Esp32I2sTransport;
-#elif defined(ARDUINO_ARCH_ESP8266)
-using PlatformDefaultTransport = lw::transports::esp8266::Esp8266DmaI2sTransport;
-#elif defined(ARDUINO_ARCH_RP2040)
-using PlatformDefaultTransport = lw::transports::rp2040::RpPioTransport;
-#elif defined(ARDUINO_ARCH_NATIVE) || !defined(ARDUINO)
-using PlatformDefaultTransport = lw::transports::NilTransport;
-#else
-#if defined(LW_HAS_SPI_TRANSPORT)
-using PlatformDefaultTransport = lw::transports::SpiTransport;
-#else
-using PlatformDefaultTransport = lw::transports::NilTransport;
-#endif
-#endif
-
-using PlatformDefaultTransportSettings = typename PlatformDefaultTransport::TransportSettingsType;
-
-#if !LW_DISABLE_TEMPLATE_COMBINATORIAL_TYPES
-
-template <typename TProtocol, typename TTransport = PlatformDefaultTransport,
-          typename TShader = NilShader<typename detail::ResolveProtocolType<TProtocol>::Type::ColorType>>
-class PixelBus : public IPixelBus<typename detail::ResolveProtocolType<TProtocol>::Type::ColorType>
+// Whether a bus shades a full copy of the frame before encoding, rather than fusing
+// the shader into the protocol's encode loop on small stack blocks.
+template <typename TProtocolSpec, typename TShader>
+inline constexpr bool PipelineUsesShaderScratch =
+    !std::is_same<lw::remove_cvref_t<TShader>,
+                  NilShader<typename ResolveProtocolType<TProtocolSpec>::Type::ColorType>>::value &&
+    !(shaders::ShaderSupportsFusedApply<TShader> &&
+      protocols::ProtocolSupportsFusedShading<typename ResolveProtocolType<TProtocolSpec>::Type>);
+
+// Settings normalization and protocol construction shared by the typed buses.
+template <typename TBusProtocolSpec, typename TBusTransport> struct PixelBusSetup
 {
-  public:
-    using ProtocolSpecType = TProtocol;
-
-    using ProtocolType = typename detail::ResolveProtocolType<ProtocolSpecType>::Type;
-    using TransportType = TTransport;
-    using ShaderType = TShader;
+    using ProtocolSpecType = TBusProtocolSpec;
+    using ProtocolType = typename ResolveProtocolType<ProtocolSpecType>::Type;
+    using TransportType = TBusTransport;
     using ColorType = typename ProtocolType::ColorType;
     using ProtocolSettingsType = typename ProtocolType::SettingsType;
     using TransportSettingsType = typename TransportType::TransportSettingsType;
 
-    static_assert(!std::is_same<ProtocolSettingsType, void>::value, "Protocol settings type must not be void.");
-    static_assert(std::is_convertible<ProtocolType*, protocols::IProtocol<ColorType>*>::value,
-                  "Protocol type must derive from IProtocol<ColorType>.");
-    static_assert(std::is_convertible<TransportType*, transports::ITransport*>::value,
-                  "Transport type must derive from ITransport.");
-    static_assert(std::is_convertible<ShaderType*, shaders::IShader<ColorType>*>::value,
-                  "Shader type must derive from IShader<ColorType>.");
-
-    static constexpr bool UsesShaderScratch =
-        !std::is_same<lw::remove_cvref_t<ShaderType>, NilShader<ColorType>>::value;
-
-    PixelBus(size_t pixelCount, ProtocolSettingsType protocolSettings, TransportSettingsType transportSettings,
-             ShaderType shaderInstance)
-        : _pixelCount(normalizePixelCount(pixelCount)),
-          _transport(normalizeTransportSettings(std::move(transportSettings), _pixelCount, protocolSettings)),
-          _protocol(makeProtocol(_pixelCount, _transport, normalizeProtocolSettings(std::move(protocolSettings)))),
-          _shader(std::move(shaderInstance)), _rootPixels(_pixelCount),
-          _pixelViewChunks{span<ColorType>{_rootPixels.data(), _rootPixels.size()}},
-          _pixels(span<span<ColorType>>{_pixelViewChunks.data(), _pixelViewChunks.size()}), _shaderScratch(_pixelCount),
-          _protocolBuffer(_protocol.requiredBufferSizeBytes(), static_cast<uint8_t>(0))
-    {
-    }
-
-    PixelBus(size_t pixelCount, ProtocolSettingsType protocolSettings, transports::OneWireTiming timing,
-             TransportSettingsType transportSettings, ShaderType shaderInstance)
-        : PixelBus(pixelCount, assignProtocolTimingIfPresent(std::move(protocolSettings), timing),
-                   std::move(transportSettings), std::move(shaderInstance))
-    {
-    }
-
-    template <typename TShaderAlias = ShaderType,
-              typename = std::enable_if_t<std::is_same<lw::remove_cvref_t<TShaderAlias>, NilShader<ColorType>>::value>>
-    PixelBus(size_t pixelCount, ProtocolSettingsType protocolSettings, TransportSettingsType transportSettings)
-        : _pixelCount(normalizePixelCount(pixelCount)),
-          _transport(normalizeTransportSettings(std::move(transportSettings), _pixelCount, protocolSettings)),
-          _protocol(makeProtocol(_pixelCount, _transport, normalizeProtocolSettings(std::move(protocolSettings)))),
-          _shader{}, _rootPixels(_pixelCount),
-          _pixelViewChunks{span<ColorType>{_rootPixels.data(), _rootPixels.size()}},
-          _pixels(span<span<ColorType>>{_pixelViewChunks.data(), _pixelViewChunks.size()}), _shaderScratch(0),
-          _protocolBuffer(_protocol.requiredBufferSizeBytes(), static_cast<uint8_t>(0))
-    {
-    }
-
-    template <typename TShaderAlias = ShaderType,
-              typename = std::enable_if_t<std::is_same<lw::remove_cvref_t<TShaderAlias>, NilShader<ColorType>>::value>>
-    PixelBus(size_t pixelCount, ProtocolSettingsType protocolSettings, transports::OneWireTiming timing,
-             TransportSettingsType transportSettings)
-        : PixelBus(pixelCount, assignProtocolTimingIfPresent(std::move(protocolSettings), timing),
-                   std::move(transportSettings))
-    {
-    }
-
-    template <typename TShaderAlias = ShaderType,
-              typename = std::enable_if_t<std::is_same<lw::remove_cvref_t<TShaderAlias>, NilShader<ColorType>>::value &&
-                                          std::is_default_constructible<ProtocolSettingsType>::value>>
-    PixelBus(size_t pixelCount, TransportSettingsType transportSettings)
-        : PixelBus(pixelCount, defaultProtocolSettings(), std::move(transportSettings))
-    {
-    }
-
-    template <
-        typename TShaderAlias = ShaderType,
-        typename = std::enable_if_t<!std::is_same<lw::remove_cvref_t<TShaderAlias>, NilShader<ColorType>>::value &&
-                                    std::is_default_constructible<ProtocolSettingsType>::value>>
-    PixelBus(size_t pixelCount, TransportSettingsType transportSettings, ShaderType shaderInstance)
-        : PixelBus(pixelCount, defaultProtocolSettings(), std::move(transportSettings), std::move(shaderInstance))
-    {
-    }
-
-    void begin() override
-    {
-        _transport.begin();
-        _protocol.begin();
-    }
-
-    void show() override
-    {
-        if (!_dirty && !_protocol.alwaysUpdate())
-        {
-            return;
-        }
-
-        if (!_transport.isReadyToUpdate())
-        {
-            return;
-        }
-
-        span<const ColorType> protocolInput{};
-        if (!_rootPixels.empty())
-        {
-            if constexpr (UsesShaderScratch)
-            {
-                std::copy(_rootPixels.begin(), _rootPixels.end(), _shaderScratch.begin());
-
-                span<ColorType> shaderSpan{_shaderScratch.data(), _shaderScratch.size()};
-                _shader.apply(shaderSpan);
-                protocolInput = shaderSpan;
-            }
-            else
-            {
-                protocolInput = span<const ColorType>{_rootPixels.data(), _rootPixels.size()};
-            }
-        }
-
-        span<uint8_t> protocolBytes{};
-        if (!_protocolBuffer.empty())
-        {
-            protocolBytes = span<uint8_t>{_protocolBuffer.data(), _protocolBuffer.size()};
-        }
-
-        _protocol.update(protocolInput, protocolBytes);
-
-        if (!protocolBytes.empty())
-        {
-            _transport.beginTransaction();
-            _transport.transmitBytes(protocolBytes);
-            _transport.endTransaction();
-        }
-
-        _dirty = false;
-    }
-
-    bool isReadyToUpdate() const override { return _transport.isReadyToUpdate(); }
-
-    PixelView<ColorType>& pixels() override
-    {
-        _dirty = true;
-        return _pixels;
-    }
-
-    const PixelView<ColorType>& pixels() const override { return _pixels; }
-
-    size_t pixelCount() const { return _pixelCount; }
-
-    span<ColorType> rootPixels() { return span<ColorType>{_rootPixels.data(), _rootPixels.size()}; }
-
-    span<const ColorType> rootPixels() const { return span<const ColorType>{_rootPixels.data(), _rootPixels.size()}; }
-
-    span<ColorType> shaderScratch() { return span<ColorType>{_shaderScratch.data(), _shaderScratch.size()}; }
-
-    span<const ColorType> shaderScratch() const
-    {
-        return span<const ColorType>{_shaderScratch.data(), _shaderScratch.size()};
-    }
-
-    span<uint8_t> protocolBuffer() { return span<uint8_t>{_protocolBuffer.data(), _protocolBuffer.size()}; }
-
-    span<const uint8_t> protocolBuffer() const
-    {
-        return span<const uint8_t>{_protocolBuffer.data(), _protocolBuffer.size()};
-    }
-
-    ProtocolType& protocol() { return _protocol; }
-
-    const ProtocolType& protocol() const { return _protocol; }
-
-    TransportType& transport() { return _transport; }
-
-    const TransportType& transport() const { return _transport; }
-
-    ShaderType& shader() { return _shader; }
-
-    const ShaderType& shader() const { return _shader; }
-
-  private:
-    static size_t normalizePixelCount(size_t pixelCount)
+    static constexpr size_t normalizePixelCount(size_t pixelCount)
     {
-        const size_t maxPixelCount = static_cast<size_t>(std::numeric_limits<uint16_t>::max());
+        const size_t maxPixelCount = static_cast<size_t>(std::numeric_limits<PixelCount>::max());
         return (pixelCount <= maxPixelCount) ? pixelCount : maxPixelCount;
     }
 
     static ProtocolType makeProtocol(size_t pixelCount, TransportType& transport, ProtocolSettingsType settings)
     {
-        const uint16_t protocolPixelCount = static_cast<uint16_t>(pixelCount);
-        if constexpr (std::is_constructible<ProtocolType, uint16_t, ProtocolSettingsType>::value)
+        const PixelCount protocolPixelCount = static_cast<PixelCount>(pixelCount);
+        if constexpr (std::is_constructible<ProtocolType, PixelCount, ProtocolSettingsType>::value)
         {
-            return ProtocolType{protocolPixelCount, std::move(settings)};
+            return ProtocolType(protocolPixelCount, std::move(settings));
         }
-        else if constexpr (std::is_constructible<ProtocolType, uint16_t, ProtocolSettingsType, TransportType&>::value)
+        else if constexpr (std::is_constructible<ProtocolType, PixelCount, ProtocolSettingsType, TransportType&>::value)
         {
-            return ProtocolType{protocolPixelCount, std::move(settings), transport};
+            return ProtocolType(protocolPixelCount, std::move(settings), transport);
         }
         else
         {
             static_assert(
-                std::is_constructible<ProtocolType, uint16_t, ProtocolSettingsType>::value ||
-                    std::is_constructible<ProtocolType, uint16_t, ProtocolSettingsType, TransportType&>::value,
+                std::is_constructible<ProtocolType, PixelCount, ProtocolSettingsType>::value ||
+                    std::is_constructible<ProtocolType, PixelCount, ProtocolSettingsType, TransportType&>::value,
                 "Protocol must be constructible with settings (with or without transport reference).");
-            return ProtocolType{protocolPixelCount, std::move(settings)};
+            return ProtocolType(protocolPixelCount, std::move(settings));
         }
     }
 
@@ -282,7 +105,7 @@ class PixelBus : public IPixelBus<typename detail::ResolveProtocolType<TProtocol
     {
     };
 
-    static ProtocolSettingsType assignProtocolTimingIfPresent(ProtocolSettingsType settings,
+    static constexpr ProtocolSettingsType assignProtocolTimingIfPresent(ProtocolSettingsType settings,
                                                               transports::OneWireTiming timing)
     {
         if constexpr (ProtocolSettingsHasTiming<ProtocolSettingsType>::value)
@@ -314,7 +137,7 @@ class PixelBus : public IPixelBus<typename detail::ResolveProtocolType<TProtocol
     {
     };
 
-    static ProtocolSettingsType defaultProtocolSettings()
+    static constexpr ProtocolSettingsType defaultProtocolSettings()
     {
         if constexpr (ProtocolSpecHasDefaultSettings<ProtocolSpecType>::value)
         {
@@ -324,7 +147,7 @@ class PixelBus : public IPixelBus<typename detail::ResolveProtocolType<TProtocol
         return ProtocolSettingsType{};
     }
 
-    static ProtocolSettingsType normalizeProtocolSettings(ProtocolSettingsType settings)
+    static constexpr ProtocolSettingsType normalizeProtocolSettings(ProtocolSettingsType settings)
     {
         if constexpr (ProtocolSpecHasNormalizeSettings<ProtocolSpecType>::value)
         {
@@ -419,17 +242,968 @@ class PixelBus : public IPixelBus<typename detail::ResolveProtocolType<TProtocol
 
         return settings;
     }
+};
 
-    size_t _pixelCount{0};
-    TransportType _transport;
-    ProtocolType _protocol;
-    ShaderType _shader;
-    std::vector<ColorType> _rootPixels;
-    std::array<span<ColorType>, 1> _pixelViewChunks;
-    PixelView<ColorType> _pixels;
-    std::vector<ColorType> _shaderScratch;
-    std::vector<uint8_t> _protocolBuffer;
-    bool _dirty{true};
+} // namespace detail
+
+#if defined(ARDUINO_ARCH_ESP32)
+using PlatformDefaultTransport = lw::transports::esp32::Esp32I2sTransport;
+#elif defined(ARDUINO_ARCH_ESP8266)
+using PlatformDefaultTransport = lw::transports::esp8266::Esp8266DmaI2sTransport;
+#elif defined(ARDUINO_ARCH_RP2040)
+using PlatformDefaultTransport = lw::transports::rp2040::RpPioTransport;
+#elif defined(ARDUINO_ARCH_NATIVE) || !defined(ARDUINO)
+using PlatformDefaultTransport = lw::transports::NilTransport;
+#else
+#if defined(LW_HAS_SPI_TRANSPORT)
+using PlatformDefaultTransport = lw::transports::SpiTransport;
+#else
+using PlatformDefaultTransport = lw::transports::NilTransport;
+#endif
+#endif
+
+using PlatformDefaultTransportSettings = typename PlatformDefaultTransport::TransportSettingsType;
+
+#if !LW_DISABLE_TEMPLATE_COMBINATORIAL_TYPES
+
+namespace detail
+{
+
+// The show pipeline behind PixelBus and StaticPixelBus: dirty tracking, shading,
+// encoding, double buffering, streaming and transmission. The buses differ only in
+// where their buffers live, which `TStorage` decides. Each binds spans over its
+// storage, or over caller-supplied buffers, and publishes the controls it offers.
+template <typename TProtocol, typename TTransport, typename TShader, typename TStorage>
+class PixelBusPipeline : public IPixelBus<typename ResolveProtocolType<TProtocol>::Type::ColorType>
+{
+  public:
+    using ProtocolSpecType = TProtocol;
+
+    using ProtocolType = typename ResolveProtocolType<ProtocolSpecType>::Type;
+    using TransportType = TTransport;
+    using ShaderType = TShader;
+    using StorageType = TStorage;
+    using ColorType = typename ProtocolType::ColorType;
+    using ProtocolSettingsType = typename ProtocolType::SettingsType;
+    using TransportSettingsType = typename TransportType::TransportSettingsType;
+
+    static_assert(!std::is_same<ProtocolSettingsType, void>::value, "Protocol settings type must not be void.");
+    static_assert(std::is_convertible<ProtocolType*, protocols::IProtocol<ColorType>*>::value,
+                  "Protocol type must derive from IProtocol<ColorType>.");
+    static_assert(std::is_convertible<TransportType*, transports::ITransport*>::value,
+                  "Transport type must derive from ITransport.");
+    static_assert(std::is_convertible<ShaderType*, shaders::IShader<ColorType>*>::value,
+                  "Shader type must derive from IShader<ColorType>.");
+
+    static constexpr bool HasShader = !std::is_same<lw::remove_cvref_t<ShaderType>, NilShader<ColorType>>::value;
+
+    // Fused shaders run inside the protocol's encode loop on small stack blocks, so no
+    // frame-sized shader scratch is allocated. Other shaders shade a full copy first.
+    static constexpr bool FusesShader = HasShader && shaders::ShaderSupportsFusedApply<ShaderType> &&
+                                        protocols::ProtocolSupportsFusedShading<ProtocolType>;
+
+    static constexpr bool UsesShaderScratch = PipelineUsesShaderScratch<ProtocolSpecType, ShaderType>;
+
+    // A non-pointwise shader may change pixels outside the modified ranges.
+    static constexpr bool ShadesWholeFrame = HasShader && !shaders::ShaderIsPointwise<ShaderType>;
+
+    // Partial re-encode needs a protocol with fixed per-pixel strides, pixels that are
+    // either unshaded or shaded pointwise inside the encode loop, and a transport that
+    // leaves the transmitted frame intact for the next one to patch.
+    static constexpr bool UsesPartialUpdate =
+        protocols::ProtocolSupportsPartialUpdate<ProtocolType> && (!HasShader || (FusesShader && !ShadesWholeFrame)) &&
+        transports::TransportPreservesBuffer<TransportType>;
+
+    static constexpr size_t DirtyRangeCapacity = 4;
+
+    // Streaming swaps the protocol buffer for a chunk ring at runtime, so it needs
+    // storage that can be resized, and a transport that sends the chunks back to back.
+    static constexpr bool SupportsStreaming = protocols::ProtocolSupportsStreaming<ProtocolType> &&
+                                              transports::TransportStreamsChunks<TransportType> &&
+                                              StorageType::Resizable;
+
+    static constexpr bool SupportsTruncation = protocols::ProtocolSupportsTruncation<ProtocolType>;
+
+    void begin() override
+    {
+        _transport.begin();
+        _protocol.begin();
+    }
+
+    void show() override
+    {
+        prepareShow();
+        commitShow();
+    }
+
+    // Streaming encodes while transmitting, and a shared protocol buffer is only
+    // encoded once the members before it are done with it, so both do all their work
+    // in commitShow().
+    void prepareShow() override
+    {
+        if (!_buffersValid || _streaming)
+        {
+            return;
+        }
+
+        if (_doubleBuffered)
+        {
+            // The buffer on the wire is never written; only the back buffer is encoded.
+            if (frameRequested())
+            {
+                // A held frame replaced before it was sent never reaches the wire.
+                _heldCompletion.fire();
+                encodeFrame(_backBuffer);
+                _pendingFrame = true;
+                _pendingFrameReported = false;
+            }
+
+            return;
+        }
+
+        if (!_poolsProtocolBuffer)
+        {
+            prepareFrame();
+        }
+    }
+
+    void commitShow() override { commitFrame(); }
+
+    void setFrameTiming(FrameTiming* timing) override { _frameTiming = timing; }
+
+    // A bus must not be moved while a completion is pending.
+    ShowStatus showAsync(ShowCompletion completion = {}) override
+    {
+        prepareShow();
+        return commitShowAsync(completion);
+    }
+
+    ShowStatus commitShowAsync(ShowCompletion completion = {}) override
+    {
+        pollCompletion();
+
+        if constexpr (transports::TransportSignalsTransferComplete<TransportType>)
+        {
+            _transport.setTransferCompleteCallback(&PixelBusPipeline::onTransferComplete, this);
+        }
+
+        const ShowStatus status = commitFrame();
+        if (status != ShowStatus::Queued)
+        {
+            return status;
+        }
+
+        if (_pendingFrame)
+        {
+            // Held behind the frame on the wire; moves over when it is sent.
+            _heldCompletion.arm(completion);
+            return ShowStatus::Queued;
+        }
+
+        _completion.arm(completion);
+        // Covers synchronous transports, and a transfer that ended before arm().
+        pollCompletion();
+        return ShowStatus::Queued;
+    }
+
+    bool pollCompletion() override
+    {
+        if (!_completion.armed() || !_transport.isReadyToUpdate())
+        {
+            return false;
+        }
+
+        return _completion.fire();
+    }
+
+    // Opt-in for protocols whose chips hold their last value when a frame ends early.
+    // show() then transmits the encoded frame only through the highest pixel modified
+    // since the previous transmission, followed by the protocol's latch, so airtime
+    // scales with the changed prefix rather than the strip length. Whole-bus edits,
+    // whole-frame shaders and always-update protocols still send full frames. Returns
+    // whether truncation is active.
+    bool setTruncatedTransmission(bool enabled)
+    {
+        _truncatedTransmission = enabled && SupportsTruncation;
+        return _truncatedTransmission;
+    }
+
+    bool isTruncatedTransmission() const { return _truncatedTransmission; }
+
+    bool isReadyToUpdate() const override { return _transport.isReadyToUpdate(); }
+
+    PixelView<ColorType>& pixels() override
+    {
+        _dirty = true;
+        return _pixels;
+    }
+
+    // Records [first, first + count) as modified without invalidating the rest of the
+    // frame. Use after writing through rootPixels(); pixels() marks the whole bus, and
+    // is also the way to force a full re-encode after changing protocol settings.
+    void markDirty(size_t first, size_t count)
+    {
+        const size_t clampedFirst = std::min(first, _pixelCount);
+        const size_t clampedEnd = clampedFirst + std::min(count, _pixelCount - clampedFirst);
+        _dirtyRanges.add(clampedFirst, clampedEnd);
+    }
+
+    // Writable window over [first, first + count) that marks only that range dirty.
+    span<ColorType> editPixels(size_t first, size_t count)
+    {
+        markDirty(first, count);
+        const size_t clampedFirst = std::min(first, _pixelCount);
+        return span<ColorType>{_rootPixels.data() + clampedFirst, std::min(count, _pixelCount - clampedFirst)};
+    }
+
+    const DirtyRangeSet<DirtyRangeCapacity>& dirtyRanges() const { return _dirtyRanges; }
+
+    const PixelView<ColorType>& pixels() const override { return _pixels; }
+
+    span<ColorType> rootPixels() { return _rootPixels; }
+
+    span<const ColorType> rootPixels() const { return span<const ColorType>{_rootPixels.data(), _rootPixels.size()}; }
+
+    span<ColorType> shaderScratch() { return _shaderScratch; }
+
+    span<const ColorType> shaderScratch() const
+    {
+        return span<const ColorType>{_shaderScratch.data(), _shaderScratch.size()};
+    }
+
+    // The frame most recently handed to the transport.
+    span<uint8_t> protocolBuffer() { return _protocolBuffer; }
+
+    span<const uint8_t> protocolBuffer() const
+    {
+        return span<const uint8_t>{_protocolBuffer.data(), _protocolBuffer.size()};
+    }
+
+    ProtocolType& protocol() { return _protocol; }
+
+    const ProtocolType& protocol() const { return _protocol; }
+
+    TransportType& transport() { return _transport; }
+
+    const TransportType& transport() const { return _transport; }
+
+    ShaderType& shader() { return _shader; }
+
+    const ShaderType& shader() const { return _shader; }
+
+  protected:
+    using Setup = PixelBusSetup<ProtocolSpecType, TransportType>;
+
+    PixelBusPipeline(size_t pixelCount, ProtocolSettingsType protocolSettings, TransportSettingsType transportSettings,
+                     ShaderType shaderInstance)
+        : _pixelCount(Setup::normalizePixelCount(pixelCount)),
+          _transport(Setup::normalizeTransportSettings(std::move(transportSettings), _pixelCount, protocolSettings)),
+          _protocol(Setup::makeProtocol(_pixelCount, _transport,
+                                        Setup::normalizeProtocolSettings(std::move(protocolSettings)))),
+          _shader(std::move(shaderInstance)),
+          _pixels(span<span<ColorType>>{_pixelViewChunks.data(), _pixelViewChunks.size()})
+    {
+    }
+
+    BusBufferRequirements requiredBuffers() const
+    {
+        return BusBufferRequirements{_pixelCount, UsesShaderScratch ? _pixelCount : 0,
+                                     _protocol.requiredBufferSizeBytes()};
+    }
+
+    // Runs on the bus's own storage, sizing it first when it is resizable. A protocol
+    // buffer too small for the settings is left unbound, so show() transmits nothing.
+    void bindOwnedBuffers()
+    {
+        const BusBufferRequirements required = requiredBuffers();
+        if constexpr (StorageType::Resizable)
+        {
+            _storage.pixels.resize(required.rootPixels);
+            _storage.shaderScratch.resize(required.shaderScratch);
+            _storage.protocolBuffer.assign(required.protocolBytes, static_cast<uint8_t>(0));
+        }
+
+        const size_t protocolBytes =
+            (required.protocolBytes <= _storage.protocolBuffer.size()) ? required.protocolBytes : 0;
+        bindBuffers(span<ColorType>{_storage.pixels.data(), required.rootPixels},
+                    span<ColorType>{_storage.shaderScratch.data(), required.shaderScratch},
+                    span<uint8_t>{_storage.protocolBuffer.data(), protocolBytes});
+    }
+
+    void bindSuppliedBuffers(const BusBuffers<ColorType>& supplied)
+    {
+        const BusBufferRequirements required = requiredBuffers();
+        if (!supplied.satisfies(required))
+        {
+            // Never write past undersized storage; the bus stays empty instead.
+            _pixelCount = 0;
+            _buffersValid = false;
+            bindBuffers(span<ColorType>{}, span<ColorType>{}, span<uint8_t>{});
+            return;
+        }
+
+        _suppliedProtocolBuffer = span<uint8_t>{supplied.protocolBuffer.data(), required.protocolBytes};
+        bindBuffers(span<ColorType>{supplied.rootPixels.data(), required.rootPixels},
+                    span<ColorType>{supplied.shaderScratch.data(), required.shaderScratch}, _suppliedProtocolBuffer);
+    }
+
+    void bindBuffers(span<ColorType> rootPixels, span<ColorType> shaderScratch, span<uint8_t> protocolBuffer)
+    {
+        _rootPixels = rootPixels;
+        _shaderScratch = shaderScratch;
+        _protocolBuffer = protocolBuffer;
+        _pixelViewChunks[0] = _rootPixels;
+        _pixels = PixelView<ColorType>(span<span<ColorType>>{_pixelViewChunks.data(), _pixelViewChunks.size()});
+    }
+
+    // Shader scratch the bus allocated itself is borrowed from `pool` instead, as is
+    // the protocol buffer when the transport completes synchronously and the bus is
+    // neither double buffered nor streaming; enabling double buffering later takes
+    // the protocol buffer back. Caller-supplied buffers stay in use. A shared
+    // protocolBuffer() may hold another member's frame after that member shows.
+    void borrowBuffers(BusBufferPool<ColorType>& pool)
+    {
+        if (!_buffersValid)
+        {
+            return;
+        }
+
+        _bufferPool = &pool;
+
+        if constexpr (HasShader)
+        {
+            if (_shaderScratch.empty() || !_storage.shaderScratch.empty())
+            {
+                pool.scratch(UsesShaderScratch ? _pixelCount : 0);
+                std::vector<ColorType>().swap(_storage.shaderScratch);
+                _shaderScratch = span<ColorType>{};
+                _poolsShaderScratch = true;
+            }
+        }
+
+        if (!pool.lendsProtocolBytes())
+        {
+            if (_poolsProtocolBuffer)
+            {
+                keepOwnProtocolBuffer();
+            }
+
+            return;
+        }
+
+        if constexpr (transports::TransportCompletesSynchronously<TransportType>)
+        {
+            if (!_storage.protocolBuffer.empty() && !_doubleBuffered && !_streaming)
+            {
+                pool.protocolBytes(_storage.protocolBuffer.size());
+                std::vector<uint8_t>().swap(_storage.protocolBuffer);
+                _protocolBuffer = span<uint8_t>{};
+                _poolsProtocolBuffer = true;
+                _frameEncoded = false;
+                if (_preparedFrame)
+                {
+                    // The prepared frame went with the released buffer.
+                    _preparedFrame = false;
+                    _dirty = true;
+                }
+            }
+        }
+    }
+
+    // Opt-in second protocol buffer. show() then encodes the next frame while the
+    // previous one is still on the wire and hands it over once the transport is ready,
+    // so encode time overlaps transmission at the cost of another protocol buffer.
+    void setDoubleBuffered(bool enabled)
+    {
+        if (enabled == _doubleBuffered)
+        {
+            return;
+        }
+
+        if (enabled && _poolsProtocolBuffer)
+        {
+            // The frame on the wire must survive until the next swap.
+            keepOwnProtocolBuffer();
+        }
+
+        _doubleBuffered = enabled;
+        _storage.backBuffer.assign((enabled && !_streaming) ? _protocolBuffer.size() : 0, static_cast<uint8_t>(0));
+        _backBuffer = span<uint8_t>{_storage.backBuffer.data(), _storage.backBuffer.size()};
+        _heldCompletion.fire();
+        _pendingFrame = false;
+        _preparedFrame = false;
+        _frameEncoded = false;
+        _dirty = true;
+    }
+
+    bool isDoubleBuffered() const { return _doubleBuffered; }
+
+    // Opt-in streaming for protocols that can encode incrementally. The full protocol
+    // buffer is released; show() pulls the frame through `chunkCount` chunks of
+    // `chunkBytes` each, so encoded memory no longer grows with the pixel count. The
+    // ring keeps at least one chunk beyond those the transport may still be reading.
+    // Takes precedence over double buffering. Returns whether streaming is active.
+    bool setStreaming(bool enabled, size_t chunkBytes = LW_STREAM_CHUNK_BYTES,
+                      size_t chunkCount = LW_STREAM_CHUNK_COUNT)
+    {
+        if constexpr (!SupportsStreaming)
+        {
+            (void)enabled;
+            (void)chunkBytes;
+            (void)chunkCount;
+            return false;
+        }
+        else
+        {
+            if (enabled)
+            {
+                constexpr size_t MinChunkCount = transports::TransportStreamChunksInFlight<TransportType> + 1;
+                _streamChunkCount = std::max(chunkCount, MinChunkCount);
+                _storage.streamChunks.assign(chunkBytes * _streamChunkCount, static_cast<uint8_t>(0));
+                std::vector<uint8_t>().swap(_storage.protocolBuffer);
+                std::vector<uint8_t>().swap(_storage.backBuffer);
+                _protocolBuffer = span<uint8_t>{};
+                _backBuffer = span<uint8_t>{};
+            }
+            else if (_streaming)
+            {
+                std::vector<uint8_t>().swap(_storage.streamChunks);
+                if (!_suppliedProtocolBuffer.empty())
+                {
+                    _protocolBuffer = _suppliedProtocolBuffer;
+                }
+                else if (_poolsProtocolBuffer)
+                {
+                    _protocolBuffer = span<uint8_t>{};
+                }
+                else
+                {
+                    _storage.protocolBuffer.assign(_protocol.requiredBufferSizeBytes(), static_cast<uint8_t>(0));
+                    _protocolBuffer = span<uint8_t>{_storage.protocolBuffer.data(), _storage.protocolBuffer.size()};
+                }
+
+                _storage.backBuffer.assign(_doubleBuffered ? _protocolBuffer.size() : 0, static_cast<uint8_t>(0));
+                _backBuffer = span<uint8_t>{_storage.backBuffer.data(), _storage.backBuffer.size()};
+            }
+
+            _streaming = enabled;
+            _heldCompletion.fire();
+            _pendingFrame = false;
+            _preparedFrame = false;
+            _frameEncoded = false;
+            _dirty = true;
+            return _streaming;
+        }
+    }
+
+    bool isStreaming() const { return _streaming; }
+
+    // True when a double-buffered frame is encoded but not yet handed to the transport.
+    bool hasPendingFrame() const { return _pendingFrame; }
+
+    // False when supplied buffers were smaller than bufferRequirements().
+    bool hasValidBuffers() const { return _buffersValid; }
+
+    size_t pixelCount() const { return _pixelCount; }
+
+  private:
+    bool frameRequested() const { return _dirty || !_dirtyRanges.empty() || alwaysUpdate(); }
+
+    // The protocol or the shader wants every show() sent, even with no pixel changed.
+    bool alwaysUpdate() const { return _protocol.alwaysUpdate() || _shader.alwaysUpdate(); }
+
+    // Stops borrowing the protocol buffer from the pool; the next frame is encoded in
+    // full into a buffer of this bus's own.
+    void keepOwnProtocolBuffer()
+    {
+        _poolsProtocolBuffer = false;
+        _frameEncoded = false;
+        if (!_streaming)
+        {
+            _storage.protocolBuffer.assign(_protocol.requiredBufferSizeBytes(), static_cast<uint8_t>(0));
+            _protocolBuffer = span<uint8_t>{_storage.protocolBuffer.data(), _storage.protocolBuffer.size()};
+        }
+    }
+
+    ShowStatus commitFrame()
+    {
+        const bool frameWaiting = _buffersValid && (_preparedFrame || _pendingFrame || frameRequested());
+        // A held frame already reported Queued by the show that encoded it.
+        const bool frameReported = _pendingFrame && _pendingFrameReported;
+        const uint32_t framesSent = _framesSent;
+        transmitFrame();
+
+        ShowStatus status = ShowStatus::SkippedClean;
+        if (!frameReported && (_framesSent != framesSent || _pendingFrame))
+        {
+            status = ShowStatus::Queued;
+            _pendingFrameReported = _pendingFrame;
+        }
+        else if (!frameReported && frameWaiting)
+        {
+            status = ShowStatus::BusyDropped;
+        }
+
+        if (FrameTimingEnabled && _frameTiming != nullptr)
+        {
+            _frameTiming->countShow(status);
+        }
+
+        return status;
+    }
+
+    void transmitFrame()
+    {
+        if (!_buffersValid)
+        {
+            return;
+        }
+
+        if constexpr (SupportsStreaming)
+        {
+            if (_streaming)
+            {
+                showStreamed();
+                return;
+            }
+        }
+
+        if constexpr (StorageType::Resizable)
+        {
+            if (_doubleBuffered)
+            {
+                commitDoubleBuffered();
+                return;
+            }
+        }
+
+        if (_poolsProtocolBuffer)
+        {
+            prepareFrame();
+        }
+
+        if (_preparedFrame)
+        {
+            _preparedFrame = false;
+            transmitProtocolBuffer();
+        }
+    }
+
+    // A signal can arrive late, after the next frame started; pollCompletion() checks the
+    // transport is idle so it never completes a frame still on the wire.
+    static void onTransferComplete(void* context) { static_cast<PixelBusPipeline*>(context)->pollCompletion(); }
+
+    void prepareFrame()
+    {
+        if (!frameRequested() || !_transport.isReadyToUpdate())
+        {
+            return;
+        }
+
+        if (_poolsProtocolBuffer)
+        {
+            // Other members wrote the shared buffer since this bus last encoded into it.
+            _protocolBuffer = _bufferPool->protocolBytes(_protocol.requiredBufferSizeBytes());
+            _frameEncoded = false;
+        }
+
+        encodeFrame(_protocolBuffer);
+        _preparedFrame = true;
+    }
+
+    void commitDoubleBuffered()
+    {
+        if (!_pendingFrame || !_transport.isReadyToUpdate())
+        {
+            return;
+        }
+
+        // The frame leaving the wire completes before the held one takes its place.
+        pollCompletion();
+
+        // Ownership travels with each buffer, so a supplied buffer is never freed.
+        std::swap(_protocolBuffer, _backBuffer);
+        _storage.protocolBuffer.swap(_storage.backBuffer);
+        _pendingFrame = false;
+        _pendingFrameReported = false;
+        // The new back buffer holds an older frame, so it cannot take partial updates.
+        _frameEncoded = false;
+        transmitProtocolBuffer();
+
+        _completion.arm(_heldCompletion.release());
+        pollCompletion();
+    }
+
+    void showStreamed()
+    {
+        if (!frameRequested() || !_transport.isReadyToUpdate())
+        {
+            return;
+        }
+
+        transports::StreamChunkRing ring{span<uint8_t>{_storage.streamChunks.data(), _storage.streamChunks.size()},
+                                         _streamChunkCount};
+        if constexpr (FusesShader)
+        {
+            // Each chunk is shaded on stack blocks while it is encoded.
+            const span<const ColorType> rootInput{_rootPixels.data(), _rootPixels.size()};
+            if constexpr (shaders::ShaderHasFramePass<ShaderType>)
+            {
+                _shader.prepare(rootInput);
+            }
+
+            _protocol.beginStream(rootInput);
+            ShadedStream<decltype(shadeBlock())> source{_protocol, shadeBlock()};
+            FrameStageTimer timer{_frameTiming, FrameStage::Transmit};
+            ring.transmit(_transport, source);
+        }
+        else
+        {
+            _protocol.beginStream(shadedPixels());
+            FrameStageTimer timer{_frameTiming, FrameStage::Transmit};
+            ring.transmit(_transport, _protocol);
+        }
+
+        ++_framesSent;
+
+        _dirty = false;
+        _dirtyRanges.clear();
+        _transmitExtent = 0;
+    }
+
+    // Pixels [0, extent) may differ from what the strip last received.
+    size_t modifiedExtent() const
+    {
+        if (_dirty || ShadesWholeFrame || alwaysUpdate() || _dirtyRanges.empty())
+        {
+            return _pixelCount;
+        }
+
+        return _dirtyRanges[_dirtyRanges.size() - 1].end;
+    }
+
+    span<const ColorType> shadedPixels()
+    {
+        if (_rootPixels.empty())
+        {
+            return span<const ColorType>{};
+        }
+
+        if constexpr (HasShader)
+        {
+            if (_poolsShaderScratch)
+            {
+                _shaderScratch = _bufferPool->scratch(_rootPixels.size());
+            }
+
+            FrameStageTimer timer{_frameTiming, FrameStage::Shade};
+            std::copy(_rootPixels.begin(), _rootPixels.end(), _shaderScratch.begin());
+            _shader.apply(_shaderScratch);
+            return _shaderScratch;
+        }
+
+        return span<const ColorType>{_rootPixels.data(), _rootPixels.size()};
+    }
+
+    void encodeFrame(span<uint8_t> target)
+    {
+        _transmitExtent = std::max(_transmitExtent, modifiedExtent());
+
+        if constexpr (UsesPartialUpdate)
+        {
+            if (!_dirty && _frameEncoded && !alwaysUpdate())
+            {
+                encodeDirtyRanges(target);
+                _dirtyRanges.clear();
+                return;
+            }
+        }
+
+        const span<uint8_t> protocolBytes = target;
+
+        if constexpr (FusesShader)
+        {
+            const span<const ColorType> rootInput{_rootPixels.data(), _rootPixels.size()};
+            if constexpr (shaders::ShaderHasFramePass<ShaderType>)
+            {
+                _shader.prepare(rootInput);
+            }
+
+            FrameStageTimer timer{_frameTiming, FrameStage::Serialize};
+            _protocol.updateShaded(rootInput, protocolBytes, shadeBlock());
+        }
+        else
+        {
+            const span<const ColorType> protocolInput = shadedPixels();
+            FrameStageTimer timer{_frameTiming, FrameStage::Serialize};
+            _protocol.update(protocolInput, protocolBytes);
+        }
+
+        _dirty = false;
+        _dirtyRanges.clear();
+        _latchOverwrite = PixelRange{};
+        _frameEncoded = true;
+    }
+
+    void encodeDirtyRanges(span<uint8_t> protocolBytes)
+    {
+        FrameStageTimer timer{_frameTiming, FrameStage::Serialize};
+
+        if (_latchOverwrite.count() != 0)
+        {
+            encodeRange(protocolBytes, _latchOverwrite);
+            _latchOverwrite = PixelRange{};
+        }
+
+        for (const auto& range : _dirtyRanges)
+        {
+            encodeRange(protocolBytes, range);
+        }
+    }
+
+    void encodeRange(span<uint8_t> protocolBytes, const PixelRange& range)
+    {
+        const span<const ColorType> protocolInput{_rootPixels.data(), _rootPixels.size()};
+        if constexpr (FusesShader)
+        {
+            _protocol.updateRangeShaded(protocolInput, protocolBytes, range.first, range.end, shadeBlock());
+        }
+        else
+        {
+            _protocol.updateRange(protocolInput, protocolBytes, range.first, range.end);
+        }
+    }
+
+    // Streaming source that shades each chunk's pixels as the protocol encodes them.
+    template <typename TShade> struct ShadedStream
+    {
+        ProtocolType& protocol;
+        TShade shade;
+
+        size_t encodeNext(span<uint8_t> out) { return protocol.encodeNextShaded(out, shade); }
+    };
+
+    auto shadeBlock()
+    {
+        return [this](span<ColorType> block)
+        {
+            for (auto& color : block)
+            {
+                _shader.applyOne(color);
+            }
+        };
+    }
+
+    void transmitProtocolBuffer()
+    {
+        if (_protocolBuffer.empty())
+        {
+            return;
+        }
+
+        ++_framesSent;
+        FrameStageTimer timer{_frameTiming, FrameStage::Transmit};
+        _transport.beginTransaction();
+        if constexpr (SupportsTruncation)
+        {
+            if (_truncatedTransmission && _transmitExtent < _pixelCount)
+            {
+                transmitTruncated(_transmitExtent);
+                _transport.endTransaction();
+                _transmitExtent = 0;
+                return;
+            }
+        }
+
+        _transport.transmitBytes(_protocolBuffer);
+        _transport.endTransaction();
+        _transmitExtent = 0;
+    }
+
+    // Sends the payload and latch as one transmitBytes() call, since a DMA transport
+    // restarts on every call and a separate latch transfer would cut the payload short.
+    // The latch is moved up behind the payload, over pixels that are re-encoded before
+    // the buffer is next transmitted.
+    void transmitTruncated(size_t pixelCount)
+    {
+        const size_t payloadBytes = std::min(_protocol.truncatedPayloadSize(pixelCount), _protocolBuffer.size());
+        const size_t latchBytes =
+            std::min(_protocol.truncatedLatchSize(pixelCount), _protocolBuffer.size() - payloadBytes);
+
+        uint8_t* frame = _protocolBuffer.data();
+        std::memmove(frame + payloadBytes, frame + (_protocolBuffer.size() - latchBytes), latchBytes);
+        recordLatchOverwrite(pixelCount, payloadBytes, latchBytes);
+        _transport.transmitBytes(span<uint8_t>{frame, payloadBytes + latchBytes});
+    }
+
+    void recordLatchOverwrite(size_t firstPixel, size_t payloadBytes, size_t latchBytes)
+    {
+        if (latchBytes == 0)
+        {
+            return;
+        }
+
+        const size_t stride = _protocol.truncatedPayloadSize(firstPixel + 1) - payloadBytes;
+        if (stride == 0 || payloadBytes + latchBytes > _protocol.truncatedPayloadSize(_pixelCount))
+        {
+            // The latch reached past the last pixel; only a full encode restores that.
+            _frameEncoded = false;
+            return;
+        }
+
+        const size_t end = std::min(firstPixel + ((latchBytes + stride - 1) / stride), _pixelCount);
+        const size_t first = (_latchOverwrite.count() == 0) ? firstPixel : std::min(_latchOverwrite.first, firstPixel);
+        _latchOverwrite = PixelRange{first, std::max(_latchOverwrite.end, end)};
+    }
+
+    size_t _pixelCount{0};
+    TransportType _transport;
+    ProtocolType _protocol;
+    ShaderType _shader;
+    StorageType _storage;
+    span<ColorType> _rootPixels;
+    std::array<span<ColorType>, 1> _pixelViewChunks{};
+    PixelView<ColorType> _pixels;
+    span<ColorType> _shaderScratch;
+    span<uint8_t> _suppliedProtocolBuffer;
+    span<uint8_t> _protocolBuffer;
+    span<uint8_t> _backBuffer;
+    bool _buffersValid{true};
+    BusBufferPool<ColorType>* _bufferPool{nullptr};
+    bool _poolsShaderScratch{false};
+    bool _poolsProtocolBuffer{false};
+    DirtyRangeSet<DirtyRangeCapacity> _dirtyRanges;
+    bool _dirty{true};
+    bool _frameEncoded{false};
+    size_t _streamChunkCount{0};
+    bool _doubleBuffered{false};
+    bool _pendingFrame{false};
+    bool _pendingFrameReported{false};
+    bool _preparedFrame{false};
+    bool _streaming{false};
+    size_t _transmitExtent{0};
+    bool _truncatedTransmission{false};
+    PixelRange _latchOverwrite{};
+    uint32_t _framesSent{0};
+    lw::detail::PendingShowCompletion _completion;
+    lw::detail::PendingShowCompletion _heldCompletion;
+    FrameTiming* _frameTiming{nullptr};
+};
+
+} // namespace detail
+
+template <typename TProtocol, typename TTransport = PlatformDefaultTransport,
+          typename TShader = NilShader<typename detail::ResolveProtocolType<TProtocol>::Type::ColorType>>
+class PixelBus
+    : public detail::PixelBusPipeline<
+          TProtocol, TTransport, TShader,
+          DynamicBusStorage<typename detail::ResolveProtocolType<TProtocol>::Type::ColorType>>
+{
+    using Base = detail::PixelBusPipeline<
+        TProtocol, TTransport, TShader,
+        DynamicBusStorage<typename detail::ResolveProtocolType<TProtocol>::Type::ColorType>>;
+    using Setup = typename Base::Setup;
+
+  public:
+    using typename Base::ColorType;
+    using typename Base::ProtocolSettingsType;
+    using typename Base::ProtocolType;
+    using typename Base::ShaderType;
+    using typename Base::TransportSettingsType;
+
+    PixelBus(size_t pixelCount, ProtocolSettingsType protocolSettings, TransportSettingsType transportSettings,
+             ShaderType shaderInstance)
+        : Base(pixelCount, std::move(protocolSettings), std::move(transportSettings), std::move(shaderInstance))
+    {
+        this->bindOwnedBuffers();
+    }
+
+    // Runs on caller-owned storage instead of allocating it; size it with
+    // bufferRequirements(). Supplied contents are used as-is. Undersized buffers leave
+    // the bus with no pixels; see hasValidBuffers().
+    PixelBus(size_t pixelCount, ProtocolSettingsType protocolSettings, TransportSettingsType transportSettings,
+             ShaderType shaderInstance, BusBuffers<ColorType> buffers)
+        : Base(pixelCount, std::move(protocolSettings), std::move(transportSettings), std::move(shaderInstance))
+    {
+        this->bindSuppliedBuffers(buffers);
+    }
+
+    PixelBus(size_t pixelCount, ProtocolSettingsType protocolSettings, transports::OneWireTiming timing,
+             TransportSettingsType transportSettings, ShaderType shaderInstance)
+        : PixelBus(pixelCount, Setup::assignProtocolTimingIfPresent(std::move(protocolSettings), timing),
+                   std::move(transportSettings), std::move(shaderInstance))
+    {
+    }
+
+    template <typename TShaderAlias = ShaderType,
+              typename = std::enable_if_t<std::is_same<lw::remove_cvref_t<TShaderAlias>, NilShader<ColorType>>::value>>
+    PixelBus(size_t pixelCount, ProtocolSettingsType protocolSettings, TransportSettingsType transportSettings)
+        : PixelBus(pixelCount, std::move(protocolSettings), std::move(transportSettings), ShaderType{})
+    {
+    }
+
+    template <typename TShaderAlias = ShaderType,
+              typename = std::enable_if_t<std::is_same<lw::remove_cvref_t<TShaderAlias>, NilShader<ColorType>>::value>>
+    PixelBus(size_t pixelCount, ProtocolSettingsType protocolSettings, TransportSettingsType transportSettings,
+             BusBuffers<ColorType> buffers)
+        : PixelBus(pixelCount, std::move(protocolSettings), std::move(transportSettings), ShaderType{}, buffers)
+    {
+    }
+
+    template <typename TShaderAlias = ShaderType,
+              typename = std::enable_if_t<std::is_same<lw::remove_cvref_t<TShaderAlias>, NilShader<ColorType>>::value>>
+    PixelBus(size_t pixelCount, ProtocolSettingsType protocolSettings, transports::OneWireTiming timing,
+             TransportSettingsType transportSettings)
+        : PixelBus(pixelCount, Setup::assignProtocolTimingIfPresent(std::move(protocolSettings), timing),
+                   std::move(transportSettings))
+    {
+    }
+
+    template <typename TShaderAlias = ShaderType,
+              typename = std::enable_if_t<std::is_same<lw::remove_cvref_t<TShaderAlias>, NilShader<ColorType>>::value &&
+                                          std::is_default_constructible<ProtocolSettingsType>::value>>
+    PixelBus(size_t pixelCount, TransportSettingsType transportSettings)
+        : PixelBus(pixelCount, Setup::defaultProtocolSettings(), std::move(transportSettings))
+    {
+    }
+
+    template <
+        typename TShaderAlias = ShaderType,
+        typename = std::enable_if_t<!std::is_same<lw::remove_cvref_t<TShaderAlias>, NilShader<ColorType>>::value &&
+                                    std::is_default_constructible<ProtocolSettingsType>::value>>
+    PixelBus(size_t pixelCount, TransportSettingsType transportSettings, ShaderType shaderInstance)
+        : PixelBus(pixelCount, Setup::defaultProtocolSettings(), std::move(transportSettings),
+                   std::move(shaderInstance))
+    {
+    }
+
+    // Buffer sizes a bus built from the same arguments needs, so callers can size
+    // external storage, or one BufferArena for many buses, before constructing.
+    static constexpr BusBufferRequirements bufferRequirements(size_t pixelCount, ProtocolSettingsType protocolSettings)
+    {
+        const size_t normalizedCount = Setup::normalizePixelCount(pixelCount);
+        return BusBufferRequirements{
+            normalizedCount, Base::UsesShaderScratch ? normalizedCount : 0,
+            ProtocolType::requiredBufferSize(static_cast<PixelCount>(normalizedCount),
+                                             Setup::normalizeProtocolSettings(std::move(protocolSettings)))};
+    }
+
+    template <typename TSettings = ProtocolSettingsType,
+              typename = std::enable_if_t<std::is_default_constructible<TSettings>::value>>
+    static constexpr BusBufferRequirements bufferRequirements(size_t pixelCount)
+    {
+        return bufferRequirements(pixelCount, Setup::defaultProtocolSettings());
+    }
+
+    void shareBuffers(BusBufferPool<ColorType>& pool) override { this->borrowBuffers(pool); }
+
+    using Base::hasPendingFrame;
+    using Base::hasValidBuffers;
+    using Base::isDoubleBuffered;
+    using Base::isStreaming;
+    using Base::pixelCount;
+    using Base::setDoubleBuffered;
+    using Base::setStreaming;
 };
 
 #endif
@@ -6,6 +6,8 @@
 #include <cstdint>
 #include <memory>
 
+#include "buses/BusBuffers.h"
+#include "buses/FrameTiming.h"
 #include "colors/IShader.h"
 #include "core/IPixelBus.h"
 #include "protocols/IProtocol.h"
@@ -19,14 +21,50 @@ template <typename TColor> class ReferenceBus : public IPixelBus<TColor>
   public:
     ReferenceBus(PixelCount pixelCount, std::unique_ptr<protocols::IProtocol<TColor>> protocol,
                  std::unique_ptr<transports::ITransport> transport, std::unique_ptr<IShader<TColor>> shader = nullptr)
-        : _pixelCount(pixelCount), _rootBuffer(allocateColorBuffer(_pixelCount)), _protocol(std::move(protocol)),
-          _protocolBuffer(allocateByteBuffer(protocolBufferSize(_protocol))), _transport(std::move(transport)),
-          _shader(std::move(shader)), _shaderBuffer(allocateColorBuffer(_pixelCount)),
-          _pixelViewChunks{makePixelChunk(_rootBuffer.get(), _pixelCount)},
+        : _pixelCount(pixelCount), _ownedRootBuffer(allocateColorBuffer(_pixelCount)), _protocol(std::move(protocol)),
+          _ownedProtocolBuffer(allocateByteBuffer(protocolBufferSize(_protocol))), _transport(std::move(transport)),
+          _shader(std::move(shader)), _ownedShaderBuffer(allocateColorBuffer(_pixelCount)),
+          _rootBuffer(_ownedRootBuffer.get()), _protocolBuffer(_ownedProtocolBuffer.get()),
+          _shaderBuffer(_ownedShaderBuffer.get()), _pixelViewChunks{makePixelChunk(_rootBuffer, _pixelCount)},
           _pixels(span<span<TColor>>{_pixelViewChunks.data(), _pixelViewChunks.size()})
     {
     }
 
+    // Runs on caller-owned storage sized with bufferRequirements(); supplied contents
+    // are used as-is. Undersized buffers leave the bus with no pixels; see
+    // hasValidBuffers().
+    ReferenceBus(PixelCount pixelCount, std::unique_ptr<protocols::IProtocol<TColor>> protocol,
+                 std::unique_ptr<transports::ITransport> transport, BusBuffers<TColor> buffers,
+                 std::unique_ptr<IShader<TColor>> shader = nullptr)
+        : _pixelCount(pixelCount), _protocol(std::move(protocol)), _transport(std::move(transport)),
+          _shader(std::move(shader)),
+          _pixels(span<span<TColor>>{_pixelViewChunks.data(), _pixelViewChunks.size()})
+    {
+        const BusBufferRequirements required{_pixelCount, _shader ? _pixelCount : 0u, protocolBufferSize(_protocol)};
+        _buffersValid = buffers.satisfies(required);
+        if (!_buffersValid)
+        {
+            _pixelCount = 0;
+            return;
+        }
+
+        _rootBuffer = (required.rootPixels != 0) ? buffers.rootPixels.data() : nullptr;
+        _shaderBuffer = (required.shaderScratch != 0) ? buffers.shaderScratch.data() : nullptr;
+        _protocolBuffer = (required.protocolBytes != 0) ? buffers.protocolBuffer.data() : nullptr;
+        _pixelViewChunks[0] = makePixelChunk(_rootBuffer, _pixelCount);
+        _pixels = PixelView<TColor>(span<span<TColor>>{_pixelViewChunks.data(), _pixelViewChunks.size()});
+    }
+
+    // Buffer sizes for a bus over a `TProtocol` built with these arguments.
+    template <typename TProtocol>
+    static constexpr BusBufferRequirements bufferRequirements(PixelCount pixelCount,
+                                                              const typename TProtocol::SettingsType& settings,
+                                                              bool hasShader = false)
+    {
+        return BusBufferRequirements{pixelCount, hasShader ? pixelCount : 0u,
+                                     TProtocol::requiredBufferSize(pixelCount, settings)};
+    }
+
     void begin() override
     {
         if (_transport)
@@ -42,18 +80,20 @@ template <typename TColor> class ReferenceBus : public IPixelBus<TColor>
 
     void show() override
     {
-        if (!_protocol || !_transport)
+        if (!_buffersValid || !_protocol || !_transport)
         {
             return;
         }
 
-        if (!_dirty && !_protocol->alwaysUpdate())
+        if (!_dirty && !_protocol->alwaysUpdate() && !(_shader && _shader->alwaysUpdate()))
         {
+            countShow(ShowStatus::SkippedClean);
             return;
         }
 
         if (!_transport->isReadyToUpdate())
         {
+            countShow(ShowStatus::BusyDropped);
             return;
         }
 
@@ -62,20 +102,22 @@ template <typename TColor> class ReferenceBus : public IPixelBus<TColor>
         {
             if (_shader && _shaderBuffer)
             {
-                std::copy_n(_rootBuffer.get(), _pixelCount, _shaderBuffer.get());
-                span<TColor> shaderSpan{_shaderBuffer.get(), _pixelCount};
+                FrameStageTimer timer{_frameTiming, FrameStage::Shade};
+                std::copy_n(_rootBuffer, _pixelCount, _shaderBuffer);
+                span<TColor> shaderSpan{_shaderBuffer, _pixelCount};
                 _shader->apply(shaderSpan);
                 protocolInput = shaderSpan;
             }
             else if (_shader)
             {
-                span<TColor> rootSpan{_rootBuffer.get(), _pixelCount};
+                FrameStageTimer timer{_frameTiming, FrameStage::Shade};
+                span<TColor> rootSpan{_rootBuffer, _pixelCount};
                 _shader->apply(rootSpan);
                 protocolInput = rootSpan;
             }
             else
             {
-                protocolInput = span<const TColor>{_rootBuffer.get(), _pixelCount};
+                protocolInput = span<const TColor>{_rootBuffer, _pixelCount};
             }
         }
 
@@ -83,21 +125,28 @@ template <typename TColor> class ReferenceBus : public IPixelBus<TColor>
         const size_t requiredSize = _protocol->requiredBufferSizeBytes();
         if (_protocolBuffer && requiredSize > 0)
         {
-            protocolBytes = span<uint8_t>{_protocolBuffer.get(), requiredSize};
+            protocolBytes = span<uint8_t>{_protocolBuffer, requiredSize};
         }
 
-        _protocol->update(protocolInput, protocolBytes);
+        {
+            FrameStageTimer timer{_frameTiming, FrameStage::Serialize};
+            _protocol->update(protocolInput, protocolBytes);
+        }
 
         if (!protocolBytes.empty())
         {
+            FrameStageTimer timer{_frameTiming, FrameStage::Transmit};
             _transport->beginTransaction();
             _transport->transmitBytes(protocolBytes);
             _transport->endTransaction();
         }
 
         _dirty = false;
+        countShow(ShowStatus::Queued);
     }
 
+    void setFrameTiming(FrameTiming* timing) override { _frameTiming = timing; }
+
     bool isReadyToUpdate() const override
     {
         if (!_transport)
@@ -118,17 +167,20 @@ template <typename TColor> class ReferenceBus : public IPixelBus<TColor>
 
     PixelCount pixelCount() const { return _pixelCount; }
 
-    TColor* rootBuffer() { return _rootBuffer.get(); }
+    // False when supplied buffers were smaller than bufferRequirements().
+    bool hasValidBuffers() const { return _buffersValid; }
+
+    TColor* rootBuffer() { return _rootBuffer; }
 
-    const TColor* rootBuffer() const { return _rootBuffer.get(); }
+    const TColor* rootBuffer() const { return _rootBuffer; }
 
-    TColor* shaderBuffer() { return _shaderBuffer.get(); }
+    TColor* shaderBuffer() { return _shaderBuffer; }
 
-    const TColor* shaderBuffer() const { return _shaderBuffer.get(); }
+    const TColor* shaderBuffer() const { return _shaderBuffer; }
 
-    uint8_t* protocolBuffer() { return _protocolBuffer.get(); }
+    uint8_t* protocolBuffer() { return _protocolBuffer; }
 
-    const uint8_t* protocolBuffer() const { return _protocolBuffer.get(); }
+    const uint8_t* protocolBuffer() const { return _protocolBuffer; }
 
     protocols::IProtocol<TColor>* protocol() { return _protocol.get(); }
 
@@ -143,6 +195,14 @@ template <typename TColor> class ReferenceBus : public IPixelBus<TColor>
     const IShader<TColor>* shader() const { return _shader.get(); }
 
   private:
+    void countShow(ShowStatus status)
+    {
+        if (FrameTimingEnabled && _frameTiming != nullptr)
+        {
+            _frameTiming->countShow(status);
+        }
+    }
+
     static std::unique_ptr<TColor[]> allocateColorBuffer(PixelCount pixelCount)
     {
         if (pixelCount == 0)
@@ -179,15 +239,20 @@ template <typename TColor> class ReferenceBus : public IPixelBus<TColor>
     }
 
     PixelCount _pixelCount{0};
-    std::unique_ptr<TColor[]> _rootBuffer;
+    std::unique_ptr<TColor[]> _ownedRootBuffer;
     std::unique_ptr<protocols::IProtocol<TColor>> _protocol;
-    std::unique_ptr<uint8_t[]> _protocolBuffer;
+    std::unique_ptr<uint8_t[]> _ownedProtocolBuffer;
     std::unique_ptr<transports::ITransport> _transport;
     std::unique_ptr<IShader<TColor>> _shader;
-    std::unique_ptr<TColor[]> _shaderBuffer;
-    std::array<span<TColor>, 1> _pixelViewChunks;
+    std::unique_ptr<TColor[]> _ownedShaderBuffer;
+    TColor* _rootBuffer{nullptr};
+    uint8_t* _protocolBuffer{nullptr};
+    TColor* _shaderBuffer{nullptr};
+    std::array<span<TColor>, 1> _pixelViewChunks{};
     PixelView<TColor> _pixels;
+    bool _buffersValid{true};
     bool _dirty{true};
+    FrameTiming* _frameTiming{nullptr};
 };
 
 } // namespace lw::busses
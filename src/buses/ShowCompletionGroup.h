@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "core/IPixelBus.h"
+
+namespace lw::busses
+{
+
+// Joins the members' completions for one showAsync() on a set of buses: the caller's
+// completion runs once every member that queued the frame has finished with it.
+class ShowCompletionGroup
+{
+  public:
+    ShowCompletionGroup() = default;
+
+    // Moving is not thread-safe and must not happen while a frame is outstanding.
+    ShowCompletionGroup(ShowCompletionGroup&& other) noexcept
+        : _completion{other._completion}, _outstanding{other._outstanding.load()}
+    {
+    }
+
+    ShowCompletionGroup& operator=(ShowCompletionGroup&& other) noexcept
+    {
+        _completion = other._completion;
+        _outstanding.store(other._outstanding.load());
+        return *this;
+    }
+
+    // `buses` holds raw or owning pointers to IPixelBus and may hold null entries.
+    // Queued when any member queued; members that were busy keep their frame for a
+    // later show. BusyDropped while the previous frame is still outstanding.
+    template <typename TBuses> ShowStatus show(const TBuses& buses, ShowCompletion completion)
+    {
+        if (!begin(buses, completion))
+        {
+            return ShowStatus::BusyDropped;
+        }
+
+        for (const auto& bus : buses)
+        {
+            if (bus != nullptr)
+            {
+                add([&bus](ShowCompletion member) { return bus->showAsync(member); });
+            }
+        }
+
+        return finish();
+    }
+
+    // show() in steps, for callers that show their members some other way: begin(),
+    // then add() once per member, then finish() for the group status. begin() returns
+    // false while the previous frame is still outstanding.
+    template <typename TBuses> bool begin(const TBuses& buses, ShowCompletion completion)
+    {
+        poll(buses);
+        if (_outstanding.load() != 0)
+        {
+            return false;
+        }
+
+        _completion = completion;
+        _queued = false;
+        _busy = false;
+        // Held until finish(), so members that finish right away cannot complete the
+        // group early.
+        _outstanding.store(1);
+        return true;
+    }
+
+    // `showMember` shows one member with the ShowCompletion it is given and returns
+    // that member's ShowStatus.
+    template <typename TShowMember> void add(TShowMember&& showMember)
+    {
+        _outstanding.fetch_add(1);
+        const ShowStatus status = showMember(ShowCompletion{&ShowCompletionGroup::onMemberComplete, this});
+        if (status == ShowStatus::Queued)
+        {
+            _queued = true;
+        }
+        else
+        {
+            _outstanding.fetch_sub(1);
+            _busy = _busy || (status == ShowStatus::BusyDropped);
+        }
+    }
+
+    ShowStatus finish()
+    {
+        if (!_queued)
+        {
+            _outstanding.store(0);
+            return _busy ? ShowStatus::BusyDropped : ShowStatus::SkippedClean;
+        }
+
+        memberComplete();
+        return ShowStatus::Queued;
+    }
+
+    template <typename TBuses> bool poll(const TBuses& buses)
+    {
+        bool completed = false;
+        for (const auto& bus : buses)
+        {
+            if (bus != nullptr && bus->pollCompletion())
+            {
+                completed = true;
+            }
+        }
+
+        return completed;
+    }
+
+    bool isOutstanding() const { return _outstanding.load() != 0; }
+
+  private:
+    static void onMemberComplete(void* context) { static_cast<ShowCompletionGroup*>(context)->memberComplete(); }
+
+    void memberComplete()
+    {
+        if (_outstanding.fetch_sub(1) == 1 && _completion.callback != nullptr)
+        {
+            _completion.callback(_completion.context);
+        }
+    }
+
+    ShowCompletion _completion{};
+    std::atomic<size_t> _outstanding{0};
+    bool _queued{false};
+    bool _busy{false};
+};
+
+} // namespace lw::busses
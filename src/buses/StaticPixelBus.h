@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "buses/BusBuffers.h"
+#include "buses/PixelBus.h"
+#include "colors/NilShader.h"
+#include "protocols/IProtocol.h"
+
+namespace lw::busses
+{
+
+namespace detail
+{
+
+// Protocol buffer bytes for `NPixelCount` pixels with the protocol spec's default
+// settings, evaluated at compile time.
+template <typename TProtocolSpec, size_t NPixelCount, typename TTransport = PlatformDefaultTransport>
+static constexpr size_t StaticProtocolBufferSize =
+    PixelBusSetup<TProtocolSpec, TTransport>::ProtocolType::requiredBufferSize(
+        static_cast<PixelCount>(NPixelCount),
+        PixelBusSetup<TProtocolSpec, TTransport>::normalizeProtocolSettings(
+            PixelBusSetup<TProtocolSpec, TTransport>::defaultProtocolSettings()));
+
+// Inline storage for a StaticPixelBus; shader scratch only for shaders that cannot
+// fuse into the protocol's encode loop.
+template <typename TProtocolSpec, typename TShader, size_t NPixelCount, size_t NProtocolBufferBytes>
+using StaticBusStorageFor =
+    StaticBusStorage<typename ResolveProtocolType<TProtocolSpec>::Type::ColorType, NPixelCount,
+                     PipelineUsesShaderScratch<TProtocolSpec, TShader> ? NPixelCount : 0, NProtocolBufferBytes>;
+
+} // namespace detail
+
+#if !LW_DISABLE_TEMPLATE_COMBINATORIAL_TYPES
+
+// PixelBus variant whose pixel, shader and protocol buffers are fixed-size members
+// instead of heap vectors, so a bus declared at namespace scope lives entirely in
+// static storage and neither construction nor show() allocates.
+//
+// The protocol buffer holds `NProtocolBufferBytes`, by default the size the protocol
+// spec's default settings need for `NPixelCount` pixels. Settings that need more (for
+// example longer reset multipliers) must pass a larger capacity; otherwise
+// protocolBuffer() is empty and show() transmits nothing.
+//
+// The show pipeline is PixelBus's, so partial re-encode, fused shaders and truncated
+// transmission behave identically. Double buffering and streaming are not offered:
+// both trade memory against latency at runtime, which a statically sized bus has
+// already fixed.
+template <size_t NPixelCount, typename TProtocol, typename TTransport = PlatformDefaultTransport,
+          typename TShader = NilShader<typename detail::ResolveProtocolType<TProtocol>::Type::ColorType>,
+          size_t NProtocolBufferBytes = detail::StaticProtocolBufferSize<TProtocol, NPixelCount, TTransport>>
+class StaticPixelBus
+    : public detail::PixelBusPipeline<
+          TProtocol, TTransport, TShader,
+          detail::StaticBusStorageFor<TProtocol, TShader, NPixelCount, NProtocolBufferBytes>>
+{
+    using Base = detail::PixelBusPipeline<
+        TProtocol, TTransport, TShader,
+        detail::StaticBusStorageFor<TProtocol, TShader, NPixelCount, NProtocolBufferBytes>>;
+    using Setup = typename Base::Setup;
+
+  public:
+    using typename Base::ColorType;
+    using typename Base::ProtocolSettingsType;
+    using typename Base::ProtocolType;
+    using typename Base::ShaderType;
+    using typename Base::TransportSettingsType;
+
+    static_assert(NPixelCount <= static_cast<size_t>(std::numeric_limits<PixelCount>::max()),
+                  "StaticPixelBus pixel count exceeds PixelCount.");
+    static_assert(protocols::ProtocolRequiredBufferSizeComputable<ProtocolType>,
+                  "StaticPixelBus requires a protocol with a static requiredBufferSize().");
+
+    static constexpr size_t PixelCountValue = NPixelCount;
+
+    static constexpr size_t ProtocolBufferCapacity = NProtocolBufferBytes;
+
+    StaticPixelBus(ProtocolSettingsType protocolSettings, TransportSettingsType transportSettings,
+                   ShaderType shaderInstance)
+        : Base(NPixelCount, std::move(protocolSettings), std::move(transportSettings), std::move(shaderInstance))
+    {
+        assert(this->protocol().requiredBufferSizeBytes() <= NProtocolBufferBytes);
+        this->bindOwnedBuffers();
+    }
+
+    template <typename TShaderAlias = ShaderType,
+              typename = std::enable_if_t<std::is_same<lw::remove_cvref_t<TShaderAlias>, NilShader<ColorType>>::value>>
+    StaticPixelBus(ProtocolSettingsType protocolSettings, TransportSettingsType transportSettings)
+        : StaticPixelBus(std::move(protocolSettings), std::move(transportSettings), ShaderType{})
+    {
+    }
+
+    template <typename TShaderAlias = ShaderType,
+              typename = std::enable_if_t<std::is_same<lw::remove_cvref_t<TShaderAlias>, NilShader<ColorType>>::value &&
+                                          std::is_default_constructible<ProtocolSettingsType>::value>>
+    explicit StaticPixelBus(TransportSettingsType transportSettings = TransportSettingsType{})
+        : StaticPixelBus(Setup::defaultProtocolSettings(), std::move(transportSettings))
+    {
+    }
+
+    template <
+        typename TShaderAlias = ShaderType,
+        typename = std::enable_if_t<!std::is_same<lw::remove_cvref_t<TShaderAlias>, NilShader<ColorType>>::value &&
+                                    std::is_default_constructible<ProtocolSettingsType>::value>>
+    StaticPixelBus(TransportSettingsType transportSettings, ShaderType shaderInstance)
+        : StaticPixelBus(Setup::defaultProtocolSettings(), std::move(transportSettings), std::move(shaderInstance))
+    {
+    }
+
+    // The pixel view and protocol refer into this object's own arrays.
+    StaticPixelBus(const StaticPixelBus&) = delete;
+    StaticPixelBus& operator=(const StaticPixelBus&) = delete;
+
+    static constexpr size_t pixelCount() { return NPixelCount; }
+};
+
+#endif
+
+} // namespace lw::busses
@@ -42,6 +42,19 @@ template <typename TColor> class AggregateShader : public IShader<TColor>
         }
     }
 
+    bool alwaysUpdate() const override
+    {
+        for (const auto& shader : _shaders)
+        {
+            if (shader != nullptr && shader->alwaysUpdate())
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
         void addShader(std::unique_ptr<IShader<TColor>> shader)
         {
           _shaders.emplace_back(std::move(shader));
@@ -82,6 +95,8 @@ template <typename TColor, typename... TShaders> class CompositeShader : public
 
     void apply(span<TColor> colors) override { _aggregate.apply(colors); }
 
+    bool alwaysUpdate() const override { return _aggregate.alwaysUpdate(); }
+
   private:
     static typename AggregateShader<TColor>::SettingsType makeAggregateSettings(TShaders... shaders)
     {
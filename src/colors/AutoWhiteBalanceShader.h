@@ -41,45 +41,52 @@ class AutoWhiteBalanceShader : public IShader<TColor>
     {
     }
 
+    static constexpr bool SupportsFusedApply = true;
+
     void apply(span<TColor> colors) override
     {
         for (auto& color : colors)
         {
-            uint16_t warmWeight = 255;
-            uint16_t coolWeight = 0;
+            applyOne(color);
+        }
+    }
 
-            if (_dualWhite)
+    void applyOne(TColor& color) const
+    {
+        uint16_t warmWeight = 255;
+        uint16_t coolWeight = 0;
+
+        if (_dualWhite)
+        {
+            uint16_t warm = color['W'];
+            uint16_t cool = color['C'];
+            uint16_t total = warm + cool;
+
+            if (total > 0)
             {
-                uint16_t warm = color['W'];
-                uint16_t cool = color['C'];
-                uint16_t total = warm + cool;
-
-                if (total > 0)
-                {
-                    warmWeight = static_cast<uint16_t>((warm * 255u) / total);
-                    coolWeight = static_cast<uint16_t>(255u - warmWeight);
-                }
-                else
-                {
-                    warmWeight = 128;
-                    coolWeight = 127;
-                }
+                warmWeight = static_cast<uint16_t>((warm * 255u) / total);
+                coolWeight = static_cast<uint16_t>(255u - warmWeight);
             }
-
-            for (size_t channel = 0; channel < 3; ++channel)
+            else
             {
-                const char channelTag = ChannelOrder::RGB::value[channel];
-                uint16_t correction = _warmCorrection[channel];
+                warmWeight = 128;
+                coolWeight = 127;
+            }
+        }
 
-                if (_dualWhite)
-                {
-                    correction = static_cast<uint16_t>(
-                        (_warmCorrection[channel] * warmWeight + _coolCorrection[channel] * coolWeight + 127u) / 255u);
-                }
+        for (size_t channel = 0; channel < 3; ++channel)
+        {
+            const char channelTag = ChannelOrder::RGB::value[channel];
+            uint16_t correction = _warmCorrection[channel];
 
-                color[channelTag] = static_cast<ComponentType>(
-                    (static_cast<uint64_t>(color[channelTag]) * correction + (MaxCorrection / 2u)) / MaxCorrection);
+            if (_dualWhite)
+            {
+                correction = static_cast<uint16_t>(
+                    (_warmCorrection[channel] * warmWeight + _coolCorrection[channel] * coolWeight + 127u) / 255u);
             }
+
+            color[channelTag] = static_cast<ComponentType>(
+                (static_cast<uint64_t>(color[channelTag]) * correction + (MaxCorrection / 2u)) / MaxCorrection);
         }
     }
 
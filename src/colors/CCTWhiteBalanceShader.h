@@ -48,44 +48,51 @@ class CCTWhiteBalanceShader : public IShader<TColor>
     {
     }
 
+    static constexpr bool SupportsFusedApply = true;
+
     void apply(span<TColor> colors) override
     {
         for (auto& color : colors)
         {
-            const ComponentType brightness = color['C'];
-            const ComponentType balance = color['W'];
+            applyOne(color);
+        }
+    }
 
-            // Interpret incoming C/W as controls: C is white brightness, W is warm/cool balance.
-            const ComponentType warm = scaleByUnit(brightness, inverseUnit(balance));
-            const ComponentType cool = scaleByUnit(brightness, balance);
-            color['W'] = warm;
-            color['C'] = cool;
+    void applyOne(TColor& color) const
+    {
+        const ComponentType brightness = color['C'];
+        const ComponentType balance = color['W'];
+
+        // Interpret incoming C/W as controls: C is white brightness, W is warm/cool balance.
+        const ComponentType warm = scaleByUnit(brightness, inverseUnit(balance));
+        const ComponentType cool = scaleByUnit(brightness, balance);
+        color['W'] = warm;
+        color['C'] = cool;
 
-            switch (_colorInterlock)
+        switch (_colorInterlock)
+        {
+            case CCTColorInterlock::None:
+                break;
+
+            case CCTColorInterlock::ForceOff:
+                color['R'] = static_cast<ComponentType>(0);
+                color['G'] = static_cast<ComponentType>(0);
+                color['B'] = static_cast<ComponentType>(0);
+                break;
+
+            case CCTColorInterlock::ForceOn:
+                color['R'] = MaxComponent;
+                color['G'] = MaxComponent;
+                color['B'] = MaxComponent;
+                break;
+
+            case CCTColorInterlock::MatchWhite:
             {
-                case CCTColorInterlock::None:
-                    break;
-
-                case CCTColorInterlock::ForceOff:
-                    color['R'] = static_cast<ComponentType>(0);
-                    color['G'] = static_cast<ComponentType>(0);
-                    color['B'] = static_cast<ComponentType>(0);
-                    break;
-
-                case CCTColorInterlock::ForceOn:
-                    color['R'] = MaxComponent;
-                    color['G'] = MaxComponent;
-                    color['B'] = MaxComponent;
-                    break;
-
-                case CCTColorInterlock::MatchWhite:
-                {
-                    const auto rgbApproximation = kelvinToRgb(lerpKelvin(balance));
-                    color['R'] = scaleByUnit(rgbApproximation[0], brightness);
-                    color['G'] = scaleByUnit(rgbApproximation[1], brightness);
-                    color['B'] = scaleByUnit(rgbApproximation[2], brightness);
-                    break;
-                }
+                const auto rgbApproximation = kelvinToRgb(lerpKelvin(balance));
+                color['R'] = scaleByUnit(rgbApproximation[0], brightness);
+                color['G'] = scaleByUnit(rgbApproximation[1], brightness);
+                color['B'] = scaleByUnit(rgbApproximation[2], brightness);
+                break;
             }
         }
     }
@@ -37,8 +37,8 @@ DECLARE_CHANNEL_ORDER(BGRCW);
 namespace detail
 {
 
-inline const char* normalizeChannelOrderForCount(const char* providedChannelOrder, const char* defaultChannelOrder,
-                                                 size_t channelCount)
+constexpr const char* normalizeChannelOrderForCount(const char* providedChannelOrder, const char* defaultChannelOrder,
+                                                    size_t channelCount)
 {
     const char* channelOrder = (providedChannelOrder != nullptr) ? providedChannelOrder : defaultChannelOrder;
     if (channelOrder == nullptr)
@@ -15,7 +15,7 @@ namespace lw::colors
 {
 
 // -----------------------------------------------------------------------
-// ColorIteratorT ? wraps a std::function<TColor&(uint16_t)> + position
+// ColorIteratorT ? wraps a std::function<TColor&(PixelCount)> + position
 //
 // Satisfies std::random_access_iterator.  The accessor returns a mutable
 // TColor& so the same iterator type works for both reading (input) and
@@ -37,13 +37,13 @@ namespace lw::colors
 //
 //   // Ad-hoc lambda:
 //   std::vector<Color> buf(100);
-//   ColorIterator begin{[&](uint16_t i) -> Color& { return buf[i]; }, 0};
-//   ColorIterator end  {[&](uint16_t i) -> Color& { return buf[i]; }, 100};
+//   ColorIterator begin{[&](PixelCount i) -> Color& { return buf[i]; }, 0};
+//   ColorIterator end  {[&](PixelCount i) -> Color& { return buf[i]; }, 100};
 // -----------------------------------------------------------------------
 template <typename TColor> class ColorIteratorT
 {
   public:
-    using AccessorFn = std::function<TColor&(uint16_t idx)>;
+    using AccessorFn = std::function<TColor&(PixelCount idx)>;
 
     using iterator_category = std::random_access_iterator_tag;
     using value_type = TColor;
@@ -57,7 +57,7 @@ template <typename TColor> class ColorIteratorT
     // Default-constructed iterators compare equal (past-the-end)
     ColorIteratorT() = default;
 
-    ColorIteratorT(AccessorFn accessor, uint16_t position) : _accessor(std::move(accessor)), _position(position) {}
+    ColorIteratorT(AccessorFn accessor, PixelCount position) : _accessor(std::move(accessor)), _position(position) {}
 
     // Copyable / movable
     ColorIteratorT(const ColorIteratorT&) = default;
@@ -69,7 +69,7 @@ template <typename TColor> class ColorIteratorT
 
     TColor& operator*() const { return _accessor(_position); }
 
-    TColor& operator[](difference_type n) const { return _accessor(static_cast<uint16_t>(_position + n)); }
+    TColor& operator[](difference_type n) const { return _accessor(static_cast<PixelCount>(_position + n)); }
 
     // -- Increment / decrement -----------------------------------------
 
@@ -103,13 +103,13 @@ template <typename TColor> class ColorIteratorT
 
     ColorIteratorT& operator+=(difference_type n)
     {
-        _position = static_cast<uint16_t>(_position + n);
+        _position = static_cast<PixelCount>(_position + n);
         return *this;
     }
 
     ColorIteratorT& operator-=(difference_type n)
     {
-        _position = static_cast<uint16_t>(_position - n);
+        _position = static_cast<PixelCount>(_position - n);
         return *this;
     }
 
@@ -158,11 +158,11 @@ template <typename TColor> class ColorIteratorT
 
     // -- Observers -----------------------------------------------------
 
-    uint16_t position() const { return _position; }
+    PixelCount position() const { return _position; }
 
   private:
     AccessorFn _accessor;
-    uint16_t _position{0};
+    PixelCount _position{0};
 };
 
 // -----------------------------------------------------------------------
@@ -180,12 +180,12 @@ template <typename TColor> struct SolidColorSourceT
 
     ColorIteratorT<TColor> begin()
     {
-        return ColorIteratorT<TColor>{[this](uint16_t) -> TColor& { return color; }, 0};
+        return ColorIteratorT<TColor>{[this](PixelCount) -> TColor& { return color; }, 0};
     }
 
     ColorIteratorT<TColor> end()
     {
-        return ColorIteratorT<TColor>{[this](uint16_t) -> TColor& { return color; }, pixelCount};
+        return ColorIteratorT<TColor>{[this](PixelCount) -> TColor& { return color; }, pixelCount};
     }
 };
 
@@ -212,13 +212,13 @@ template <typename TColor> struct SpanColorSourceT
     SpanColorSourceT(TColor* ptr, size_t size) : data(ptr, size) {}
     ColorIteratorT<TColor> begin()
     {
-        return ColorIteratorT<TColor>{[this](uint16_t idx) -> TColor& { return data[idx]; }, 0};
+        return ColorIteratorT<TColor>{[this](PixelCount idx) -> TColor& { return data[idx]; }, 0};
     }
 
     ColorIteratorT<TColor> end()
     {
-        return ColorIteratorT<TColor>{[this](uint16_t idx) -> TColor& { return data[idx]; },
-                                      static_cast<uint16_t>(data.size())};
+        return ColorIteratorT<TColor>{[this](PixelCount idx) -> TColor& { return data[idx]; },
+                                      static_cast<PixelCount>(data.size())};
     }
 };
 
@@ -106,7 +106,7 @@ template <typename TColor> struct ScalarColorMathBackend
     {
         using SignedWide = std::conditional_t<(sizeof(ComponentType) <= 2), int32_t, int64_t>;
 
-        TColor blended;
+        TColor blended{};
         for (auto channel : TColor::channelIndexes())
         {
             const SignedWide delta = static_cast<SignedWide>(right[channel]) - static_cast<SignedWide>(left[channel]);
@@ -121,7 +121,7 @@ template <typename TColor> struct ScalarColorMathBackend
     {
         using UnsignedWide = std::conditional_t<(sizeof(ComponentType) <= 2), uint32_t, uint64_t>;
 
-        TColor blended;
+        TColor blended{};
         for (auto channel : TColor::channelIndexes())
         {
             const UnsignedWide leftValue = static_cast<UnsignedWide>(left[channel]);
@@ -146,7 +146,7 @@ template <typename TColor> struct ScalarColorMathBackend
         const float v01 = (1.0f - x) * y;
         const float v11 = x * y;
 
-        TColor blended;
+        TColor blended{};
         for (auto channel : TColor::channelIndexes())
         {
             const float value = static_cast<float>(c00[channel]) * v00 + static_cast<float>(c10[channel]) * v10 +
@@ -16,6 +16,7 @@
 #include "colors/HueBlend.h"
 #include "colors/IShader.h"
 #include "colors/NilShader.h"
+#include "colors/TemporalDitherShader.h"
 #include "colors/palette/Palette.h"
 #include "colors/AutoWhiteBalanceShader.h"
 #include "colors/CCTWhiteBalanceShader.h"
@@ -40,8 +40,27 @@ template <typename TColor> class CurrentLimiterShader : public IShader<TColor>
     {
     }
 
+    static constexpr bool SupportsFusedApply = true;
+
     void apply(span<TColor> colors) override
     {
+        prepare(colors);
+        if (!_scaling)
+        {
+            return;
+        }
+
+        for (auto& color : colors)
+        {
+            applyOne(color);
+        }
+    }
+
+    // Statistics pass: estimates the frame's draw and picks the scale applied by
+    // applyOne(), which leaves pixels untouched while the frame is within budget.
+    void prepare(span<const TColor> colors)
+    {
+        _scaling = false;
         if (_maxMilliamps == 0)
         {
             _lastEstimatedMilliamps = 0;
@@ -63,7 +82,7 @@ template <typename TColor> class CurrentLimiterShader : public IShader<TColor>
 
         if (_maxMilliamps <= _controllerMilliamps)
         {
-            scaleAll(colors, 0);
+            setScale(0);
             _lastEstimatedMilliamps = _controllerMilliamps + static_cast<uint32_t>(_standbyMilliampsPerPixel) *
                                                                  static_cast<uint32_t>(colors.size());
             return;
@@ -96,12 +115,27 @@ template <typename TColor> class CurrentLimiterShader : public IShader<TColor>
             }
         }
 
-        scaleAll(colors, scale);
+        setScale(scale);
 
         const uint64_t limitedPixelMilliamps = (pixelMilliamps * scale) / 255ULL;
         _lastEstimatedMilliamps = static_cast<uint32_t>(limitedPixelMilliamps + _controllerMilliamps + standbyDraw);
     }
 
+    void applyOne(TColor& color) const
+    {
+        if (!_scaling)
+        {
+            return;
+        }
+
+        for (auto channel : TColor::channelIndexes())
+        {
+            auto& component = color[channel];
+            const uint64_t scaled = (static_cast<uint64_t>(component) * _scale + 127ULL) / 255ULL;
+            component = static_cast<typename TColor::ComponentType>(scaled);
+        }
+    }
+
     uint32_t lastEstimatedMilliamps() const { return _lastEstimatedMilliamps; }
 
   private:
@@ -127,17 +161,10 @@ template <typename TColor> class CurrentLimiterShader : public IShader<TColor>
         return totalDrawWeighted;
     }
 
-    static void scaleAll(span<TColor> colors, uint32_t scale)
+    void setScale(uint32_t scale)
     {
-        for (auto& color : colors)
-        {
-            for (auto channel : TColor::channelIndexes())
-            {
-                auto& component = color[channel];
-                const uint64_t scaled = (static_cast<uint64_t>(component) * scale + 127ULL) / 255ULL;
-                component = static_cast<typename TColor::ComponentType>(scaled);
-            }
-        }
+        _scale = scale;
+        _scaling = true;
     }
 
     uint32_t _maxMilliamps;
@@ -146,6 +173,8 @@ template <typename TColor> class CurrentLimiterShader : public IShader<TColor>
     bool _rgbwDerating;
     typename SettingsType::ChannelMilliampsMap _milliampsPerChannel;
     uint32_t _lastEstimatedMilliamps{0};
+    uint32_t _scale{255};
+    bool _scaling{false};
 };
 
 } // namespace lw::shaders
@@ -36,6 +36,8 @@ class GammaShader : public IShader<TColor>
         recalculateTables();
     }
 
+    static constexpr bool SupportsFusedApply = true;
+
     void apply(span<TColor> colors) override
     {
         if (!gammaCorrectCol)
@@ -45,18 +47,28 @@ class GammaShader : public IShader<TColor>
 
         for (auto& color : colors)
         {
-            const size_t maxChannels = (TColor::ChannelCount < 4) ? TColor::ChannelCount : 4;
-            size_t channelIndex = 0;
-            for (auto channel : TColor::channelIndexes())
-            {
-                if (channelIndex >= maxChannels)
-                {
-                    break;
-                }
+            applyOne(color);
+        }
+    }
 
-                color[channel] = gamma8(color[channel]);
-                ++channelIndex;
+    void applyOne(TColor& color) const
+    {
+        if (!gammaCorrectCol)
+        {
+            return;
+        }
+
+        const size_t maxChannels = (TColor::ChannelCount < 4) ? TColor::ChannelCount : 4;
+        size_t channelIndex = 0;
+        for (auto channel : TColor::channelIndexes())
+        {
+            if (channelIndex >= maxChannels)
+            {
+                break;
             }
+
+            color[channel] = gamma8(color[channel]);
+            ++channelIndex;
         }
     }
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 
 #include "Color.h"
 
@@ -13,8 +15,52 @@ template <typename TColor> class IShader
     virtual ~IShader() = default;
 
     virtual void apply(span<TColor> /*colors*/) = 0;
+
+    // Shaders whose output changes from frame to frame for the same input, such as
+    // temporal dithering, return true so buses keep sending frames while no pixel
+    // changes.
+    virtual bool alwaysUpdate() const { return false; }
+};
+
+// Shaders that can run inside a protocol's serialize loop set `SupportsFusedApply` and
+// provide `applyOne(TColor&)`, which shades one pixel in place. A shader whose result
+// also depends on the whole frame (e.g. a power budget) additionally provides
+// `prepare(span<const TColor>)`; it is called once per frame over the unshaded pixels
+// before any `applyOne`. For such shaders `apply(colors)` must equal `prepare(colors)`
+// followed by `applyOne` on every pixel.
+template <typename TShader, typename = void> struct ShaderSupportsFusedApplyImpl : std::false_type
+{
+};
+
+template <typename TShader>
+struct ShaderSupportsFusedApplyImpl<
+    TShader, std::void_t<decltype(TShader::SupportsFusedApply),
+                         decltype(std::declval<TShader&>().applyOne(std::declval<typename TShader::ColorType&>()))>>
+    : std::integral_constant<bool, static_cast<bool>(TShader::SupportsFusedApply)>
+{
+};
+
+template <typename TShader>
+static constexpr bool ShaderSupportsFusedApply = ShaderSupportsFusedApplyImpl<TShader>::value;
+
+template <typename TShader, typename = void> struct ShaderHasFramePassImpl : std::false_type
+{
+};
+
+template <typename TShader>
+struct ShaderHasFramePassImpl<TShader, std::void_t<decltype(std::declval<TShader&>().prepare(
+                                           std::declval<span<const typename TShader::ColorType>>()))>>
+    : std::true_type
+{
 };
 
+template <typename TShader> static constexpr bool ShaderHasFramePass = ShaderHasFramePassImpl<TShader>::value;
+
+// Each output pixel depends only on the same input pixel, so unchanged pixels shade to
+// unchanged values and modified ranges can be re-shaded on their own.
+template <typename TShader>
+static constexpr bool ShaderIsPointwise = ShaderSupportsFusedApply<TShader> && !ShaderHasFramePass<TShader>;
+
 } // namespace lw::shaders
 
 namespace lw
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Color.h"
+#include "IShader.h"
+
+namespace lw::shaders
+{
+
+// Spreads the low byte of 16-bit components across successive frames for strips that
+// only take 8 bits per channel.
+//
+// Protocols quantize 16-bit components to 8 bits by keeping the high byte. This shader
+// keeps a one-byte error accumulator per channel; each frame adds the low byte to it and
+// rounds the high byte up on carry, so over any 256 consecutive frames the 8-bit output
+// averages to exactly `value / 256`. Output components carry the chosen 8-bit level in
+// their high byte with a zero low byte; levels saturate at 0xFF.
+//
+// The accumulator is sized once, for `pixelCount` pixels at construction or over
+// caller storage of `errorBytes(pixelCount)` bytes, so apply() never allocates. Pixels
+// beyond it are truncated to their high byte. The output moves from frame to frame, so
+// alwaysUpdate() keeps buses sending frames while the pixels stay the same.
+template <typename TColor, typename = std::enable_if_t<ColorComponentTypeIs<TColor, uint16_t>>>
+class TemporalDitherShader : public IShader<TColor>
+{
+  public:
+    using ColorType = TColor;
+
+    static constexpr size_t errorBytes(size_t pixelCount) { return pixelCount * TColor::ChannelCount; }
+
+    explicit TemporalDitherShader(size_t pixelCount) : _ownedError(errorBytes(pixelCount), 0) {}
+
+    // `errorStorage` must outlive the shader; it is zeroed here.
+    explicit TemporalDitherShader(span<uint8_t> errorStorage) : _suppliedError{errorStorage} { reset(); }
+
+    void apply(span<TColor> colors) override
+    {
+        const span<uint8_t> errors = errorStore();
+        const size_t ditheredPixels = std::min(colors.size(), errors.size() / TColor::ChannelCount);
+
+        uint8_t* error = errors.data();
+        for (size_t pixel = 0; pixel < colors.size(); ++pixel)
+        {
+            for (size_t channel = 0; channel < TColor::ChannelCount; ++channel)
+            {
+                uint16_t& component = colors[pixel].channelAtIndex(channel);
+                component = (pixel < ditheredPixels) ? ditherComponent(component, *error++)
+                                                     : static_cast<uint16_t>(component & 0xFF00u);
+            }
+        }
+    }
+
+    bool alwaysUpdate() const override { return true; }
+
+    // Restarts the error sequence, e.g. after a scene cut.
+    void reset()
+    {
+        for (auto& error : errorStore())
+        {
+            error = 0;
+        }
+    }
+
+    static uint16_t ditherComponent(uint16_t value, uint8_t& error)
+    {
+        const uint16_t sum = static_cast<uint16_t>(error + (value & 0x00FFu));
+        error = static_cast<uint8_t>(sum);
+
+        uint16_t level = static_cast<uint16_t>(value >> 8);
+        if ((sum > 0xFFu) && (level < 0xFFu))
+        {
+            ++level;
+        }
+
+        return static_cast<uint16_t>(level << 8);
+    }
+
+  private:
+    std::vector<uint8_t> _ownedError;
+    span<uint8_t> _suppliedError;
+
+    span<uint8_t> errorStore()
+    {
+        return _suppliedError.empty() ? span<uint8_t>{_ownedError.data(), _ownedError.size()} : _suppliedError;
+    }
+};
+
+} // namespace lw::shaders
+
+namespace lw
+{
+
+template <typename TColor> using TemporalDitherShader = shaders::TemporalDitherShader<TColor>;
+
+} // namespace lw
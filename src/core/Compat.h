@@ -66,6 +66,70 @@
 #define LW_COLOR_MATH_BACKEND lw::colors::detail::ScalarColorMathBackend
 #endif
 
+#ifndef LW_ONE_WIRE_ENCODING_BACKEND
+#if defined(ARDUINO_ARCH_ESP8266)
+#define LW_ONE_WIRE_ENCODING_BACKEND lw::transports::detail::SwarOneWireEncodingBackend
+#else
+#define LW_ONE_WIRE_ENCODING_BACKEND lw::transports::detail::TableOneWireEncodingBackend
+#endif
+#endif
+
+#ifndef LW_STREAM_CHUNK_BYTES
+#define LW_STREAM_CHUNK_BYTES 1024
+#endif
+
+#ifndef LW_STREAM_CHUNK_COUNT
+#define LW_STREAM_CHUNK_COUNT 2
+#endif
+
+#ifndef LW_FUSED_SHADE_BLOCK_PIXELS
+#define LW_FUSED_SHADE_BLOCK_PIXELS 16
+#endif
+
+// Chunks a PixelView slice or concatenation holds without allocating.
+#ifndef LW_PIXEL_VIEW_INLINE_CHUNKS
+#define LW_PIXEL_VIEW_INLINE_CHUNKS 4
+#endif
+
+// Pixels per batch handed to a fillPixelBatches() generator (see core/PixelViewExecution.h).
+#ifndef LW_PIXEL_BATCH_PIXELS
+#define LW_PIXEL_BATCH_PIXELS 256
+#endif
+
+#ifndef LW_PIXEL_COUNT_16BIT
+#define LW_PIXEL_COUNT_16BIT 0
+#endif
+
+// Per-stage frame timing (see buses/FrameTiming.h); 0 compiles the bus hooks out.
+#ifndef LW_FRAME_TIMING
+#define LW_FRAME_TIMING 1
+#endif
+
+#ifndef LW_FRAME_TIMING_WINDOW
+#define LW_FRAME_TIMING_WINDOW 128
+#endif
+
+// Executors that run bus work on other cores (see core/Executor.h).
+#ifndef LW_HAS_THREAD_EXECUTOR
+#if !defined(ARDUINO) && defined(__has_include)
+#if __has_include(<thread>)
+#define LW_HAS_THREAD_EXECUTOR 1
+#else
+#define LW_HAS_THREAD_EXECUTOR 0
+#endif
+#else
+#define LW_HAS_THREAD_EXECUTOR 0
+#endif
+#endif
+
+#ifndef LW_HAS_FREERTOS_EXECUTOR
+#if defined(ARDUINO_ARCH_ESP32)
+#define LW_HAS_FREERTOS_EXECUTOR 1
+#else
+#define LW_HAS_FREERTOS_EXECUTOR 0
+#endif
+#endif
+
 #ifndef LW_DISABLE_TEMPLATE_COMBINATORIAL_TYPES
 #define LW_DISABLE_TEMPLATE_COMBINATORIAL_TYPES 0
 #endif
@@ -95,7 +159,13 @@
 namespace lw
 {
 
+// Pixel counts and pixel indexes. 32-bit by default; `LW_PIXEL_COUNT_16BIT` keeps the
+// narrower type (and its 65,535-pixel ceiling) for small MCUs.
+#if LW_PIXEL_COUNT_16BIT
 using PixelCount = uint16_t;
+#else
+using PixelCount = uint32_t;
+#endif
 
 using ssize_t = std::ptrdiff_t;
 
@@ -3,8 +3,16 @@
 #include "third_party/tcb/span.hpp"
 
 #include "core/Compat.h"
+#include "core/DirtyRangeSet.h"
+#include "core/Executor.h"
+#include "core/FreeRtosTaskExecutor.h"
 #include "core/IndexIterator.h"
 #include "core/IPixelBus.h"
 #include "core/PixelView.h"
+#include "core/PixelViewAdaptors.h"
+#include "core/PixelViewAlgorithms.h"
+#include "core/PixelViewExecution.h"
+#include "core/ShowCompletion.h"
+#include "core/ThreadPoolExecutor.h"
 #include "core/Topology.h"
 #include "core/Writable.h"
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace lw
+{
+
+// Half-open pixel index range [first, end).
+struct PixelRange
+{
+    size_t first{0};
+    size_t end{0};
+
+    constexpr size_t count() const { return (end > first) ? (end - first) : 0; }
+};
+
+// Small fixed-capacity interval set of modified pixel ranges.
+//
+// Ranges are kept sorted and disjoint; overlapping or touching ranges coalesce. When
+// a new range would exceed `NMaxRanges`, the two neighbours separated by the smallest
+// gap are merged, so the set over-approximates but never loses a modified index.
+template <size_t NMaxRanges = 4> class DirtyRangeSet
+{
+  public:
+    static_assert(NMaxRanges > 0, "DirtyRangeSet requires at least one range.");
+
+    static constexpr size_t Capacity = NMaxRanges;
+
+    void add(size_t first, size_t end)
+    {
+        if (end <= first)
+        {
+            return;
+        }
+
+        size_t insertAt = 0;
+        while (insertAt < _count && _ranges[insertAt].end < first)
+        {
+            ++insertAt;
+        }
+
+        // Absorb every range that overlaps or touches [first, end).
+        size_t absorbEnd = insertAt;
+        while (absorbEnd < _count && _ranges[absorbEnd].first <= end)
+        {
+            first = (_ranges[absorbEnd].first < first) ? _ranges[absorbEnd].first : first;
+            end = (_ranges[absorbEnd].end > end) ? _ranges[absorbEnd].end : end;
+            ++absorbEnd;
+        }
+
+        const size_t absorbed = absorbEnd - insertAt;
+        if (absorbed == 0 && _count == NMaxRanges)
+        {
+            insertMergingClosest(insertAt, PixelRange{first, end});
+            return;
+        }
+
+        if (absorbed == 0)
+        {
+            for (size_t index = _count; index > insertAt; --index)
+            {
+                _ranges[index] = _ranges[index - 1];
+            }
+            ++_count;
+        }
+        else
+        {
+            for (size_t index = absorbEnd; index < _count; ++index)
+            {
+                _ranges[index - absorbed + 1] = _ranges[index];
+            }
+            _count -= absorbed - 1;
+        }
+
+        _ranges[insertAt] = PixelRange{first, end};
+    }
+
+    void clear() { _count = 0; }
+
+    bool empty() const { return _count == 0; }
+
+    size_t size() const { return _count; }
+
+    const PixelRange& operator[](size_t index) const { return _ranges[index]; }
+
+    const PixelRange* begin() const { return _ranges.data(); }
+
+    const PixelRange* end() const { return _ranges.data() + _count; }
+
+    size_t pixelCount() const
+    {
+        size_t total = 0;
+        for (size_t index = 0; index < _count; ++index)
+        {
+            total += _ranges[index].count();
+        }
+
+        return total;
+    }
+
+  private:
+    void insertMergingClosest(size_t insertAt, PixelRange range)
+    {
+        // Work on NMaxRanges + 1 sorted ranges, then fold the smallest gap.
+        std::array<PixelRange, NMaxRanges + 1> pending{};
+        for (size_t index = 0, source = 0; index < pending.size(); ++index)
+        {
+            pending[index] = (index == insertAt) ? range : _ranges[source++];
+        }
+
+        size_t mergeAt = 0;
+        size_t smallestGap = SIZE_MAX;
+        for (size_t index = 0; index + 1 < pending.size(); ++index)
+        {
+            const size_t gap = pending[index + 1].first - pending[index].end;
+            if (gap < smallestGap)
+            {
+                smallestGap = gap;
+                mergeAt = index;
+            }
+        }
+
+        pending[mergeAt].end = pending[mergeAt + 1].end;
+        for (size_t index = 0, target = 0; index < pending.size(); ++index)
+        {
+            if (index != mergeAt + 1)
+            {
+                _ranges[target++] = pending[index];
+            }
+        }
+    }
+
+    std::array<PixelRange, NMaxRanges> _ranges{};
+    size_t _count{0};
+};
+
+} // namespace lw
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace lw
+{
+
+// Runs independent pieces of work, such as encoding the members of an aggregate bus,
+// possibly on several cores at once.
+class IExecutor
+{
+  public:
+    using TaskFunction = void (*)(void* context, size_t index);
+
+    virtual ~IExecutor() = default;
+
+    // Calls `task(context, index)` once for every index in [0, count), in any order and
+    // possibly concurrently, and returns when all calls have finished.
+    virtual void forEach(size_t count, TaskFunction task, void* context) = 0;
+
+    // Upper bound on how many tasks run at the same time, the caller included.
+    virtual size_t workerCount() const = 0;
+};
+
+// Runs every task on the calling thread, in index order.
+class InlineExecutor : public IExecutor
+{
+  public:
+    void forEach(size_t count, TaskFunction task, void* context) override
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            task(context, index);
+        }
+    }
+
+    size_t workerCount() const override { return 1; }
+};
+
+// Calls `function(index)` for every index in [0, count), on `executor` when one is
+// given and on the calling thread otherwise.
+template <typename TFunction> void parallelFor(IExecutor* executor, size_t count, TFunction&& function)
+{
+    using FunctionType = std::remove_reference_t<TFunction>;
+
+    if (executor == nullptr || count < 2)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            function(index);
+        }
+
+        return;
+    }
+
+    executor->forEach(
+        count, [](void* context, size_t index) { (*static_cast<FunctionType*>(context))(index); },
+        const_cast<void*>(static_cast<const void*>(std::addressof(function))));
+}
+
+} // namespace lw
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "core/Compat.h"
+#include "core/Executor.h"
+
+#if LW_HAS_FREERTOS_EXECUTOR
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+namespace lw
+{
+
+// FreeRTOS task backend, e.g. for putting the second ESP32 core to work. Helper tasks
+// block until forEach() wakes them, then claim indices from a shared counter alongside
+// the calling task.
+class FreeRtosTaskExecutor : public IExecutor
+{
+  public:
+    static constexpr size_t MaxHelpers = 4;
+
+    // `workerCount` includes the calling task. With one helper on a dual-core part it
+    // is pinned to the core the constructor does not run on; more helpers float.
+    explicit FreeRtosTaskExecutor(size_t workerCount = 2, uint32_t stackBytes = 4096,
+                                  UBaseType_t priority = tskIDLE_PRIORITY + 1)
+    {
+        _helperCount = (workerCount > 1) ? workerCount - 1 : 0;
+        _helperCount = (_helperCount > MaxHelpers) ? MaxHelpers : _helperCount;
+
+        _finished = xSemaphoreCreateCounting(MaxHelpers, 0);
+        const BaseType_t helperCore = (_helperCount == 1 && portNUM_PROCESSORS > 1)
+                                          ? static_cast<BaseType_t>(1 - xPortGetCoreID())
+                                          : static_cast<BaseType_t>(tskNO_AFFINITY);
+
+        for (size_t helper = 0; helper < _helperCount; ++helper)
+        {
+            _start[helper] = xSemaphoreCreateBinary();
+            _helperArgs[helper] = HelperArg{this, helper};
+            xTaskCreatePinnedToCore(helperMain, "lw-exec", stackBytes, &_helperArgs[helper], priority,
+                                    &_helpers[helper], helperCore);
+        }
+    }
+
+    ~FreeRtosTaskExecutor() override
+    {
+        for (size_t helper = 0; helper < _helperCount; ++helper)
+        {
+            vTaskDelete(_helpers[helper]);
+            vSemaphoreDelete(_start[helper]);
+        }
+
+        vSemaphoreDelete(_finished);
+    }
+
+    FreeRtosTaskExecutor(const FreeRtosTaskExecutor&) = delete;
+    FreeRtosTaskExecutor& operator=(const FreeRtosTaskExecutor&) = delete;
+
+    // Not reentrant: one forEach() at a time per executor.
+    void forEach(size_t count, TaskFunction task, void* context) override
+    {
+        if (count < 2 || _helperCount == 0)
+        {
+            InlineExecutor{}.forEach(count, task, context);
+            return;
+        }
+
+        _task = task;
+        _context = context;
+        _count = count;
+        _next.store(0);
+
+        for (size_t helper = 0; helper < _helperCount; ++helper)
+        {
+            xSemaphoreGive(_start[helper]);
+        }
+
+        runTasks();
+
+        for (size_t helper = 0; helper < _helperCount; ++helper)
+        {
+            xSemaphoreTake(_finished, portMAX_DELAY);
+        }
+    }
+
+    size_t workerCount() const override { return _helperCount + 1; }
+
+  private:
+    struct HelperArg
+    {
+        FreeRtosTaskExecutor* executor{nullptr};
+        size_t helper{0};
+    };
+
+    static void helperMain(void* arg)
+    {
+        auto* helperArg = static_cast<HelperArg*>(arg);
+        FreeRtosTaskExecutor& executor = *helperArg->executor;
+        for (;;)
+        {
+            xSemaphoreTake(executor._start[helperArg->helper], portMAX_DELAY);
+            executor.runTasks();
+            xSemaphoreGive(executor._finished);
+        }
+    }
+
+    void runTasks()
+    {
+        for (size_t index = _next.fetch_add(1); index < _count; index = _next.fetch_add(1))
+        {
+            _task(_context, index);
+        }
+    }
+
+    size_t _helperCount{0};
+    TaskHandle_t _helpers[MaxHelpers]{};
+    SemaphoreHandle_t _start[MaxHelpers]{};
+    HelperArg _helperArgs[MaxHelpers]{};
+    SemaphoreHandle_t _finished{nullptr};
+    TaskFunction _task{nullptr};
+    void* _context{nullptr};
+    size_t _count{0};
+    std::atomic<size_t> _next{0};
+};
+
+} // namespace lw
+
+#endif
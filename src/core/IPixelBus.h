@@ -6,9 +6,16 @@
 #include "colors/ColorIterator.h"
 #include "core/Compat.h"
 #include "core/PixelView.h"
+#include "core/ShowCompletion.h"
 
 namespace lw
 {
+namespace busses
+{
+template <typename TColor> class BusBufferPool;
+class FrameTiming;
+} // namespace busses
+
 template <typename TColor> class IPixelBus
 {
   public:
@@ -18,6 +25,48 @@ template <typename TColor> class IPixelBus
     virtual void show() = 0;
     virtual bool isReadyToUpdate() const = 0;
 
+    // show() split in two for synchronized aggregates: prepareShow() does the encoding
+    // and commitShow() only starts transmission. Buses that cannot split show on commit.
+    virtual void prepareShow() {}
+    virtual void commitShow() { show(); }
+
+    // show() that reports what happened to the frame. After Queued, `completion` runs
+    // once the transport can take the next frame, from the transport's end-of-transfer
+    // path when it has one and from pollCompletion() otherwise. Buses that cannot
+    // tell when a transfer ends run it right away.
+    virtual ShowStatus showAsync(ShowCompletion completion = {})
+    {
+        if (!isReadyToUpdate())
+        {
+            return ShowStatus::BusyDropped;
+        }
+
+        show();
+        if (completion.callback != nullptr)
+        {
+            completion.callback(completion.context);
+        }
+
+        return ShowStatus::Queued;
+    }
+
+    // commitShow() that reports like showAsync(), for aggregates that prepared their
+    // members first. Buses that cannot split show on commit.
+    virtual ShowStatus commitShowAsync(ShowCompletion completion = {}) { return showAsync(completion); }
+
+    // Runs a pending completion if its transfer has finished; returns whether one ran.
+    // Render loops call this where the transport cannot signal completion itself.
+    virtual bool pollCompletion() { return false; }
+
+    // Records per-stage timings and show outcomes into `timing`, which is not owned;
+    // null detaches. Aggregates forward it to their members; buses without stages
+    // ignore it.
+    virtual void setFrameTiming(busses::FrameTiming* timing) { (void)timing; }
+
+    // Called by an aggregate that shows its members sequentially. A bus may release
+    // scratch or protocol storage it owns and borrow it from `pool` during show().
+    virtual void shareBuffers(busses::BusBufferPool<TColor>& pool) { (void)pool; }
+
     virtual PixelView<TColor>& pixels() = 0;
     virtual const PixelView<TColor>& pixels() const = 0;
 };
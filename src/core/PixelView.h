@@ -2,6 +2,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <iterator>
 #include <limits>
@@ -13,6 +15,14 @@
 namespace lw
 {
 
+// Caller-owned room for the chunk list of a slice or concatenation with more chunks
+// than a view holds inline. Each span needs an entry per chunk of the result.
+template <typename TColor> struct PixelViewStorage
+{
+    span<span<TColor>> chunks{};
+    span<uint32_t> chunkStarts{};
+};
+
 template <typename TColor> class PixelView
 {
   public:
@@ -20,11 +30,40 @@ template <typename TColor> class PixelView
     using ColorRef = std::add_lvalue_reference_t<TColor>;
     using ConstColorRef = std::add_lvalue_reference_t<const std::remove_reference_t<TColor>>;
     using ChunkType = span<TColor>;
+    using StorageType = PixelViewStorage<TColor>;
+
+    // Slices and concatenations with up to this many chunks keep their chunk list
+    // inside the view and never allocate.
+    static constexpr size_t InlineChunkCapacity = LW_PIXEL_VIEW_INLINE_CHUNKS;
 
     class iterator;
     class const_iterator;
 
-    explicit PixelView(span<ChunkType> chunks) : _chunks(chunks) {}
+    // The view indexes its chunks once, here; rebuild it after changing the chunk
+    // spans it was given.
+    explicit PixelView(span<ChunkType> chunks) : _chunks(chunks) { indexChunks(); }
+
+    PixelView(const PixelView& other) { adopt(other); }
+
+    PixelView(PixelView&& other) noexcept { adopt(std::move(other)); }
+
+    PixelView& operator=(const PixelView& other)
+    {
+        if (this != &other)
+        {
+            adopt(other);
+        }
+        return *this;
+    }
+
+    PixelView& operator=(PixelView&& other) noexcept
+    {
+        if (this != &other)
+        {
+            adopt(std::move(other));
+        }
+        return *this;
+    }
 
     [[nodiscard]] PixelView operator+(const PixelView& other) const { return concatenate(*this, other); }
 
@@ -34,32 +73,28 @@ template <typename TColor> class PixelView
                                            std::is_same<PixelView, lw::remove_cvref_t<TOtherViews>>...>::value>>
     static PixelView concatenate(const PixelView& first, const TOtherViews&... others)
     {
-        std::vector<ChunkType> concatenated;
-        const size_t totalChunks = first._chunks.size() + (static_cast<size_t>(others._chunks.size()) + ... + 0u);
-        concatenated.reserve(totalChunks);
-
-        appendChunks(concatenated, first);
-        (appendChunks(concatenated, others), ...);
-
-        return PixelView(std::move(concatenated));
+        return concatenate(StorageType{}, first, others...);
     }
 
-    [[nodiscard]] uint32_t size() const
+    // Results with more than InlineChunkCapacity chunks use `storage` when it is large
+    // enough and fall back to the heap otherwise.
+    template <typename... TOtherViews, typename = std::enable_if_t<std::conjunction<
+                                           std::is_same<PixelView, lw::remove_cvref_t<TOtherViews>>...>::value>>
+    static PixelView concatenate(const StorageType& storage, const PixelView& first, const TOtherViews&... others)
     {
-        uint32_t total = 0;
-        for (const auto chunk : _chunks)
-        {
-            const auto chunkSize = static_cast<uint32_t>(chunk.size());
-            const uint32_t available = std::numeric_limits<uint32_t>::max() - total;
-            total += (chunkSize < available) ? chunkSize : available;
-            if (total == std::numeric_limits<uint32_t>::max())
-            {
-                break;
-            }
-        }
-        return total;
+        PixelView concatenated;
+        concatenated.reserveChunks(first._chunks.size() + (static_cast<size_t>(others._chunks.size()) + ... + 0u),
+                                   storage);
+
+        concatenated.appendChunks(first);
+        (concatenated.appendChunks(others), ...);
+        concatenated.finishChunks();
+
+        return concatenated;
     }
 
+    [[nodiscard]] uint32_t size() const { return _size; }
+
     TColor operator[](uint32_t index) const { return constRefAt(index); }
 
     ColorRef operator[](uint32_t index) { return refAt(index); }
@@ -80,96 +115,328 @@ template <typename TColor> class PixelView
 
     span<const ChunkType> chunks() const { return span<const ChunkType>{_chunks.data(), _chunks.size()}; }
 
-    [[nodiscard]] PixelView slice(uint32_t startIndex, uint32_t endIndex)
+    // The pixels from `index` to the end of the chunk holding it, for algorithms that
+    // work a contiguous run at a time. Empty at or past the end.
+    ChunkType contiguousFrom(uint32_t index) { return runFrom<TColor>(index); }
+
+    span<const TColor> contiguousFrom(uint32_t index) const { return runFrom<const TColor>(index); }
+
+    // The pixels from the start of the chunk holding `index - 1` up to `index`, for
+    // walking backwards. Empty at index 0.
+    ChunkType contiguousBefore(uint32_t index) { return runBefore<TColor>(index); }
+
+    span<const TColor> contiguousBefore(uint32_t index) const { return runBefore<const TColor>(index); }
+
+    // Only the chunks overlapping the range are visited. Storage works as for
+    // concatenate().
+    [[nodiscard]] PixelView slice(uint32_t startIndex, uint32_t endIndex, const StorageType& storage = {})
     {
-        const uint32_t totalSize = size();
-        const uint32_t clampedStart = std::min(startIndex, totalSize);
-        const uint32_t clampedEnd = std::min(endIndex, totalSize);
+        const uint32_t clampedStart = std::min(startIndex, _size);
+        const uint32_t clampedEnd = std::min(endIndex, _size);
         const uint32_t normalizedEnd = (clampedEnd < clampedStart) ? clampedStart : clampedEnd;
 
-        std::vector<ChunkType> sliced;
-        sliced.reserve(_chunks.size());
+        PixelView sliced;
+        if (clampedStart == normalizedEnd)
+        {
+            return sliced;
+        }
+
+        const size_t firstChunk = chunkContaining(clampedStart);
+        const size_t lastChunk = chunkContaining(normalizedEnd - 1);
+        sliced.reserveChunks(lastChunk - firstChunk + 1, storage);
 
-        uint32_t globalOffset = 0;
-        for (auto chunk : _chunks)
+        for (size_t chunk = firstChunk; chunk <= lastChunk; ++chunk)
         {
-            const uint32_t chunkSize = static_cast<uint32_t>(chunk.size());
-            const uint32_t chunkStart = globalOffset;
-            const uint32_t chunkEnd = chunkStart + chunkSize;
+            const uint32_t chunkStartIndex = chunkStart(chunk);
+            const auto chunkSize = static_cast<uint32_t>(_chunks[chunk].size());
+            const uint32_t localStart = (clampedStart > chunkStartIndex) ? clampedStart - chunkStartIndex : 0;
+            const uint32_t localEnd = std::min(normalizedEnd - chunkStartIndex, chunkSize);
+            if (localStart < localEnd)
+            {
+                sliced.appendChunk(ChunkType{_chunks[chunk].data() + localStart, localEnd - localStart});
+            }
+        }
+
+        sliced.finishChunks();
+        return sliced;
+    }
+
+  private:
+    // Where an iterator is: the pixel it points at and the end of that pixel's chunk,
+    // so stepping only looks at the chunk list when it crosses a boundary. Past the
+    // end, `chunk` is the chunk count and both pointers are null.
+    template <typename TPointer> struct Cursor
+    {
+        TPointer pixel{nullptr};
+        TPointer chunkEnd{nullptr};
+        size_t chunk{0};
+        uint32_t index{0};
+    };
+
+    PixelView() = default;
+
+    static uint32_t addSaturated(uint32_t total, size_t count)
+    {
+        const uint32_t available = std::numeric_limits<uint32_t>::max() - total;
+        return total + ((count < available) ? static_cast<uint32_t>(count) : available);
+    }
+
+    // Copies or moves `source`, re-pointing whatever it kept in its own inline or heap
+    // storage at ours.
+    template <typename TSource> void adopt(TSource&& source)
+    {
+        const size_t chunkCount = source._chunks.size();
+        const bool inlineChunks = chunkCount != 0 && source._chunks.data() == source._inlineChunks.data();
+        const bool heapChunks = chunkCount != 0 && source._chunks.data() == source._ownedChunks.data();
+        const bool inlineStarts = source._chunkStarts == source._inlineStarts.data();
+        const bool heapStarts = source._chunkStarts != nullptr && source._chunkStarts == source._ownedStarts.data();
+
+        _inlineChunks = source._inlineChunks;
+        _inlineStarts = source._inlineStarts;
+        _ownedChunks = std::forward<TSource>(source)._ownedChunks;
+        _ownedStarts = std::forward<TSource>(source)._ownedStarts;
+
+        _chunks = inlineChunks ? ChunkListType{_inlineChunks.data(), chunkCount}
+                  : heapChunks ? ChunkListType{_ownedChunks.data(), chunkCount}
+                               : source._chunks;
+        _chunkStarts = inlineStarts ? _inlineStarts.data() : heapStarts ? _ownedStarts.data() : source._chunkStarts;
+        _size = source._size;
+    }
 
-            const uint32_t intersectionStart = std::max(clampedStart, chunkStart);
-            const uint32_t intersectionEnd = std::min(normalizedEnd, chunkEnd);
+    void indexChunks()
+    {
+        _chunkStarts = nullptr;
+        if (_chunks.size() > InlineChunkCapacity)
+        {
+            _ownedStarts.resize(_chunks.size());
+            _chunkStarts = _ownedStarts.data();
+        }
+        else if (_chunks.size() > 1)
+        {
+            _chunkStarts = _inlineStarts.data();
+        }
 
-            if (intersectionStart < intersectionEnd)
+        _size = 0;
+        for (size_t chunk = 0; chunk < _chunks.size(); ++chunk)
+        {
+            if (_chunkStarts != nullptr)
             {
-                const size_t localStart = static_cast<size_t>(intersectionStart - chunkStart);
-                const size_t localLength = static_cast<size_t>(intersectionEnd - intersectionStart);
-                sliced.emplace_back(chunk.data() + localStart, localLength);
+                _chunkStarts[chunk] = _size;
             }
 
-            globalOffset = chunkEnd;
-            if (globalOffset >= normalizedEnd)
+            _size = addSaturated(_size, _chunks[chunk].size());
+        }
+    }
+
+    // Points an empty chunk list and start table at room for `chunkCount` entries: the
+    // inline arrays, then `storage`, then the heap. appendChunk() fills them in.
+    void reserveChunks(size_t chunkCount, const StorageType& storage)
+    {
+        ChunkType* chunks = _inlineChunks.data();
+        uint32_t* starts = _inlineStarts.data();
+        if (chunkCount > InlineChunkCapacity)
+        {
+            if (storage.chunks.size() >= chunkCount && storage.chunkStarts.size() >= chunkCount)
+            {
+                chunks = storage.chunks.data();
+                starts = storage.chunkStarts.data();
+            }
+            else
             {
-                break;
+                _ownedChunks.resize(chunkCount);
+                _ownedStarts.resize(chunkCount);
+                chunks = _ownedChunks.data();
+                starts = _ownedStarts.data();
             }
         }
 
-        return PixelView(std::move(sliced));
+        _chunks = ChunkListType{chunks, 0};
+        _chunkStarts = starts;
+        _size = 0;
     }
 
-  private:
-    explicit PixelView(std::vector<ChunkType>&& ownedChunks)
-        : _ownedChunks(std::move(ownedChunks)), _chunks(_ownedChunks.data(), _ownedChunks.size())
+    // Empty chunks are dropped.
+    void appendChunk(ChunkType chunk)
     {
+        if (chunk.empty())
+        {
+            return;
+        }
+
+        const size_t count = _chunks.size();
+        _chunks.data()[count] = chunk;
+        _chunkStarts[count] = _size;
+        _chunks = ChunkListType{_chunks.data(), count + 1};
+        _size = addSaturated(_size, chunk.size());
     }
 
-    static void appendChunks(std::vector<ChunkType>& destination, const PixelView& source)
+    void appendChunks(const PixelView& source)
     {
         for (const auto chunk : source._chunks)
         {
-            destination.push_back(chunk);
+            appendChunk(chunk);
         }
     }
 
-    ColorRef refAt(uint32_t index)
+    void finishChunks()
     {
-        assert(index < size());
+        if (_chunks.size() < 2)
+        {
+            _chunkStarts = nullptr;
+        }
+    }
 
-        uint32_t offset = index;
-        for (auto chunk : _chunks)
+    uint32_t chunkStart(size_t chunk) const { return (_chunkStarts == nullptr) ? 0 : _chunkStarts[chunk]; }
+
+    // Binary search over the chunk starts. Empty chunks share their successor's start,
+    // so the last chunk starting at or before `index` is the one holding it.
+    size_t chunkContaining(uint32_t index) const
+    {
+        if (_chunkStarts == nullptr)
         {
-            const uint32_t chunkSize = static_cast<uint32_t>(chunk.size());
-            if (offset < chunkSize)
-            {
-                return chunk[offset];
-            }
-            offset -= chunkSize;
+            return 0;
         }
 
-        // Unreachable with valid preconditions.
-        return _chunks[0][0];
+        const uint32_t* found = std::upper_bound(_chunkStarts, _chunkStarts + _chunks.size(), index);
+        return static_cast<size_t>(found - _chunkStarts) - 1;
     }
 
-    ConstColorRef constRefAt(uint32_t index) const
+    template <typename TElement> span<TElement> runFrom(uint32_t index) const
     {
-        assert(index < size());
+        if (index >= _size)
+        {
+            return span<TElement>{};
+        }
+
+        const size_t chunk = chunkContaining(index);
+        const uint32_t offset = index - chunkStart(chunk);
+        return span<TElement>{_chunks[chunk].data() + offset, _chunks[chunk].size() - offset};
+    }
+
+    template <typename TElement> span<TElement> runBefore(uint32_t index) const
+    {
+        if (index == 0 || index > _size)
+        {
+            return span<TElement>{};
+        }
+
+        const size_t chunk = chunkContaining(index - 1);
+        return span<TElement>{_chunks[chunk].data(), index - chunkStart(chunk)};
+    }
+
+    // Positions `cursor` on the first pixel of the first non-empty chunk at or after
+    // `chunk`, or past the end.
+    template <typename TPointer> void enterChunk(Cursor<TPointer>& cursor, size_t chunk) const
+    {
+        while (chunk < _chunks.size() && _chunks[chunk].empty())
+        {
+            ++chunk;
+        }
+
+        cursor.chunk = chunk;
+        if (chunk == _chunks.size())
+        {
+            cursor.pixel = nullptr;
+            cursor.chunkEnd = nullptr;
+            return;
+        }
+
+        cursor.pixel = _chunks[chunk].data();
+        cursor.chunkEnd = cursor.pixel + _chunks[chunk].size();
+    }
+
+    template <typename TPointer> void seek(Cursor<TPointer>& cursor, uint32_t index) const
+    {
+        cursor.index = index;
+        if (index >= _size)
+        {
+            cursor.chunk = _chunks.size();
+            cursor.pixel = nullptr;
+            cursor.chunkEnd = nullptr;
+            return;
+        }
 
-        uint32_t offset = index;
-        for (const auto chunk : _chunks)
+        const size_t chunk = chunkContaining(index);
+        cursor.chunk = chunk;
+        cursor.pixel = _chunks[chunk].data() + (index - chunkStart(chunk));
+        cursor.chunkEnd = _chunks[chunk].data() + _chunks[chunk].size();
+    }
+
+    template <typename TPointer> void advance(Cursor<TPointer>& cursor) const
+    {
+        ++cursor.index;
+        if (++cursor.pixel == cursor.chunkEnd)
         {
-            const uint32_t chunkSize = static_cast<uint32_t>(chunk.size());
-            if (offset < chunkSize)
+            enterChunk(cursor, cursor.chunk + 1);
+        }
+    }
+
+    template <typename TPointer> void retreat(Cursor<TPointer>& cursor) const
+    {
+        --cursor.index;
+        if (cursor.chunk < _chunks.size() && cursor.pixel != _chunks[cursor.chunk].data())
+        {
+            --cursor.pixel;
+            return;
+        }
+
+        size_t chunk = cursor.chunk;
+        while (chunk > 0 && _chunks[chunk - 1].empty())
+        {
+            --chunk;
+        }
+
+        // Stepping back from the first pixel is undefined, as for any iterator.
+        cursor.chunk = chunk - 1;
+        cursor.chunkEnd = _chunks[cursor.chunk].data() + _chunks[cursor.chunk].size();
+        cursor.pixel = cursor.chunkEnd - 1;
+    }
+
+    // Jumps within the current chunk move the pointer; longer ones search again.
+    template <typename TPointer> void jump(Cursor<TPointer>& cursor, std::ptrdiff_t n) const
+    {
+        const auto target = static_cast<uint32_t>(cursor.index + n);
+        if (cursor.chunk < _chunks.size())
+        {
+            const uint32_t start = chunkStart(cursor.chunk);
+            if (target >= start && target - start < _chunks[cursor.chunk].size())
             {
-                return chunk[offset];
+                cursor.pixel += n;
+                cursor.index = target;
+                return;
             }
-            offset -= chunkSize;
         }
 
-        return _chunks[0][0];
+        seek(cursor, target);
     }
 
+    ColorRef refAt(uint32_t index)
+    {
+        assert(index < size());
+
+        const size_t chunk = chunkContaining(index);
+        return _chunks[chunk][index - chunkStart(chunk)];
+    }
+
+    ConstColorRef constRefAt(uint32_t index) const
+    {
+        assert(index < size());
+
+        const size_t chunk = chunkContaining(index);
+        return _chunks[chunk][index - chunkStart(chunk)];
+    }
+
+    using ChunkListType = span<ChunkType>;
+
+    std::array<ChunkType, InlineChunkCapacity> _inlineChunks{};
+    std::array<uint32_t, InlineChunkCapacity> _inlineStarts{};
     std::vector<ChunkType> _ownedChunks;
-    span<ChunkType> _chunks;
+    std::vector<uint32_t> _ownedStarts;
+    ChunkListType _chunks{};
+    // Global index of each chunk's first pixel, in one of the arrays above or in
+    // caller storage; null for views with fewer than two chunks.
+    uint32_t* _chunkStarts{nullptr};
+    uint32_t _size{0};
 
   public:
     class iterator
@@ -183,17 +450,17 @@ template <typename TColor> class PixelView
 
         iterator() = default;
 
-        iterator(PixelView* view, uint32_t index) : _view(view), _index(index) {}
+        iterator(PixelView* view, uint32_t index) : _view(view) { _view->seek(_cursor, index); }
 
-        reference operator*() const { return _view->refAt(_index); }
+        reference operator*() const { return *_cursor.pixel; }
 
-        pointer operator->() const { return std::addressof(_view->refAt(_index)); }
+        pointer operator->() const { return _cursor.pixel; }
 
-        reference operator[](difference_type n) const { return _view->refAt(static_cast<uint32_t>(_index + n)); }
+        reference operator[](difference_type n) const { return *(*this + n); }
 
         iterator& operator++()
         {
-            ++_index;
+            _view->advance(_cursor);
             return *this;
         }
 
@@ -206,7 +473,7 @@ template <typename TColor> class PixelView
 
         iterator& operator--()
         {
-            --_index;
+            _view->retreat(_cursor);
             return *this;
         }
 
@@ -219,13 +486,13 @@ template <typename TColor> class PixelView
 
         iterator& operator+=(difference_type n)
         {
-            _index = static_cast<uint32_t>(_index + n);
+            _view->jump(_cursor, n);
             return *this;
         }
 
         iterator& operator-=(difference_type n)
         {
-            _index = static_cast<uint32_t>(_index - n);
+            _view->jump(_cursor, -n);
             return *this;
         }
 
@@ -249,29 +516,29 @@ template <typename TColor> class PixelView
 
         friend difference_type operator-(const iterator& a, const iterator& b)
         {
-            return static_cast<difference_type>(a._index) - static_cast<difference_type>(b._index);
+            return static_cast<difference_type>(a._cursor.index) - static_cast<difference_type>(b._cursor.index);
         }
 
         friend bool operator==(const iterator& a, const iterator& b)
         {
-            return a._view == b._view && a._index == b._index;
+            return a._view == b._view && a._cursor.index == b._cursor.index;
         }
 
         friend bool operator!=(const iterator& a, const iterator& b) { return !(a == b); }
 
-        friend bool operator<(const iterator& a, const iterator& b) { return a._index < b._index; }
+        friend bool operator<(const iterator& a, const iterator& b) { return a._cursor.index < b._cursor.index; }
 
-        friend bool operator<=(const iterator& a, const iterator& b) { return a._index <= b._index; }
+        friend bool operator<=(const iterator& a, const iterator& b) { return a._cursor.index <= b._cursor.index; }
 
-        friend bool operator>(const iterator& a, const iterator& b) { return a._index > b._index; }
+        friend bool operator>(const iterator& a, const iterator& b) { return a._cursor.index > b._cursor.index; }
 
-        friend bool operator>=(const iterator& a, const iterator& b) { return a._index >= b._index; }
+        friend bool operator>=(const iterator& a, const iterator& b) { return a._cursor.index >= b._cursor.index; }
 
       private:
         friend class const_iterator;
 
         PixelView* _view{nullptr};
-        uint32_t _index{0};
+        Cursor<std::add_pointer_t<TColor>> _cursor{};
     };
 
     class const_iterator
@@ -285,19 +552,22 @@ template <typename TColor> class PixelView
 
         const_iterator() = default;
 
-        const_iterator(const PixelView* view, uint32_t index) : _view(view), _index(index) {}
+        const_iterator(const PixelView* view, uint32_t index) : _view(view) { _view->seek(_cursor, index); }
 
-        const_iterator(const iterator& it) : _view(it._view), _index(it._index) {}
+        const_iterator(const iterator& it)
+            : _view(it._view), _cursor{it._cursor.pixel, it._cursor.chunkEnd, it._cursor.chunk, it._cursor.index}
+        {
+        }
 
-        reference operator*() const { return _view->constRefAt(_index); }
+        reference operator*() const { return *_cursor.pixel; }
 
-        pointer operator->() const { return std::addressof(_view->constRefAt(_index)); }
+        pointer operator->() const { return _cursor.pixel; }
 
-        reference operator[](difference_type n) const { return _view->constRefAt(static_cast<uint32_t>(_index + n)); }
+        reference operator[](difference_type n) const { return *(*this + n); }
 
         const_iterator& operator++()
         {
-            ++_index;
+            _view->advance(_cursor);
             return *this;
         }
 
@@ -310,7 +580,7 @@ template <typename TColor> class PixelView
 
         const_iterator& operator--()
         {
-            --_index;
+            _view->retreat(_cursor);
             return *this;
         }
 
@@ -323,13 +593,13 @@ template <typename TColor> class PixelView
 
         const_iterator& operator+=(difference_type n)
         {
-            _index = static_cast<uint32_t>(_index + n);
+            _view->jump(_cursor, n);
             return *this;
         }
 
         const_iterator& operator-=(difference_type n)
         {
-            _index = static_cast<uint32_t>(_index - n);
+            _view->jump(_cursor, -n);
             return *this;
         }
 
@@ -353,35 +623,47 @@ template <typename TColor> class PixelView
 
         friend difference_type operator-(const const_iterator& a, const const_iterator& b)
         {
-            return static_cast<difference_type>(a._index) - static_cast<difference_type>(b._index);
+            return static_cast<difference_type>(a._cursor.index) - static_cast<difference_type>(b._cursor.index);
         }
 
         friend bool operator==(const const_iterator& a, const const_iterator& b)
         {
-            return a._view == b._view && a._index == b._index;
+            return a._view == b._view && a._cursor.index == b._cursor.index;
         }
 
         friend bool operator!=(const const_iterator& a, const const_iterator& b) { return !(a == b); }
 
-        friend bool operator<(const const_iterator& a, const const_iterator& b) { return a._index < b._index; }
+        friend bool operator<(const const_iterator& a, const const_iterator& b)
+        {
+            return a._cursor.index < b._cursor.index;
+        }
 
-        friend bool operator<=(const const_iterator& a, const const_iterator& b) { return a._index <= b._index; }
+        friend bool operator<=(const const_iterator& a, const const_iterator& b)
+        {
+            return a._cursor.index <= b._cursor.index;
+        }
 
-        friend bool operator>(const const_iterator& a, const const_iterator& b) { return a._index > b._index; }
+        friend bool operator>(const const_iterator& a, const const_iterator& b)
+        {
+            return a._cursor.index > b._cursor.index;
+        }
 
-        friend bool operator>=(const const_iterator& a, const const_iterator& b) { return a._index >= b._index; }
+        friend bool operator>=(const const_iterator& a, const const_iterator& b)
+        {
+            return a._cursor.index >= b._cursor.index;
+        }
 
       private:
         const PixelView* _view{nullptr};
-        uint32_t _index{0};
+        Cursor<std::add_pointer_t<const std::remove_reference_t<TColor>>> _cursor{};
     };
 };
 
 template <typename TColor> inline void fillPixels(PixelView<TColor>& pixels, const TColor& solidColor)
 {
-    for (auto& pixel : pixels)
+    for (auto chunk : pixels.chunks())
     {
-        pixel = solidColor;
+        std::fill_n(chunk.data(), chunk.size(), solidColor);
     }
 }
 
@@ -390,10 +672,13 @@ template <typename TColor, typename TGenerator,
 inline void fillPixelsIndexed(PixelView<TColor>& pixels, TGenerator&& generator)
 {
     uint32_t index = 0;
-    for (auto& pixel : pixels)
+    for (auto chunk : pixels.chunks())
     {
-        pixel = static_cast<TColor>(generator(index));
-        ++index;
+        for (auto& pixel : chunk)
+        {
+            pixel = static_cast<TColor>(generator(index));
+            ++index;
+        }
     }
 }
 
@@ -0,0 +1,360 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "core/Compat.h"
+#include "core/PixelView.h"
+
+namespace lw
+{
+
+// `count` pixels within one chunk, starting at `first` and `stride` elements apart. A
+// negative stride walks backwards through memory.
+template <typename TPointer> struct PixelRun
+{
+    TPointer first{nullptr};
+    uint32_t count{0};
+    std::ptrdiff_t stride{1};
+
+    decltype(auto) operator[](uint32_t index) const { return first[static_cast<std::ptrdiff_t>(index) * stride]; }
+};
+
+// Pixels `first`, `first + step`, `first + 2 * step`, ... of a PixelView, `count` of
+// them, read and written in place. A negative step walks the view backwards. The
+// adaptor is a handle like span: copy it freely, but the view it was built from must
+// outlive it. Build one with strideView(), reverseView(), offsetView() or
+// interleaveView(); applying those to an adaptor composes them.
+template <typename TColor> class StridedPixelView
+{
+  public:
+    using ColorType = TColor;
+    using ColorRef = typename PixelView<TColor>::ColorRef;
+    using ConstColorRef = typename PixelView<TColor>::ConstColorRef;
+
+    template <typename TBaseIterator> class Iterator;
+    using iterator = Iterator<typename PixelView<TColor>::iterator>;
+    using const_iterator = Iterator<typename PixelView<TColor>::const_iterator>;
+
+    explicit StridedPixelView(PixelView<TColor>& base) : StridedPixelView(base, 0, 1, base.size()) {}
+
+    // `count` is cut short where the sequence would leave the view; `step` must not be 0.
+    StridedPixelView(PixelView<TColor>& base, uint32_t first, std::ptrdiff_t step, uint32_t count)
+        : _base(&base), _first(first), _step(step), _count(fittedCount(base.size(), first, step, count))
+    {
+    }
+
+    [[nodiscard]] uint32_t size() const { return _count; }
+
+    uint32_t first() const { return _first; }
+
+    std::ptrdiff_t step() const { return _step; }
+
+    PixelView<TColor>& base() const { return *_base; }
+
+    ColorRef operator[](uint32_t index) { return (*_base)[baseIndex(index)]; }
+
+    TColor operator[](uint32_t index) const { return static_cast<const PixelView<TColor>&>(*_base)[baseIndex(index)]; }
+
+    iterator begin() { return iterator(_base->begin() + _first, 0, _step); }
+
+    iterator end() { return begin() + static_cast<std::ptrdiff_t>(_count); }
+
+    const_iterator begin() const { return cbegin(); }
+
+    const_iterator end() const { return cend(); }
+
+    const_iterator cbegin() const { return const_iterator(baseView().cbegin() + _first, 0, _step); }
+
+    const_iterator cend() const { return cbegin() + static_cast<std::ptrdiff_t>(_count); }
+
+    // Every `stride`-th pixel from `first` on.
+    [[nodiscard]] StridedPixelView strided(uint32_t stride, uint32_t first = 0) const
+    {
+        const uint32_t count = (first < _count && stride != 0) ? ((_count - first - 1) / stride) + 1 : 0;
+        return StridedPixelView(*_base, baseIndex(first), _step * static_cast<std::ptrdiff_t>(stride), count);
+    }
+
+    [[nodiscard]] StridedPixelView reversed() const
+    {
+        if (_count == 0)
+        {
+            return *this;
+        }
+
+        return StridedPixelView(*_base, baseIndex(_count - 1), -_step, _count);
+    }
+
+    // Up to `count` pixels from `offset` on.
+    [[nodiscard]] StridedPixelView offset(uint32_t offset, uint32_t count = UINT32_MAX) const
+    {
+        const uint32_t available = (offset < _count) ? _count - offset : 0;
+        return StridedPixelView(*_base, baseIndex(offset), _step, (count < available) ? count : available);
+    }
+
+    // The longest run starting at `index` that stays inside one chunk of the view.
+    PixelRun<std::add_pointer_t<TColor>> runFrom(uint32_t index) { return runFromIn<TColor>(*_base, index); }
+
+    PixelRun<std::add_pointer_t<const TColor>> runFrom(uint32_t index) const
+    {
+        return runFromIn<const TColor>(baseView(), index);
+    }
+
+    // The longest run ending just before `index` that stays inside one chunk.
+    PixelRun<std::add_pointer_t<TColor>> runBefore(uint32_t index) { return runBeforeIn<TColor>(*_base, index); }
+
+    PixelRun<std::add_pointer_t<const TColor>> runBefore(uint32_t index) const
+    {
+        return runBeforeIn<const TColor>(baseView(), index);
+    }
+
+    template <typename TBaseIterator> class Iterator
+    {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = TColor;
+        using difference_type = std::ptrdiff_t;
+        using reference = typename std::iterator_traits<TBaseIterator>::reference;
+        using pointer = typename std::iterator_traits<TBaseIterator>::pointer;
+
+        Iterator() = default;
+
+        Iterator(TBaseIterator base, uint32_t index, std::ptrdiff_t step) : _base(base), _index(index), _step(step) {}
+
+        // Converts iterator to const_iterator.
+        template <typename TOther, typename = std::enable_if_t<std::is_convertible<TOther, TBaseIterator>::value &&
+                                                               !std::is_same<TOther, TBaseIterator>::value>>
+        Iterator(const Iterator<TOther>& other) : _base(other._base), _index(other._index), _step(other._step)
+        {
+        }
+
+        reference operator*() const { return *_base; }
+
+        pointer operator->() const { return _base.operator->(); }
+
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        Iterator& operator++()
+        {
+            ++_index;
+            if (_step == 1)
+            {
+                ++_base;
+            }
+            else
+            {
+                _base += _step;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        Iterator& operator--()
+        {
+            --_index;
+            _base -= _step;
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator copy = *this;
+            --(*this);
+            return copy;
+        }
+
+        Iterator& operator+=(difference_type n)
+        {
+            _index = static_cast<uint32_t>(_index + n);
+            _base += n * _step;
+            return *this;
+        }
+
+        Iterator& operator-=(difference_type n) { return *this += -n; }
+
+        friend Iterator operator+(Iterator it, difference_type n)
+        {
+            it += n;
+            return it;
+        }
+
+        friend Iterator operator+(difference_type n, Iterator it)
+        {
+            it += n;
+            return it;
+        }
+
+        friend Iterator operator-(Iterator it, difference_type n)
+        {
+            it -= n;
+            return it;
+        }
+
+        friend difference_type operator-(const Iterator& a, const Iterator& b)
+        {
+            return static_cast<difference_type>(a._index) - static_cast<difference_type>(b._index);
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a._index == b._index; }
+
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return !(a == b); }
+
+        friend bool operator<(const Iterator& a, const Iterator& b) { return a._index < b._index; }
+
+        friend bool operator<=(const Iterator& a, const Iterator& b) { return a._index <= b._index; }
+
+        friend bool operator>(const Iterator& a, const Iterator& b) { return a._index > b._index; }
+
+        friend bool operator>=(const Iterator& a, const Iterator& b) { return a._index >= b._index; }
+
+      private:
+        template <typename TOther> friend class Iterator;
+
+        TBaseIterator _base{};
+        uint32_t _index{0};
+        std::ptrdiff_t _step{1};
+    };
+
+  private:
+    static uint32_t fittedCount(uint32_t baseSize, uint32_t first, std::ptrdiff_t step, uint32_t count)
+    {
+        if (first >= baseSize || step == 0)
+        {
+            return 0;
+        }
+
+        const uint32_t reachable = (step > 0) ? ((baseSize - first - 1) / static_cast<uint32_t>(step)) + 1
+                                              : (first / static_cast<uint32_t>(-step)) + 1;
+        return (count < reachable) ? count : reachable;
+    }
+
+    const PixelView<TColor>& baseView() const { return *_base; }
+
+    uint32_t baseIndex(uint32_t index) const
+    {
+        return static_cast<uint32_t>(static_cast<std::ptrdiff_t>(_first) + (static_cast<std::ptrdiff_t>(index) * _step));
+    }
+
+    uint32_t stepSize() const { return static_cast<uint32_t>((_step < 0) ? -_step : _step); }
+
+    // How many pixels `stride` apart fit in `span`, counting from one end.
+    static uint32_t runLength(size_t span, uint32_t stride) { return static_cast<uint32_t>((span - 1) / stride) + 1; }
+
+    template <typename TElement, typename TView> PixelRun<TElement*> runFromIn(TView& view, uint32_t index) const
+    {
+        if (index >= _count)
+        {
+            return PixelRun<TElement*>{};
+        }
+
+        const uint32_t remaining = _count - index;
+        const uint32_t pixel = baseIndex(index);
+        if (_step > 0)
+        {
+            auto span = view.contiguousFrom(pixel);
+            const uint32_t length = runLength(span.size(), stepSize());
+            return PixelRun<TElement*>{span.data(), (length < remaining) ? length : remaining, _step};
+        }
+
+        auto span = view.contiguousBefore(pixel + 1);
+        const uint32_t length = runLength(span.size(), stepSize());
+        return PixelRun<TElement*>{span.data() + span.size() - 1, (length < remaining) ? length : remaining, _step};
+    }
+
+    template <typename TElement, typename TView> PixelRun<TElement*> runBeforeIn(TView& view, uint32_t index) const
+    {
+        if (index == 0 || index > _count)
+        {
+            return PixelRun<TElement*>{};
+        }
+
+        const uint32_t pixel = baseIndex(index - 1);
+        if (_step > 0)
+        {
+            auto span = view.contiguousBefore(pixel + 1);
+            const uint32_t length = std::min(runLength(span.size(), stepSize()), index);
+            TElement* last = span.data() + span.size() - 1;
+            return PixelRun<TElement*>{last - (static_cast<std::ptrdiff_t>(length - 1) * _step), length, _step};
+        }
+
+        auto span = view.contiguousFrom(pixel);
+        const uint32_t length = std::min(runLength(span.size(), stepSize()), index);
+        return PixelRun<TElement*>{span.data() - (static_cast<std::ptrdiff_t>(length - 1) * _step), length, _step};
+    }
+
+    PixelView<TColor>* _base;
+    uint32_t _first;
+    std::ptrdiff_t _step;
+    uint32_t _count;
+};
+
+template <typename T> struct IsStridedPixelView : std::false_type
+{
+};
+
+template <typename TColor> struct IsStridedPixelView<StridedPixelView<TColor>> : std::true_type
+{
+};
+
+// Every `stride`-th pixel, starting with pixel `first`.
+template <typename TColor>
+inline StridedPixelView<TColor> strideView(PixelView<TColor>& view, uint32_t stride, uint32_t first = 0)
+{
+    return StridedPixelView<TColor>(view).strided(stride, first);
+}
+
+template <typename TColor>
+inline StridedPixelView<TColor> strideView(const StridedPixelView<TColor>& view, uint32_t stride, uint32_t first = 0)
+{
+    return view.strided(stride, first);
+}
+
+template <typename TColor> inline StridedPixelView<TColor> reverseView(PixelView<TColor>& view)
+{
+    return StridedPixelView<TColor>(view).reversed();
+}
+
+template <typename TColor> inline StridedPixelView<TColor> reverseView(const StridedPixelView<TColor>& view)
+{
+    return view.reversed();
+}
+
+// Up to `count` pixels from `offset` on, without building a slice.
+template <typename TColor>
+inline StridedPixelView<TColor> offsetView(PixelView<TColor>& view, uint32_t offset, uint32_t count = UINT32_MAX)
+{
+    return StridedPixelView<TColor>(view).offset(offset, count);
+}
+
+template <typename TColor>
+inline StridedPixelView<TColor> offsetView(const StridedPixelView<TColor>& view, uint32_t offset,
+                                           uint32_t count = UINT32_MAX)
+{
+    return view.offset(offset, count);
+}
+
+// Lane `lane` of a strip whose pixels cycle through `laneCount` interleaved sub-strips,
+// e.g. the W pixels of an RGB, W, RGB, W layout are lane 1 of 2.
+template <typename TColor>
+inline StridedPixelView<TColor> interleaveView(PixelView<TColor>& view, uint32_t laneCount, uint32_t lane)
+{
+    return strideView(view, laneCount, lane);
+}
+
+template <typename TColor>
+inline StridedPixelView<TColor> interleaveView(const StridedPixelView<TColor>& view, uint32_t laneCount,
+                                               uint32_t lane)
+{
+    return view.strided(laneCount, lane);
+}
+
+} // namespace lw
@@ -0,0 +1,328 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "core/Compat.h"
+#include "core/PixelView.h"
+#include "core/PixelViewAdaptors.h"
+
+namespace lw
+{
+
+// Bulk operations over PixelView and StridedPixelView, one run at a time. A run never
+// crosses a chunk boundary, so when both sides are contiguous each step is a single
+// std::copy/std::fill_n (memmove/memset for trivially copyable colors) however the
+// view is split across strips. Strided and reversed runs fall back to a loop.
+
+template <typename T> struct IsPixelRunView : IsStridedPixelView<T>
+{
+};
+
+template <typename TColor> struct IsPixelRunView<PixelView<TColor>> : std::true_type
+{
+};
+
+namespace detail
+{
+
+template <typename TView>
+using EnableIfPixelRunView = std::enable_if_t<IsPixelRunView<lw::remove_cvref_t<TView>>::value>;
+
+// Rotations by at most this many pixels go through a stack buffer and one shift;
+// larger ones reverse in place instead.
+inline constexpr uint32_t RotateBlockPixels = 32;
+
+template <typename TColor> PixelRun<TColor*> pixelRunFrom(PixelView<TColor>& view, uint32_t index)
+{
+    const auto run = view.contiguousFrom(index);
+    return PixelRun<TColor*>{run.data(), static_cast<uint32_t>(run.size()), 1};
+}
+
+template <typename TColor> PixelRun<const TColor*> pixelRunFrom(const PixelView<TColor>& view, uint32_t index)
+{
+    const auto run = view.contiguousFrom(index);
+    return PixelRun<const TColor*>{run.data(), static_cast<uint32_t>(run.size()), 1};
+}
+
+template <typename TColor> PixelRun<TColor*> pixelRunBefore(PixelView<TColor>& view, uint32_t index)
+{
+    const auto run = view.contiguousBefore(index);
+    return PixelRun<TColor*>{run.data(), static_cast<uint32_t>(run.size()), 1};
+}
+
+template <typename TColor> PixelRun<const TColor*> pixelRunBefore(const PixelView<TColor>& view, uint32_t index)
+{
+    const auto run = view.contiguousBefore(index);
+    return PixelRun<const TColor*>{run.data(), static_cast<uint32_t>(run.size()), 1};
+}
+
+template <typename TView, typename = std::enable_if_t<IsStridedPixelView<lw::remove_cvref_t<TView>>::value>>
+auto pixelRunFrom(TView& view, uint32_t index)
+{
+    return view.runFrom(index);
+}
+
+template <typename TView, typename = std::enable_if_t<IsStridedPixelView<lw::remove_cvref_t<TView>>::value>>
+auto pixelRunBefore(TView& view, uint32_t index)
+{
+    return view.runBefore(index);
+}
+
+template <typename TPointer> PixelRun<TPointer> bufferRun(TPointer first, uint32_t count)
+{
+    return PixelRun<TPointer>{first, count, 1};
+}
+
+// Copies the first `count` pixels of `source` over those of `target`, front to back.
+template <typename TTarget, typename TSource>
+void copyRun(const PixelRun<TTarget>& target, const PixelRun<TSource>& source, uint32_t count)
+{
+    if (target.stride == 1 && source.stride == 1)
+    {
+        std::copy(source.first, source.first + count, target.first);
+        return;
+    }
+
+    for (uint32_t index = 0; index < count; ++index)
+    {
+        target[index] = source[index];
+    }
+}
+
+// Copies the last `count` pixels of `source` over the last of `target`, back to front.
+template <typename TTarget, typename TSource>
+void copyRunBackward(const PixelRun<TTarget>& target, const PixelRun<TSource>& source, uint32_t count)
+{
+    if (target.stride == 1 && source.stride == 1)
+    {
+        std::copy_backward(source.first + source.count - count, source.first + source.count,
+                           target.first + target.count);
+        return;
+    }
+
+    for (uint32_t index = 1; index <= count; ++index)
+    {
+        target[target.count - index] = source[source.count - index];
+    }
+}
+
+template <typename TView, typename TColor>
+void fillPixelRange(TView& pixels, uint32_t first, uint32_t last, const TColor& color)
+{
+    while (first < last)
+    {
+        const auto run = pixelRunFrom(pixels, first);
+        const uint32_t count = std::min(run.count, last - first);
+        if (run.stride == 1)
+        {
+            std::fill_n(run.first, count, color);
+        }
+        else
+        {
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                run[index] = color;
+            }
+        }
+        first += count;
+    }
+}
+
+// Front to back, so `destination` may start before `source` within the same view.
+template <typename TDestination, typename TSource>
+void copyRunsForward(TDestination& destination, uint32_t to, const TSource& source, uint32_t from, uint32_t count)
+{
+    while (count != 0)
+    {
+        const auto target = pixelRunFrom(destination, to);
+        const auto origin = pixelRunFrom(source, from);
+        const uint32_t run = std::min({count, target.count, origin.count});
+        copyRun(target, origin, run);
+        to += run;
+        from += run;
+        count -= run;
+    }
+}
+
+// Back to front from the given end indices, so `toEnd` may lie past `fromEnd` within
+// the same view.
+template <typename TView> void copyRunsBackward(TView& pixels, uint32_t toEnd, uint32_t fromEnd, uint32_t count)
+{
+    while (count != 0)
+    {
+        const auto target = pixelRunBefore(pixels, toEnd);
+        const auto origin = pixelRunBefore(pixels, fromEnd);
+        const uint32_t run = std::min({count, target.count, origin.count});
+        copyRunBackward(target, origin, run);
+        toEnd -= run;
+        fromEnd -= run;
+        count -= run;
+    }
+}
+
+template <typename TView, typename TColor>
+void copyRunsOut(const TView& pixels, uint32_t first, uint32_t count, TColor* destination)
+{
+    while (count != 0)
+    {
+        const auto origin = pixelRunFrom(pixels, first);
+        const uint32_t run = std::min(count, origin.count);
+        copyRun(bufferRun(destination, run), origin, run);
+        destination += run;
+        first += run;
+        count -= run;
+    }
+}
+
+template <typename TView, typename TColor>
+void copyRunsIn(TView& pixels, uint32_t first, const TColor* source, uint32_t count)
+{
+    while (count != 0)
+    {
+        const auto target = pixelRunFrom(pixels, first);
+        const uint32_t run = std::min(count, target.count);
+        copyRun(target, bufferRun(source, run), run);
+        source += run;
+        first += run;
+        count -= run;
+    }
+}
+
+template <typename TView> void reversePixelRange(TView& pixels, uint32_t first, uint32_t last)
+{
+    while (last - first > 1)
+    {
+        const auto front = pixelRunFrom(pixels, first);
+        const auto back = pixelRunBefore(pixels, last);
+        // At most half the range, so the two runs never overlap.
+        const uint32_t run = std::min({(last - first) / 2, front.count, back.count});
+        if (front.stride == 1 && back.stride == 1)
+        {
+            std::swap_ranges(front.first, front.first + run,
+                             std::make_reverse_iterator(back.first + back.count));
+        }
+        else
+        {
+            for (uint32_t index = 0; index < run; ++index)
+            {
+                using std::swap;
+                swap(front[index], back[back.count - 1 - index]);
+            }
+        }
+        first += run;
+        last -= run;
+    }
+}
+
+} // namespace detail
+
+// PixelView has its own chunk-wise fillPixels.
+template <typename TView, typename = std::enable_if_t<IsStridedPixelView<lw::remove_cvref_t<TView>>::value>>
+inline void fillPixels(TView&& pixels, const typename lw::remove_cvref_t<TView>::ColorType& solidColor)
+{
+    detail::fillPixelRange(pixels, 0, pixels.size(), solidColor);
+}
+
+// Copies as many pixels as both views hold, from the front, and returns that count.
+// The views must not share pixels; shift or rotate to move pixels within one view.
+template <typename TDestination, typename TSource, typename = detail::EnableIfPixelRunView<TDestination>,
+          typename = detail::EnableIfPixelRunView<TSource>>
+inline uint32_t copyPixels(TDestination&& destination, const TSource& source)
+{
+    const uint32_t count = std::min(destination.size(), source.size());
+    detail::copyRunsForward(destination, 0, source, 0, count);
+    return count;
+}
+
+template <typename TView, typename = detail::EnableIfPixelRunView<TView>>
+inline uint32_t copyPixelsFrom(TView&& destination, span<const typename lw::remove_cvref_t<TView>::ColorType> source)
+{
+    const uint32_t count = std::min(destination.size(), static_cast<uint32_t>(source.size()));
+    detail::copyRunsIn(destination, 0, source.data(), count);
+    return count;
+}
+
+// Moves every pixel `count` places toward index 0 and fills the vacated tail.
+template <typename TView, typename = detail::EnableIfPixelRunView<TView>>
+inline void shiftPixelsLeft(TView&& pixels, uint32_t count,
+                            const typename lw::remove_cvref_t<TView>::ColorType& fillColor)
+{
+    const uint32_t size = pixels.size();
+    count = std::min(count, size);
+    detail::copyRunsForward(pixels, 0, pixels, count, size - count);
+    detail::fillPixelRange(pixels, size - count, size, fillColor);
+}
+
+// Moves every pixel `count` places away from index 0 and fills the vacated head.
+template <typename TView, typename = detail::EnableIfPixelRunView<TView>>
+inline void shiftPixelsRight(TView&& pixels, uint32_t count,
+                             const typename lw::remove_cvref_t<TView>::ColorType& fillColor)
+{
+    const uint32_t size = pixels.size();
+    count = std::min(count, size);
+    detail::copyRunsBackward(pixels, size, size - count, size - count);
+    detail::fillPixelRange(pixels, 0, count, fillColor);
+}
+
+// As std::rotate: the pixel at `count` (modulo the size) becomes the first.
+template <typename TView, typename = detail::EnableIfPixelRunView<TView>>
+inline void rotatePixelsLeft(TView&& pixels, uint32_t count)
+{
+    const uint32_t size = pixels.size();
+    if (size == 0)
+    {
+        return;
+    }
+
+    count %= size;
+    if (count == 0)
+    {
+        return;
+    }
+
+    const uint32_t remainder = size - count;
+    std::array<typename lw::remove_cvref_t<TView>::ColorType, detail::RotateBlockPixels> saved{};
+
+    if (count <= detail::RotateBlockPixels)
+    {
+        detail::copyRunsOut(pixels, 0, count, saved.data());
+        detail::copyRunsForward(pixels, 0, pixels, count, remainder);
+        detail::copyRunsIn(pixels, remainder, saved.data(), count);
+    }
+    else if (remainder <= detail::RotateBlockPixels)
+    {
+        detail::copyRunsOut(pixels, count, remainder, saved.data());
+        detail::copyRunsBackward(pixels, size, count, count);
+        detail::copyRunsIn(pixels, 0, saved.data(), remainder);
+    }
+    else
+    {
+        detail::reversePixelRange(pixels, 0, count);
+        detail::reversePixelRange(pixels, count, size);
+        detail::reversePixelRange(pixels, 0, size);
+    }
+}
+
+// The last `count` pixels (modulo the size) move to the front.
+template <typename TView, typename = detail::EnableIfPixelRunView<TView>>
+inline void rotatePixelsRight(TView&& pixels, uint32_t count)
+{
+    const uint32_t size = pixels.size();
+    if (size != 0)
+    {
+        rotatePixelsLeft(pixels, size - (count % size));
+    }
+}
+
+template <typename TView, typename = detail::EnableIfPixelRunView<TView>> inline void reversePixels(TView&& pixels)
+{
+    detail::reversePixelRange(pixels, 0, pixels.size());
+}
+
+} // namespace lw
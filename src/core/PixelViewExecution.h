@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "core/Compat.h"
+#include "core/Executor.h"
+#include "core/PixelView.h"
+
+namespace lw
+{
+
+// Execution policies for the per-pixel generators of fillPixelsIndexed() and
+// fillPixelBatches(), after std::execution. Every policy cuts the view into the same
+// batches: a batch never crosses a chunk and ends at the latest on the next multiple of
+// LW_PIXEL_BATCH_PIXELS. Which batches exist depends only on the view, never on the
+// policy or the worker count, and every pixel is written once, so a generator that is
+// a function of its arguments gives the same frame under every policy.
+namespace execution
+{
+
+// Batches in index order on the calling thread; the generator may keep state between
+// calls.
+struct SequencedPolicy
+{
+};
+
+// Batches on the calling thread, with each batch's per-pixel loop marked free of
+// cross-iteration dependencies so the compiler may vectorise it. The generator must
+// not depend on the order of its calls.
+struct UnsequencedPolicy
+{
+};
+
+// Whole batches spread over `executor`, with at least `minTaskPixels` pixels per task.
+// The generator is called concurrently from several threads and must be safe for that.
+// A null executor runs unsequenced on the calling thread.
+struct ParallelPolicy
+{
+    IExecutor* executor{nullptr};
+    uint32_t minTaskPixels{4096};
+};
+
+inline constexpr SequencedPolicy seq{};
+inline constexpr UnsequencedPolicy unseq{};
+
+inline ParallelPolicy par(IExecutor& executor, uint32_t minTaskPixels = ParallelPolicy{}.minTaskPixels)
+{
+    return ParallelPolicy{&executor, minTaskPixels};
+}
+
+template <typename T> struct IsExecutionPolicy : std::false_type
+{
+};
+
+template <> struct IsExecutionPolicy<SequencedPolicy> : std::true_type
+{
+};
+
+template <> struct IsExecutionPolicy<UnsequencedPolicy> : std::true_type
+{
+};
+
+template <> struct IsExecutionPolicy<ParallelPolicy> : std::true_type
+{
+};
+
+} // namespace execution
+
+namespace detail
+{
+
+inline constexpr uint32_t PixelBatchPixels = LW_PIXEL_BATCH_PIXELS;
+
+// Tasks per worker, so the executor can even out generators whose cost varies along
+// the view.
+inline constexpr size_t ParallelTasksPerWorker = 4;
+
+template <typename TPolicy>
+using EnableIfExecutionPolicy = std::enable_if_t<execution::IsExecutionPolicy<lw::remove_cvref_t<TPolicy>>::value>;
+
+#if defined(__clang__)
+#define LW_DETAIL_UNSEQUENCED_LOOP _Pragma("clang loop vectorize(enable) interleave(enable)")
+#elif defined(__GNUC__)
+#define LW_DETAIL_UNSEQUENCED_LOOP _Pragma("GCC ivdep")
+#else
+#define LW_DETAIL_UNSEQUENCED_LOOP
+#endif
+
+// Calls `batch(firstIndex, pixels)` for the batches covering [first, last), in order.
+template <typename TColor, typename TBatch>
+void forEachPixelBatch(PixelView<TColor>& pixels, uint32_t first, uint32_t last, TBatch& batch)
+{
+    while (first < last)
+    {
+        const auto run = pixels.contiguousFrom(first);
+        const uint32_t batchEnd = first + PixelBatchPixels - (first % PixelBatchPixels);
+        uint32_t end = (batchEnd < last) ? batchEnd : last;
+        if (run.size() < end - first)
+        {
+            end = first + static_cast<uint32_t>(run.size());
+        }
+
+        batch(first, span<TColor>{run.data(), end - first});
+        first = end;
+    }
+}
+
+template <typename TColor, typename TBatch>
+void runPixelBatches(execution::SequencedPolicy, PixelView<TColor>& pixels, TBatch& batch)
+{
+    forEachPixelBatch(pixels, 0, pixels.size(), batch);
+}
+
+template <typename TColor, typename TBatch>
+void runPixelBatches(execution::UnsequencedPolicy, PixelView<TColor>& pixels, TBatch& batch)
+{
+    forEachPixelBatch(pixels, 0, pixels.size(), batch);
+}
+
+template <typename TColor, typename TBatch>
+void runPixelBatches(const execution::ParallelPolicy& policy, PixelView<TColor>& pixels, TBatch& batch)
+{
+    const uint32_t size = pixels.size();
+    const size_t workers = (policy.executor == nullptr) ? 1 : policy.executor->workerCount();
+    const uint32_t minTaskPixels = (policy.minTaskPixels == 0) ? 1 : policy.minTaskPixels;
+    if (workers < 2 || size <= minTaskPixels)
+    {
+        forEachPixelBatch(pixels, 0, size, batch);
+        return;
+    }
+
+    // Tasks start on batch boundaries, so they cut the view exactly where the
+    // sequential walk would.
+    const size_t wantedTasks = workers * ParallelTasksPerWorker;
+    const size_t usefulTasks = (static_cast<size_t>(size) + minTaskPixels - 1) / minTaskPixels;
+    const size_t taskCount = (wantedTasks < usefulTasks) ? wantedTasks : usefulTasks;
+    const size_t taskBatches =
+        (((static_cast<size_t>(size) + taskCount - 1) / taskCount) + PixelBatchPixels - 1) / PixelBatchPixels;
+    const size_t taskPixels = taskBatches * PixelBatchPixels;
+
+    parallelFor(policy.executor, (static_cast<size_t>(size) + taskPixels - 1) / taskPixels,
+                [&](size_t task)
+                {
+                    const size_t first = task * taskPixels;
+                    const size_t last = (size - first < taskPixels) ? size : first + taskPixels;
+                    forEachPixelBatch(pixels, static_cast<uint32_t>(first), static_cast<uint32_t>(last), batch);
+                });
+}
+
+} // namespace detail
+
+// Calls `generator(firstIndex, pixels)` once per batch of the view, where `pixels` is
+// a span of up to LW_PIXEL_BATCH_PIXELS pixels within one chunk, starting at view index
+// `firstIndex`, for the generator to fill.
+template <typename TPolicy, typename TColor, typename TGenerator, typename = detail::EnableIfExecutionPolicy<TPolicy>,
+          typename = std::enable_if_t<std::is_invocable<TGenerator&, uint32_t, span<TColor>>::value>>
+inline void fillPixelBatches(TPolicy&& policy, PixelView<TColor>& pixels, TGenerator&& generator)
+{
+    detail::runPixelBatches(policy, pixels, generator);
+}
+
+template <typename TColor, typename TGenerator,
+          typename = std::enable_if_t<std::is_invocable<TGenerator&, uint32_t, span<TColor>>::value>>
+inline void fillPixelBatches(PixelView<TColor>& pixels, TGenerator&& generator)
+{
+    fillPixelBatches(execution::seq, pixels, std::forward<TGenerator>(generator));
+}
+
+template <typename TColor, typename TGenerator,
+          typename = std::enable_if_t<std::is_invocable_r<TColor, TGenerator&, uint32_t>::value>>
+inline void fillPixelsIndexed(execution::SequencedPolicy, PixelView<TColor>& pixels, TGenerator&& generator)
+{
+    fillPixelsIndexed(pixels, generator);
+}
+
+// Unsequenced and parallel: each batch is one tight loop over chunk-local pointers.
+template <typename TPolicy, typename TColor, typename TGenerator, typename = detail::EnableIfExecutionPolicy<TPolicy>,
+          typename = std::enable_if_t<
+              !std::is_same<lw::remove_cvref_t<TPolicy>, execution::SequencedPolicy>::value &&
+              std::is_invocable_r<TColor, TGenerator&, uint32_t>::value>>
+inline void fillPixelsIndexed(TPolicy&& policy, PixelView<TColor>& pixels, TGenerator&& generator)
+{
+    auto batch = [&generator](uint32_t first, span<TColor> out)
+    {
+        TColor* pixel = out.data();
+        const uint32_t count = static_cast<uint32_t>(out.size());
+        LW_DETAIL_UNSEQUENCED_LOOP
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            pixel[index] = static_cast<TColor>(generator(first + index));
+        }
+    };
+    detail::runPixelBatches(policy, pixels, batch);
+}
+
+#undef LW_DETAIL_UNSEQUENCED_LOOP
+
+} // namespace lw
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace lw
+{
+
+// What showAsync() did with the frame.
+enum class ShowStatus : uint8_t
+{
+    // Handed to the transport, or encoded and held by a double-buffered bus until the
+    // transport is free; a later show sends a held frame.
+    Queued,
+    // Nothing changed since the last frame, so nothing was sent.
+    SkippedClean,
+    // The transport was still busy; the frame stays dirty and a later show sends it.
+    // The completion is not kept.
+    BusyDropped
+};
+
+// Runs once a queued frame is off the wire and the bus can take the next one. It is
+// called from the render loop or from a transport's completion task, never from an
+// interrupt handler, but may run on another task than showAsync(): keep it short,
+// set a flag or give a semaphore.
+struct ShowCompletion
+{
+    void (*callback)(void* context){nullptr};
+    void* context{nullptr};
+};
+
+namespace detail
+{
+
+// A completion waiting for its frame. Firing is atomic, so a transport's completion
+// task and the render loop racing to deliver it run the callback once. Moving it is not thread-safe.
+class PendingShowCompletion
+{
+  public:
+    PendingShowCompletion() = default;
+
+    PendingShowCompletion(PendingShowCompletion&& other) noexcept
+        : _completion{other._completion}, _armed{other._armed.load()}
+    {
+    }
+
+    PendingShowCompletion& operator=(PendingShowCompletion&& other) noexcept
+    {
+        _completion = other._completion;
+        _armed.store(other._armed.load());
+        return *this;
+    }
+
+    void arm(ShowCompletion completion)
+    {
+        if (completion.callback == nullptr)
+        {
+            return;
+        }
+
+        _completion = completion;
+        _armed.store(true);
+    }
+
+    bool armed() const { return _armed.load(); }
+
+    // Disarms without running the callback and returns it, or an empty completion.
+    ShowCompletion release()
+    {
+        if (!_armed.exchange(false))
+        {
+            return ShowCompletion{};
+        }
+
+        return _completion;
+    }
+
+    bool fire()
+    {
+        if (!_armed.exchange(false))
+        {
+            return false;
+        }
+
+        _completion.callback(_completion.context);
+        return true;
+    }
+
+  private:
+    ShowCompletion _completion{};
+    std::atomic<bool> _armed{false};
+};
+
+} // namespace detail
+
+} // namespace lw
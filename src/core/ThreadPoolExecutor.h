@@ -0,0 +1,181 @@
+#pragma once
+
+#include "core/Compat.h"
+#include "core/Executor.h"
+
+#if LW_HAS_THREAD_EXECUTOR
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lw
+{
+
+// std::thread pool for hosts. Each forEach() deals the index range out in contiguous
+// slices, one per worker; a worker that finishes its slice steals from the back of the
+// others', so uneven tasks still keep every worker busy. The calling thread works too.
+class ThreadPoolExecutor : public IExecutor
+{
+  public:
+    // `workerCount` includes the calling thread; 0 uses every hardware thread.
+    explicit ThreadPoolExecutor(size_t workerCount = 0)
+    {
+        if (workerCount == 0)
+        {
+            workerCount = std::thread::hardware_concurrency();
+        }
+
+        _queues = std::make_unique<Queue[]>((workerCount == 0) ? 1 : workerCount);
+        _workerCount = (workerCount == 0) ? 1 : workerCount;
+
+        _threads.reserve(_workerCount - 1);
+        for (size_t worker = 1; worker < _workerCount; ++worker)
+        {
+            _threads.emplace_back([this, worker]() { threadMain(worker); });
+        }
+    }
+
+    ~ThreadPoolExecutor() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+
+        _wake.notify_all();
+        for (auto& thread : _threads)
+        {
+            thread.join();
+        }
+    }
+
+    ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+    ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+    // Not reentrant: one forEach() at a time per pool.
+    void forEach(size_t count, TaskFunction task, void* context) override
+    {
+        if (count < 2 || _workerCount == 1)
+        {
+            InlineExecutor{}.forEach(count, task, context);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _task = task;
+            _context = context;
+            _remaining.store(count);
+
+            for (size_t worker = 0; worker < _workerCount; ++worker)
+            {
+                std::lock_guard<std::mutex> queueLock(_queues[worker].mutex);
+                _queues[worker].first = (count * worker) / _workerCount;
+                _queues[worker].end = (count * (worker + 1)) / _workerCount;
+            }
+
+            ++_generation;
+        }
+
+        _wake.notify_all();
+        runTasks(0);
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done.wait(lock, [this]() { return _remaining.load() == 0; });
+    }
+
+    size_t workerCount() const override { return _workerCount; }
+
+  private:
+    struct Queue
+    {
+        std::mutex mutex;
+        size_t first{0};
+        size_t end{0};
+    };
+
+    bool takeOwn(size_t worker, size_t& index)
+    {
+        Queue& queue = _queues[worker];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.first == queue.end)
+        {
+            return false;
+        }
+
+        index = queue.first++;
+        return true;
+    }
+
+    bool steal(size_t thief, size_t& index)
+    {
+        for (size_t offset = 1; offset < _workerCount; ++offset)
+        {
+            Queue& victim = _queues[(thief + offset) % _workerCount];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.first != victim.end)
+            {
+                index = --victim.end;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void runTasks(size_t worker)
+    {
+        size_t index = 0;
+        while (takeOwn(worker, index) || steal(worker, index))
+        {
+            _task(_context, index);
+
+            if (_remaining.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _done.notify_all();
+            }
+        }
+    }
+
+    void threadMain(size_t worker)
+    {
+        size_t seenGeneration = 0;
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _wake.wait(lock, [&]() { return _stopping || _generation != seenGeneration; });
+                if (_stopping)
+                {
+                    return;
+                }
+
+                seenGeneration = _generation;
+            }
+
+            runTasks(worker);
+        }
+    }
+
+    size_t _workerCount{1};
+    std::unique_ptr<Queue[]> _queues;
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _done;
+    TaskFunction _task{nullptr};
+    void* _context{nullptr};
+    std::atomic<size_t> _remaining{0};
+    size_t _generation{0};
+    bool _stopping{false};
+};
+
+} // namespace lw
+
+#endif
@@ -4,6 +4,8 @@
 #include <cstddef>
 #include <cstdint>
 
+#include "core/Compat.h"
+
 namespace lw
 {
 
@@ -144,11 +146,11 @@ inline constexpr GridMapping GridMapping::ColumnsFirstSerpentineDeg270 =
 
 struct TopologySettings
 {
-    uint16_t panelWidth;
-    uint16_t panelHeight;
+    PixelCount panelWidth;
+    PixelCount panelHeight;
     GridMapping layout;
-    uint16_t tilesWide;
-    uint16_t tilesHigh;
+    PixelCount tilesWide;
+    PixelCount tilesHigh;
     GridMapping tileLayout;
     bool mosaicRotation = false;
 };
@@ -158,17 +160,18 @@ class Topology
   public:
     static constexpr size_t InvalidIndex = static_cast<size_t>(-1);
 
-    static constexpr uint16_t mapLayout(GridMapping layout, uint16_t width, uint16_t height, uint16_t x, uint16_t y)
+    static constexpr PixelCount mapLayout(GridMapping layout, PixelCount width, PixelCount height, PixelCount x,
+                                          PixelCount y)
     {
         const auto [axisOrder, linePattern, quarterTurn] = layout.unpack();
         const bool columnMajor = axisOrder == GridMapping::AxisOrder::ColumnsFirst;
         const bool alternating = linePattern == GridMapping::LinePattern::Serpentine;
         const uint8_t rotation = static_cast<uint8_t>(quarterTurn);
 
-        uint16_t rx = x;
-        uint16_t ry = y;
-        uint16_t rw = width;
-        uint16_t rh = height;
+        PixelCount rx = x;
+        PixelCount ry = y;
+        PixelCount rw = width;
+        PixelCount rh = height;
 
         switch (rotation)
         {
@@ -177,18 +180,18 @@ class Topology
 
             case 1:
                 rx = y;
-                ry = static_cast<uint16_t>(width - 1 - x);
+                ry = static_cast<PixelCount>(width - 1 - x);
                 rw = height;
                 rh = width;
                 break;
 
             case 2:
-                rx = static_cast<uint16_t>(width - 1 - x);
-                ry = static_cast<uint16_t>(height - 1 - y);
+                rx = static_cast<PixelCount>(width - 1 - x);
+                ry = static_cast<PixelCount>(height - 1 - y);
                 break;
 
             case 3:
-                rx = static_cast<uint16_t>(height - 1 - y);
+                rx = static_cast<PixelCount>(height - 1 - y);
                 ry = x;
                 rw = height;
                 rh = width;
@@ -200,22 +203,22 @@ class Topology
 
         if (!columnMajor)
         {
-            const uint16_t rowBase = static_cast<uint16_t>(ry * rw);
+            const PixelCount rowBase = static_cast<PixelCount>(ry * rw);
             if (!alternating)
             {
-                return static_cast<uint16_t>(rowBase + rx);
+                return static_cast<PixelCount>(rowBase + rx);
             }
 
-            return (ry & 1) ? static_cast<uint16_t>(rowBase + (rw - 1 - rx)) : static_cast<uint16_t>(rowBase + rx);
+            return (ry & 1) ? static_cast<PixelCount>(rowBase + (rw - 1 - rx)) : static_cast<PixelCount>(rowBase + rx);
         }
 
-        const uint16_t colBase = static_cast<uint16_t>(rx * rh);
+        const PixelCount colBase = static_cast<PixelCount>(rx * rh);
         if (!alternating)
         {
-            return static_cast<uint16_t>(colBase + ry);
+            return static_cast<PixelCount>(colBase + ry);
         }
 
-        return (rx & 1) ? static_cast<uint16_t>(colBase + (rh - 1 - ry)) : static_cast<uint16_t>(colBase + ry);
+        return (rx & 1) ? static_cast<PixelCount>(colBase + (rh - 1 - ry)) : static_cast<PixelCount>(colBase + ry);
     }
 
     // Returns the preferred per-tile mapping orientation for a tile position.
@@ -258,7 +261,7 @@ class Topology
     static constexpr Topology linear(size_t length)
     {
         return Topology{
-            TopologySettings{static_cast<uint16_t>(length), 1,
+            TopologySettings{static_cast<PixelCount>(length), 1,
                              GridMapping::make(GridMapping::AxisOrder::RowsFirst, GridMapping::LinePattern::Progressive,
                                                GridMapping::QuarterTurn::None),
                              1, 1,
@@ -273,39 +276,39 @@ class Topology
     {
     }
 
-    constexpr uint16_t width() const { return _config.panelWidth * _config.tilesWide; }
+    constexpr PixelCount width() const { return static_cast<PixelCount>(_config.panelWidth * _config.tilesWide); }
 
-    constexpr uint16_t height() const { return _config.panelHeight * _config.tilesHigh; }
+    constexpr PixelCount height() const { return static_cast<PixelCount>(_config.panelHeight * _config.tilesHigh); }
 
     constexpr size_t pixelCount() const { return _pixelCount; }
 
-    constexpr bool isInBounds(int16_t x, int16_t y) const
+    constexpr bool isInBounds(int32_t x, int32_t y) const
     {
-        return x >= 0 && y >= 0 && x < static_cast<int16_t>(width()) && y < static_cast<int16_t>(height());
+        return x >= 0 && y >= 0 && static_cast<uint32_t>(x) < width() && static_cast<uint32_t>(y) < height();
     }
 
-    constexpr size_t map(int16_t x, int16_t y) const
+    constexpr size_t map(int32_t x, int32_t y) const
     {
         if (!isInBounds(x, y) || _config.panelWidth == 0 || _config.panelHeight == 0)
         {
             return InvalidIndex;
         }
 
-        uint16_t px = static_cast<uint16_t>(x);
-        uint16_t py = static_cast<uint16_t>(y);
+        PixelCount px = static_cast<PixelCount>(x);
+        PixelCount py = static_cast<PixelCount>(y);
 
-        uint16_t tileX = px / _config.panelWidth;
-        uint16_t localX = px % _config.panelWidth;
-        uint16_t tileY = py / _config.panelHeight;
-        uint16_t localY = py % _config.panelHeight;
+        PixelCount tileX = px / _config.panelWidth;
+        PixelCount localX = px % _config.panelWidth;
+        PixelCount tileY = py / _config.panelHeight;
+        PixelCount localY = py % _config.panelHeight;
 
-        uint16_t tileIndex = mapLayout(_config.tileLayout, _config.tilesWide, _config.tilesHigh, tileX, tileY);
+        PixelCount tileIndex = mapLayout(_config.tileLayout, _config.tilesWide, _config.tilesHigh, tileX, tileY);
 
         const bool isOddTileRow = (tileY & 1) != 0;
         const bool isOddTileColumn = (tileX & 1) != 0;
         const GridMapping effectiveLayout = _effectiveLayoutByTileParity[parityIndex(isOddTileRow, isOddTileColumn)];
 
-        uint16_t localIndex = mapLayout(effectiveLayout, _config.panelWidth, _config.panelHeight, localX, localY);
+        PixelCount localIndex = mapLayout(effectiveLayout, _config.panelWidth, _config.panelHeight, localX, localY);
 
         size_t panelPixels = static_cast<size_t>(_config.panelWidth) * _config.panelHeight;
         return static_cast<size_t>(tileIndex) * panelPixels + localIndex;
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "core/Compat.h"
+
+namespace lw::protocols
+{
+
+// Native accumulator width: 64-bit hosts batch more fields between flushes.
+using BitStreamWord = std::conditional_t<(sizeof(void*) >= sizeof(uint64_t)), uint64_t, uint32_t>;
+
+// MSB-first bit-stream writer for protocols whose fields are not byte aligned.
+//
+// Fields are shifted into a register-sized accumulator and only drained to the output
+// once the next field would not fit, so each output byte is stored exactly once and no
+// read-modify-write of the buffer is needed. A single `write` takes up to
+// `MaxFieldBits` bits. Writes past the end of the output are dropped.
+template <typename TWord = BitStreamWord> class BitStreamWriter
+{
+  public:
+    static_assert(std::is_unsigned<TWord>::value, "BitStreamWriter word must be unsigned.");
+
+    static constexpr uint8_t WordBits = static_cast<uint8_t>(sizeof(TWord) * 8);
+    // At most 7 bits remain pending after a drain.
+    static constexpr uint8_t MaxFieldBits = (WordBits - 7 < 32) ? (WordBits - 7) : 32;
+
+    explicit BitStreamWriter(span<uint8_t> output)
+        : _begin{output.data()}, _out{output.data()}, _end{output.data() + output.size()}
+    {
+    }
+
+    // Appends the low `bitCount` bits of `value`, most significant first.
+    void write(uint32_t value, uint8_t bitCount)
+    {
+        if (static_cast<uint8_t>(_pendingBits + bitCount) > WordBits)
+        {
+            drain();
+        }
+
+        const TWord mask = (static_cast<TWord>(1) << bitCount) - 1;
+        _accumulator = (_accumulator << bitCount) | (static_cast<TWord>(value) & mask);
+        _pendingBits = static_cast<uint8_t>(_pendingBits + bitCount);
+    }
+
+    void writeZeros(size_t bitCount)
+    {
+        // Top up to a byte boundary, then store whole zero bytes directly.
+        const uint8_t align = static_cast<uint8_t>((8 - (_pendingBits & 7u)) & 7u);
+        if (bitCount < static_cast<size_t>(align) + 8)
+        {
+            writeSmallZeros(bitCount);
+            return;
+        }
+
+        write(0, align);
+        drain();
+        bitCount -= align;
+
+        const size_t bytes = std::min(bitCount / 8, static_cast<size_t>(_end - _out));
+        std::memset(_out, 0, bytes);
+        _out += bytes;
+        writeSmallZeros(bitCount % 8);
+    }
+
+    // Pads the final partial byte with zero bits and stores it. Returns the number of
+    // bytes written.
+    size_t finish()
+    {
+        const uint8_t padding = static_cast<uint8_t>((8 - (_pendingBits & 7u)) & 7u);
+        write(0, padding);
+        drain();
+        return static_cast<size_t>(_out - _begin);
+    }
+
+  private:
+    void drain()
+    {
+        while (_pendingBits >= 8)
+        {
+            _pendingBits = static_cast<uint8_t>(_pendingBits - 8);
+            if (_out != _end)
+            {
+                *_out++ = static_cast<uint8_t>(_accumulator >> _pendingBits);
+            }
+        }
+    }
+
+    void writeSmallZeros(size_t bitCount)
+    {
+        while (bitCount > 0)
+        {
+            const uint8_t chunk = static_cast<uint8_t>((bitCount < MaxFieldBits) ? bitCount : MaxFieldBits);
+            write(0, chunk);
+            bitCount -= chunk;
+        }
+    }
+
+    uint8_t* _begin;
+    uint8_t* _out;
+    uint8_t* _end;
+    TWord _accumulator{0};
+    uint8_t _pendingBits{0};
+};
+
+} // namespace lw::protocols
@@ -53,7 +53,7 @@ class DebugProtocol : public ProtocolDecoratorBase<DebugProtocol<TWrappedProtoco
     }
 
     DebugProtocol(PixelCount pixelCount, SettingsType settings)
-        : BaseType(pixelCount, TWrappedProtocol{pixelCount, settings.wrapped}, std::move(settings))
+        : BaseType(pixelCount, TWrappedProtocol(pixelCount, settings.wrapped), std::move(settings))
     {
     }
 
@@ -64,7 +64,7 @@ class DebugProtocol : public ProtocolDecoratorBase<DebugProtocol<TWrappedProtoco
         {
             writeText("[PROTOCOL] begin pixelCount=");
 
-            char countBuffer[8]{};
+            char countBuffer[12]{};
             const size_t countLength =
                 formatUnsignedDecimal(countBuffer, sizeof(countBuffer), static_cast<unsigned long>(this->pixelCount()));
             if (countLength > 0)
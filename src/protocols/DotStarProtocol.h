@@ -4,8 +4,10 @@
 #include <cstddef>
 #include <type_traits>
 #include <algorithm>
+#include <array>
 
 #include "IProtocol.h"
+#include "ProtocolChannelOrder.h"
 #include "colors/Color.h"
 
 namespace lw::protocols
@@ -13,10 +15,12 @@ namespace lw::protocols
 struct Apa102ProtocolSettings : public ProtocolSettings
 {
     const char* channelOrder = ChannelOrder::BGR::value;
+    // Per-pixel 5-bit brightness instead of a fixed 0xFF header; see DotStarHdr.
+    bool highDynamicRange = false;
 
     template <typename TColor>
-    static Apa102ProtocolSettings normalizeForColor(Apa102ProtocolSettings settings,
-                                                    const char* defaultChannelOrder = ChannelOrder::BGR::value)
+    static constexpr Apa102ProtocolSettings
+    normalizeForColor(Apa102ProtocolSettings settings, const char* defaultChannelOrder = ChannelOrder::BGR::value)
     {
         settings.channelOrder = lw::detail::normalizeChannelOrderForCount(settings.channelOrder, defaultChannelOrder,
                                                                           static_cast<size_t>(TColor::ChannelCount));
@@ -27,10 +31,12 @@ struct Apa102ProtocolSettings : public ProtocolSettings
 struct Hd108ProtocolSettings : public ProtocolSettings
 {
     const char* channelOrder = ChannelOrder::BGR::value;
+    // Per-pixel 5-bit current gain instead of a fixed 0xFFFF header; see DotStarHdr.
+    bool highDynamicRange = false;
 
     template <typename TColor>
-    static Hd108ProtocolSettings normalizeForColor(Hd108ProtocolSettings settings,
-                                                   const char* defaultChannelOrder = ChannelOrder::BGR::value)
+    static constexpr Hd108ProtocolSettings normalizeForColor(Hd108ProtocolSettings settings,
+                                                             const char* defaultChannelOrder = ChannelOrder::BGR::value)
     {
         settings.channelOrder = lw::detail::normalizeChannelOrderForCount(settings.channelOrder, defaultChannelOrder,
                                                                           static_cast<size_t>(TColor::ChannelCount));
@@ -38,13 +44,96 @@ struct Hd108ProtocolSettings : public ProtocolSettings
     }
 };
 
-template <typename TInterfaceColor = Rgb8Color, typename TStripColor = TInterfaceColor>
+namespace detail
+{
+
+static constexpr uint8_t DotStarHdrMaxLevel = 31;
+
+// Fixed-point `pwmMax * 31 / (level * 0xFFFF)`, indexed by level.
+constexpr std::array<uint32_t, DotStarHdrMaxLevel + 1> makeDotStarHdrScaleTable(uint32_t pwmMax, uint8_t shift)
+{
+    std::array<uint32_t, DotStarHdrMaxLevel + 1> scales{};
+    for (uint64_t level = 1; level <= DotStarHdrMaxLevel; ++level)
+    {
+        const uint64_t numerator = (static_cast<uint64_t>(pwmMax) * DotStarHdrMaxLevel) << shift;
+        const uint64_t denominator = level * 0xFFFFu;
+        scales[level] = static_cast<uint32_t>((numerator + (denominator / 2)) / denominator);
+    }
+
+    return scales;
+}
+
+// High dynamic range serialization for strips with a per-pixel 5-bit global field.
+//
+// Output intensity is `(level / 31) * (pwm / pwmMax)`. For each pixel the smallest
+// level that can still represent its brightest channel is chosen, and every PWM value is
+// scaled up by `31 / level`. Dim pixels therefore use the full PWM range at a low drive
+// level, which on APA102 yields roughly 13 bits of range from 8-bit PWM. Both steps are
+// table lookups plus one multiply per channel.
+struct DotStarHdr
+{
+    static constexpr uint8_t MaxLevel = DotStarHdrMaxLevel;
+    static constexpr uint8_t Pwm8ScaleShift = 23;
+    static constexpr uint8_t Pwm16ScaleShift = 15;
+
+    // Smallest level covering every 16-bit value with this high byte.
+    static constexpr std::array<uint8_t, 256> LevelForHighByte = []()
+    {
+        std::array<uint8_t, 256> levels{};
+        for (uint32_t high = 0; high < 256; ++high)
+        {
+            const uint32_t ceiling = (high << 8) | 0xFFu;
+            levels[high] = static_cast<uint8_t>(((ceiling * MaxLevel) + 0xFFFEu) / 0xFFFFu);
+        }
+
+        return levels;
+    }();
+
+    static constexpr std::array<uint32_t, MaxLevel + 1> Pwm8Scale = makeDotStarHdrScaleTable(0xFFu, Pwm8ScaleShift);
+    static constexpr std::array<uint32_t, MaxLevel + 1> Pwm16Scale =
+        makeDotStarHdrScaleTable(0xFFFFu, Pwm16ScaleShift);
+
+    static constexpr uint8_t levelFor(uint16_t brightest) { return LevelForHighByte[brightest >> 8]; }
+
+    static constexpr uint8_t scaleTo8(uint16_t value, uint8_t level)
+    {
+        const uint32_t scaled = ((value * Pwm8Scale[level]) + (1u << (Pwm8ScaleShift - 1))) >> Pwm8ScaleShift;
+        return static_cast<uint8_t>((scaled > 0xFFu) ? 0xFFu : scaled);
+    }
+
+    static constexpr uint16_t scaleTo16(uint16_t value, uint8_t level)
+    {
+        const uint32_t scaled = ((value * Pwm16Scale[level]) + (1u << (Pwm16ScaleShift - 1))) >> Pwm16ScaleShift;
+        return static_cast<uint16_t>((scaled > 0xFFFFu) ? 0xFFFFu : scaled);
+    }
+
+    template <typename TComponent> static constexpr uint16_t widen(TComponent value)
+    {
+        if constexpr (std::is_same<TComponent, uint8_t>::value)
+        {
+            return static_cast<uint16_t>((static_cast<uint16_t>(value) << 8) | static_cast<uint16_t>(value));
+        }
+
+        return static_cast<uint16_t>(value);
+    }
+};
+
+} // namespace detail
+
+template <typename TInterfaceColor = Rgb8Color, typename TStripColor = TInterfaceColor,
+          typename TChannelOrder = DynamicChannelOrder>
 class Apa102Protocol : public IProtocol<TInterfaceColor>
 {
   public:
     using SettingsType = Apa102ProtocolSettings;
     using InterfaceColorType = TInterfaceColor;
     using StripColorType = TStripColor;
+    using ChannelOrderType = TChannelOrder;
+
+    static constexpr bool SupportsPartialUpdate = true;
+    static constexpr bool SupportsFusedShading = true;
+    // Downstream pixels see the zero end frame as a start frame and keep their color.
+    static constexpr bool SupportsTruncation = true;
 
     static_assert((std::is_same<typename InterfaceColorType::ComponentType, uint8_t>::value ||
                    std::is_same<typename InterfaceColorType::ComponentType, uint16_t>::value),
@@ -55,6 +144,8 @@ class Apa102Protocol : public IProtocol<TInterfaceColor>
                   "Apa102Protocol interface color requires channel count in [3, 5].");
     static_assert(StripColorType::ChannelCount >= 3 && StripColorType::ChannelCount <= 5,
                   "Apa102Protocol strip color requires channel count in [3, 5].");
+    static_assert(ChannelOrderCovers<TChannelOrder, StripColorType::ChannelCount>::value,
+                  "Apa102Protocol channel order must name every strip channel.");
 
     static constexpr size_t requiredBufferSize(PixelCount pixelCount, const SettingsType&)
     {
@@ -71,6 +162,12 @@ class Apa102Protocol : public IProtocol<TInterfaceColor>
     void begin() override {}
 
     void update(span<const InterfaceColorType> colors, span<uint8_t> buffer = span<uint8_t>{}) override
+    {
+        updateShaded(colors, buffer, NoShade{});
+    }
+
+    template <typename TShade>
+    void updateShaded(span<const InterfaceColorType> colors, span<uint8_t> buffer, TShade&& shade)
     {
         if (buffer.size() < _requiredBufferSize)
         {
@@ -83,20 +180,38 @@ class Apa102Protocol : public IProtocol<TInterfaceColor>
         std::fill(_byteBuffer.begin(), _byteBuffer.begin() + StartFrameSize, 0x00);
         std::fill(_byteBuffer.end() - (EndFrameFixedSize + extraEndBytes), _byteBuffer.end(), 0x00);
 
-        size_t offset = StartFrameSize;
-        const size_t pixelLimit = std::min(colors.size(), static_cast<size_t>(this->pixelCount()));
-        const char* effectiveChannelOrder =
-            (_settings.channelOrder != nullptr) ? _settings.channelOrder : ChannelOrder::BGR::value;
+        encodeRange(colors, 0, colors.size(), shade);
+    }
 
-        for (size_t index = 0; index < pixelLimit; ++index)
+    // Re-encodes pixels [firstPixel, endPixel) in place inside a complete frame.
+    void updateRange(span<const InterfaceColorType> colors, span<uint8_t> buffer, size_t firstPixel, size_t endPixel)
+    {
+        updateRangeShaded(colors, buffer, firstPixel, endPixel, NoShade{});
+    }
+
+    template <typename TShade>
+    void updateRangeShaded(span<const InterfaceColorType> colors, span<uint8_t> buffer, size_t firstPixel,
+                           size_t endPixel, TShade&& shade)
+    {
+        if (buffer.size() < _requiredBufferSize)
         {
-            const auto& color = colors[index];
-            _byteBuffer[offset++] = 0xFF;
-            for (size_t channel = 0; channel < StripChannelCount; ++channel)
-            {
-                _byteBuffer[offset++] = toStripComponent(color[effectiveChannelOrder[channel]]);
-            }
+            return;
         }
+
+        _byteBuffer = span<uint8_t>{buffer.data(), _requiredBufferSize};
+        encodeRange(colors, firstPixel, endPixel, shade);
+    }
+
+    size_t truncatedPayloadSize(size_t pixelCount) const
+    {
+        return StartFrameSize + (std::min(pixelCount, static_cast<size_t>(this->pixelCount())) * BytesPerPixel);
+    }
+
+    // The end frame needs one extra clock byte per 16 pixels actually sent.
+    size_t truncatedLatchSize(size_t pixelCount) const
+    {
+        const size_t pixels = std::min(pixelCount, static_cast<size_t>(this->pixelCount()));
+        return EndFrameFixedSize + ((pixels + 15u) / 16u);
     }
 
     ProtocolSettings& settings() override { return _settings; }
@@ -107,6 +222,7 @@ class Apa102Protocol : public IProtocol<TInterfaceColor>
 
   private:
     static constexpr size_t StripChannelCount = StripColorType::ChannelCount;
+    using ChannelMapType = ChannelIndexMap<InterfaceColorType, TChannelOrder, StripChannelCount>;
     static constexpr size_t BytesPerPixel = 1 + StripChannelCount;
     static constexpr size_t StartFrameSize = 4;
     static constexpr size_t EndFrameFixedSize = 4;
@@ -121,18 +237,80 @@ class Apa102Protocol : public IProtocol<TInterfaceColor>
         return static_cast<uint8_t>(value >> 8);
     }
 
+    template <typename TShade>
+    void encodeRange(span<const InterfaceColorType> colors, size_t firstPixel, size_t endPixel, TShade& shade)
+    {
+        const size_t pixelLimit = std::min(std::min(endPixel, colors.size()), static_cast<size_t>(this->pixelCount()));
+        if (firstPixel >= pixelLimit)
+        {
+            return;
+        }
+
+        const ChannelMapType channels{
+            (_settings.channelOrder != nullptr) ? _settings.channelOrder : ChannelOrder::BGR::value};
+        forEachShadedBlock(span<const InterfaceColorType>{colors.data() + firstPixel, pixelLimit - firstPixel}, shade,
+                           [&](span<const InterfaceColorType> block, size_t offset)
+                           { encodePixels(block, channels, firstPixel + offset); });
+    }
+
+    // Writes `pixels` as pixels [firstPixel, firstPixel + pixels.size()) of the frame.
+    void encodePixels(span<const InterfaceColorType> pixels, const ChannelMapType& channels, size_t firstPixel)
+    {
+        size_t offset = StartFrameSize + (firstPixel * BytesPerPixel);
+        if (_settings.highDynamicRange)
+        {
+            encodePixelsHdr(pixels, channels, offset);
+            return;
+        }
+
+        for (const auto& color : pixels)
+        {
+            _byteBuffer[offset++] = 0xFF;
+            for (size_t channel = 0; channel < channels.size(); ++channel)
+            {
+                _byteBuffer[offset++] = toStripComponent(color.channelAtIndex(channels[channel]));
+            }
+        }
+    }
+
+    void encodePixelsHdr(span<const InterfaceColorType> pixels, const ChannelMapType& channels, size_t offset)
+    {
+        std::array<uint16_t, StripChannelCount> values{};
+        for (const auto& color : pixels)
+        {
+            uint16_t brightest = 0;
+            for (size_t channel = 0; channel < channels.size(); ++channel)
+            {
+                values[channel] = detail::DotStarHdr::widen(color.channelAtIndex(channels[channel]));
+                brightest = std::max(brightest, values[channel]);
+            }
+
+            const uint8_t level = detail::DotStarHdr::levelFor(brightest);
+            _byteBuffer[offset++] = static_cast<uint8_t>(0xE0 | level);
+            for (size_t channel = 0; channel < channels.size(); ++channel)
+            {
+                _byteBuffer[offset++] = detail::DotStarHdr::scaleTo8(values[channel], level);
+            }
+        }
+    }
+
     SettingsType _settings;
     size_t _requiredBufferSize{0};
     span<uint8_t> _byteBuffer{};
 };
 
-template <typename TInterfaceColor = Rgb8Color, typename TStripColor = Rgb16Color>
+template <typename TInterfaceColor = Rgb8Color, typename TStripColor = Rgb16Color,
+          typename TChannelOrder = DynamicChannelOrder>
 class Hd108Protocol : public IProtocol<TInterfaceColor>
 {
   public:
     using SettingsType = Hd108ProtocolSettings;
     using InterfaceColorType = TInterfaceColor;
     using StripColorType = TStripColor;
+    using ChannelOrderType = TChannelOrder;
+
+    static constexpr bool SupportsPartialUpdate = true;
+    static constexpr bool SupportsFusedShading = true;
 
     static_assert((std::is_same<typename InterfaceColorType::ComponentType, uint8_t>::value ||
                    std::is_same<typename InterfaceColorType::ComponentType, uint16_t>::value),
@@ -143,6 +321,8 @@ class Hd108Protocol : public IProtocol<TInterfaceColor>
                   "Hd108Protocol interface color requires channel count in [3, 5].");
     static_assert(StripColorType::ChannelCount >= 3 && StripColorType::ChannelCount <= 5,
                   "Hd108Protocol strip color requires channel count in [3, 5].");
+    static_assert(ChannelOrderCovers<TChannelOrder, StripColorType::ChannelCount>::value,
+                  "Hd108Protocol channel order must name every strip channel.");
 
     static constexpr size_t requiredBufferSize(PixelCount pixelCount, const SettingsType&)
     {
@@ -158,6 +338,12 @@ class Hd108Protocol : public IProtocol<TInterfaceColor>
     void begin() override {}
 
     void update(span<const InterfaceColorType> colors, span<uint8_t> buffer = span<uint8_t>{}) override
+    {
+        updateShaded(colors, buffer, NoShade{});
+    }
+
+    template <typename TShade>
+    void updateShaded(span<const InterfaceColorType> colors, span<uint8_t> buffer, TShade&& shade)
     {
         if (buffer.size() < _requiredBufferSize)
         {
@@ -169,24 +355,26 @@ class Hd108Protocol : public IProtocol<TInterfaceColor>
         std::fill(_byteBuffer.begin(), _byteBuffer.begin() + StartFrameSize, 0x00);
         std::fill(_byteBuffer.end() - EndFrameSize, _byteBuffer.end(), 0xFF);
 
-        size_t offset = StartFrameSize;
-        const size_t pixelLimit = std::min(colors.size(), static_cast<size_t>(this->pixelCount()));
-        const char* effectiveChannelOrder =
-            (_settings.channelOrder != nullptr) ? _settings.channelOrder : ChannelOrder::BGR::value;
+        encodeRange(colors, 0, colors.size(), shade);
+    }
+
+    // Re-encodes pixels [firstPixel, endPixel) in place inside a complete frame.
+    void updateRange(span<const InterfaceColorType> colors, span<uint8_t> buffer, size_t firstPixel, size_t endPixel)
+    {
+        updateRangeShaded(colors, buffer, firstPixel, endPixel, NoShade{});
+    }
 
-        for (size_t index = 0; index < pixelLimit; ++index)
+    template <typename TShade>
+    void updateRangeShaded(span<const InterfaceColorType> colors, span<uint8_t> buffer, size_t firstPixel,
+                           size_t endPixel, TShade&& shade)
+    {
+        if (buffer.size() < _requiredBufferSize)
         {
-            const auto& color = colors[index];
-            _byteBuffer[offset++] = 0xFF;
-            _byteBuffer[offset++] = 0xFF;
-
-            for (size_t channel = 0; channel < StripChannelCount; ++channel)
-            {
-                const uint16_t value = toStripComponent(color[effectiveChannelOrder[channel]]);
-                _byteBuffer[offset++] = static_cast<uint8_t>(value >> 8);
-                _byteBuffer[offset++] = static_cast<uint8_t>(value & 0xFF);
-            }
+            return;
         }
+
+        _byteBuffer = span<uint8_t>{buffer.data(), _requiredBufferSize};
+        encodeRange(colors, firstPixel, endPixel, shade);
     }
 
     ProtocolSettings& settings() override { return _settings; }
@@ -197,6 +385,7 @@ class Hd108Protocol : public IProtocol<TInterfaceColor>
 
   private:
     static constexpr size_t StripChannelCount = StripColorType::ChannelCount;
+    using ChannelMapType = ChannelIndexMap<InterfaceColorType, TChannelOrder, StripChannelCount>;
     static constexpr size_t BytesPerPixel = 2 + (StripChannelCount * 2);
     static constexpr size_t StartFrameSize = 16;
     static constexpr size_t EndFrameSize = 4;
@@ -211,6 +400,73 @@ class Hd108Protocol : public IProtocol<TInterfaceColor>
         return static_cast<uint16_t>((static_cast<uint16_t>(value) << 8) | static_cast<uint16_t>(value));
     }
 
+    template <typename TShade>
+    void encodeRange(span<const InterfaceColorType> colors, size_t firstPixel, size_t endPixel, TShade& shade)
+    {
+        const size_t pixelLimit = std::min(std::min(endPixel, colors.size()), static_cast<size_t>(this->pixelCount()));
+        if (firstPixel >= pixelLimit)
+        {
+            return;
+        }
+
+        const ChannelMapType channels{
+            (_settings.channelOrder != nullptr) ? _settings.channelOrder : ChannelOrder::BGR::value};
+        forEachShadedBlock(span<const InterfaceColorType>{colors.data() + firstPixel, pixelLimit - firstPixel}, shade,
+                           [&](span<const InterfaceColorType> block, size_t offset)
+                           { encodePixels(block, channels, firstPixel + offset); });
+    }
+
+    // Writes `pixels` as pixels [firstPixel, firstPixel + pixels.size()) of the frame.
+    void encodePixels(span<const InterfaceColorType> pixels, const ChannelMapType& channels, size_t firstPixel)
+    {
+        size_t offset = StartFrameSize + (firstPixel * BytesPerPixel);
+        if (_settings.highDynamicRange)
+        {
+            encodePixelsHdr(pixels, channels, offset);
+            return;
+        }
+
+        for (const auto& color : pixels)
+        {
+            _byteBuffer[offset++] = 0xFF;
+            _byteBuffer[offset++] = 0xFF;
+
+            for (size_t channel = 0; channel < channels.size(); ++channel)
+            {
+                const uint16_t value = toStripComponent(color.channelAtIndex(channels[channel]));
+                _byteBuffer[offset++] = static_cast<uint8_t>(value >> 8);
+                _byteBuffer[offset++] = static_cast<uint8_t>(value & 0xFF);
+            }
+        }
+    }
+
+    // The same gain is written to all three current fields.
+    void encodePixelsHdr(span<const InterfaceColorType> pixels, const ChannelMapType& channels, size_t offset)
+    {
+        std::array<uint16_t, StripChannelCount> values{};
+        for (const auto& color : pixels)
+        {
+            uint16_t brightest = 0;
+            for (size_t channel = 0; channel < channels.size(); ++channel)
+            {
+                values[channel] = toStripComponent(color.channelAtIndex(channels[channel]));
+                brightest = std::max(brightest, values[channel]);
+            }
+
+            const uint8_t level = detail::DotStarHdr::levelFor(brightest);
+            const uint16_t header = static_cast<uint16_t>(0x8000u | (level << 10) | (level << 5) | level);
+            _byteBuffer[offset++] = static_cast<uint8_t>(header >> 8);
+            _byteBuffer[offset++] = static_cast<uint8_t>(header & 0xFF);
+
+            for (size_t channel = 0; channel < channels.size(); ++channel)
+            {
+                const uint16_t value = detail::DotStarHdr::scaleTo16(values[channel], level);
+                _byteBuffer[offset++] = static_cast<uint8_t>(value >> 8);
+                _byteBuffer[offset++] = static_cast<uint8_t>(value & 0xFF);
+            }
+        }
+    }
+
     SettingsType _settings;
     size_t _requiredBufferSize{0};
     span<uint8_t> _byteBuffer{};
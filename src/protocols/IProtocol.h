@@ -7,6 +7,7 @@
 
 #include "colors/Color.h"
 #include "core/Compat.h"
+#include "protocols/ShadedBlocks.h"
 namespace lw::protocols
 {
 
@@ -20,6 +21,27 @@ template <typename TColor> class IProtocol
     using ColorType = TColor;
     using SettingsType = void;
     static constexpr bool RequiresExternalBuffer = true;
+    // Fixed-stride protocols without cross-pixel state set this and provide
+    // `updateRange(colors, buffer, firstPixel, endPixel)`, which re-encodes only the
+    // given pixels inside a buffer that already holds a complete frame.
+    static constexpr bool SupportsPartialUpdate = false;
+    // Protocols that can emit a frame incrementally set this and provide
+    // `beginStream(colors)` plus `encodeNext(out)`, which writes the next encoded bytes
+    // of the frame into `out` and returns how many were written (0 once complete).
+    static constexpr bool SupportsStreaming = false;
+    // Protocols whose chips keep their previous value when a frame ends early set this
+    // and provide `truncatedPayloadSize(pixelCount)`, the encoded bytes from the start
+    // of a full frame through pixel `pixelCount - 1`, and `truncatedLatchSize(pixelCount)`,
+    // how many bytes from the end of the full frame must follow them to latch.
+    static constexpr bool SupportsTruncation = false;
+    // Protocols that encode pixels independently of each other set this and provide
+    // `updateShaded(colors, buffer, shade)` and, with partial updates,
+    // `updateRangeShaded(colors, buffer, firstPixel, endPixel, shade)`. They produce
+    // the frame `update`/`updateRange` would for `colors` after `shade`, calling
+    // `shade(span<TColor>)` on small copied blocks (see forEachShadedBlock) right
+    // before encoding them. Streaming protocols also provide
+    // `encodeNextShaded(out, shade)`, the shaded counterpart of `encodeNext(out)`.
+    static constexpr bool SupportsFusedShading = false;
     explicit IProtocol(PixelCount pixelCount = 0) : _pixelCount{pixelCount} {}
 
     virtual ~IProtocol() = default;
@@ -84,11 +106,82 @@ template <typename TProtocol>
 static constexpr bool ProtocolRequiredBufferSizeComputable =
     ProtocolType<TProtocol> && ProtocolRequiredBufferSizeComputableImpl<TProtocol>::value;
 
+template <typename TProtocol, typename = void> struct ProtocolSupportsPartialUpdateImpl : std::false_type
+{
+};
+
+template <typename TProtocol>
+struct ProtocolSupportsPartialUpdateImpl<
+    TProtocol, std::void_t<decltype(TProtocol::SupportsPartialUpdate),
+                           decltype(std::declval<TProtocol&>().updateRange(
+                               std::declval<span<const typename TProtocol::ColorType>>(),
+                               std::declval<span<uint8_t>>(), std::declval<size_t>(), std::declval<size_t>()))>>
+    : std::integral_constant<bool, static_cast<bool>(TProtocol::SupportsPartialUpdate)>
+{
+};
+
+template <typename TProtocol>
+static constexpr bool ProtocolSupportsPartialUpdate =
+    ProtocolType<TProtocol> && ProtocolSupportsPartialUpdateImpl<TProtocol>::value;
+
+template <typename TProtocol, typename = void> struct ProtocolSupportsStreamingImpl : std::false_type
+{
+};
+
+template <typename TProtocol>
+struct ProtocolSupportsStreamingImpl<
+    TProtocol,
+    std::void_t<decltype(TProtocol::SupportsStreaming),
+                decltype(std::declval<TProtocol&>().beginStream(std::declval<span<const typename TProtocol::ColorType>>())),
+                decltype(std::declval<TProtocol&>().encodeNext(std::declval<span<uint8_t>>()))>>
+    : std::integral_constant<bool, static_cast<bool>(TProtocol::SupportsStreaming)>
+{
+};
+
+template <typename TProtocol>
+static constexpr bool ProtocolSupportsStreaming =
+    ProtocolType<TProtocol> && ProtocolSupportsStreamingImpl<TProtocol>::value;
+
+template <typename TProtocol, typename = void> struct ProtocolSupportsTruncationImpl : std::false_type
+{
+};
+
+template <typename TProtocol>
+struct ProtocolSupportsTruncationImpl<
+    TProtocol, std::void_t<decltype(TProtocol::SupportsTruncation),
+                           decltype(std::declval<const TProtocol&>().truncatedPayloadSize(std::declval<size_t>())),
+                           decltype(std::declval<const TProtocol&>().truncatedLatchSize(std::declval<size_t>()))>>
+    : std::integral_constant<bool, static_cast<bool>(TProtocol::SupportsTruncation)>
+{
+};
+
+template <typename TProtocol>
+static constexpr bool ProtocolSupportsTruncation =
+    ProtocolType<TProtocol> && ProtocolSupportsTruncationImpl<TProtocol>::value;
+
+template <typename TProtocol, typename = void> struct ProtocolSupportsFusedShadingImpl : std::false_type
+{
+};
+
+template <typename TProtocol>
+struct ProtocolSupportsFusedShadingImpl<
+    TProtocol, std::void_t<decltype(TProtocol::SupportsFusedShading),
+                           decltype(std::declval<TProtocol&>().updateShaded(
+                               std::declval<span<const typename TProtocol::ColorType>>(),
+                               std::declval<span<uint8_t>>(), std::declval<NoShade&>()))>>
+    : std::integral_constant<bool, static_cast<bool>(TProtocol::SupportsFusedShading)>
+{
+};
+
+template <typename TProtocol>
+static constexpr bool ProtocolSupportsFusedShading =
+    ProtocolType<TProtocol> && ProtocolSupportsFusedShadingImpl<TProtocol>::value;
+
 template <typename TProtocol>
 static constexpr bool ProtocolPixelSettingsConstructible =
     ProtocolType<TProtocol> && ProtocolMoveConstructible<TProtocol> && ProtocolExternalBufferRequired<TProtocol> &&
     ProtocolRequiredBufferSizeComputable<TProtocol> && !std::is_same<typename TProtocol::SettingsType, void>::value &&
     std::is_move_constructible<typename TProtocol::SettingsType>::value &&
-    std::is_constructible<TProtocol, uint16_t, typename TProtocol::SettingsType>::value;
+    std::is_constructible<TProtocol, PixelCount, typename TProtocol::SettingsType>::value;
 
 } // namespace lw::protocols
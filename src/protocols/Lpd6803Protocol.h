@@ -7,7 +7,9 @@
 #include <algorithm>
 #include <type_traits>
 
+#include "BitStreamWriter.h"
 #include "IProtocol.h"
+#include "ProtocolChannelOrder.h"
 
 namespace lw::protocols
 {
@@ -69,22 +71,20 @@ template <typename TInterfaceColor = Rgb8Color> class Lpd6803ProtocolT : public
         std::fill(_byteBuffer.end() - _endFrameSize, _byteBuffer.end(), 0x00);
 
         // Serialize: 5-5-5 packed into 2 bytes per pixel
-        size_t offset = StartFrameSize;
         const size_t pixelLimit = std::min(colors.size(), static_cast<size_t>(this->pixelCount()));
+        BitStreamWriter<> writer{span<uint8_t>{_byteBuffer.data() + StartFrameSize, pixelLimit * BytesPerPixel}};
+        const ChannelIndexMap<InterfaceColorType, DynamicChannelOrder, 3> channels{_settings.channelOrder};
         for (size_t index = 0; index < pixelLimit; ++index)
         {
             const auto& color = colors[index];
-            uint8_t ch1 = toWireComponent8(color[_settings.channelOrder[0]]) & 0xF8;
-            uint8_t ch2 = toWireComponent8(color[_settings.channelOrder[1]]) & 0xF8;
-            uint8_t ch3 = toWireComponent8(color[_settings.channelOrder[2]]) & 0xF8;
+            const uint32_t ch1 = toWireComponent8(color.channelAtIndex(channels[0])) >> 3;
+            const uint32_t ch2 = toWireComponent8(color.channelAtIndex(channels[1])) >> 3;
+            const uint32_t ch3 = toWireComponent8(color.channelAtIndex(channels[2])) >> 3;
 
             // Pack: 1_ccccc_ccccc_ccccc (big-endian)
-            uint16_t packed = 0x8000 | (static_cast<uint16_t>(ch1) << 7) | (static_cast<uint16_t>(ch2) << 2) |
-                              (static_cast<uint16_t>(ch3) >> 3);
-
-            _byteBuffer[offset++] = static_cast<uint8_t>(packed >> 8);
-            _byteBuffer[offset++] = static_cast<uint8_t>(packed & 0xFF);
+            writer.write((1u << 15) | (ch1 << 10) | (ch2 << 5) | ch3, 16);
         }
+        writer.finish();
     }
 
     ProtocolSettings& settings() override { return _settings; }
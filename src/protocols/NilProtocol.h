@@ -17,7 +17,7 @@ template <typename TColor> class NilProtocol : public IProtocol<TColor>
   public:
     using SettingsType = NilProtocolSettings;
 
-    static constexpr size_t requiredBufferSize(uint16_t, const SettingsType&) { return 0; }
+    static constexpr size_t requiredBufferSize(PixelCount, const SettingsType&) { return 0; }
 
     explicit NilProtocol(PixelCount pixelCount, SettingsType settings = {})
         : IProtocol<TColor>(pixelCount), _settings{std::move(settings)}
@@ -58,14 +58,14 @@ struct DotStar
     using SettingsType = typename ProtocolType::SettingsType;
     using ColorType = typename ProtocolType::ColorType;
 
-    static SettingsType defaultSettings()
+    static constexpr SettingsType defaultSettings()
     {
         SettingsType settings{};
         settings.channelOrder = TDefaultChannelOrder::value;
         return normalizeSettings(std::move(settings));
     }
 
-    static SettingsType normalizeSettings(SettingsType settings)
+    static constexpr SettingsType normalizeSettings(SettingsType settings)
     {
         return SettingsType::template normalizeForColor<ColorType>(std::move(settings), TDefaultChannelOrder::value);
     }
@@ -86,14 +86,14 @@ struct Hd108
     using SettingsType = typename ProtocolType::SettingsType;
     using ColorType = typename ProtocolType::ColorType;
 
-    static SettingsType defaultSettings()
+    static constexpr SettingsType defaultSettings()
     {
         SettingsType settings{};
         settings.channelOrder = TDefaultChannelOrder::value;
         return normalizeSettings(std::move(settings));
     }
 
-    static SettingsType normalizeSettings(SettingsType settings)
+    static constexpr SettingsType normalizeSettings(SettingsType settings)
     {
         return SettingsType::template normalizeForColor<ColorType>(std::move(settings), TDefaultChannelOrder::value);
     }
@@ -105,9 +105,9 @@ template <typename TColor = lw::Rgb8Color> struct None
     using ProtocolType = lw::protocols::NilProtocol<TColor>;
     using SettingsType = typename ProtocolType::SettingsType;
 
-    static SettingsType defaultSettings() { return SettingsType{}; }
+    static constexpr SettingsType defaultSettings() { return SettingsType{}; }
 
-    static SettingsType normalizeSettings(SettingsType settings) { return settings; }
+    static constexpr SettingsType normalizeSettings(SettingsType settings) { return settings; }
 };
 
 template <typename TWrappedProtocolSpec = None<lw::Rgb8Color>> struct Debug
@@ -117,14 +117,14 @@ template <typename TWrappedProtocolSpec = None<lw::Rgb8Color>> struct Debug
     using SettingsType = typename ProtocolType::SettingsType;
     using ColorType = typename ProtocolType::ColorType;
 
-    static SettingsType defaultSettings()
+    static constexpr SettingsType defaultSettings()
     {
         SettingsType settings{};
         settings.wrapped = normalizeWrappedSettings(settings.wrapped);
         return settings;
     }
 
-    static SettingsType normalizeSettings(SettingsType settings)
+    static constexpr SettingsType normalizeSettings(SettingsType settings)
     {
         settings.wrapped = normalizeWrappedSettings(std::move(settings.wrapped));
         return settings;
@@ -133,7 +133,7 @@ template <typename TWrappedProtocolSpec = None<lw::Rgb8Color>> struct Debug
   private:
     using WrappedSettingsType = typename WrappedProtocolType::SettingsType;
 
-    static WrappedSettingsType normalizeWrappedSettings(WrappedSettingsType settings)
+    static constexpr WrappedSettingsType normalizeWrappedSettings(WrappedSettingsType settings)
     {
         if constexpr (detail::WrappedSpecHasNormalizeSettings<TWrappedProtocolSpec, WrappedSettingsType>::value)
         {
@@ -150,13 +150,13 @@ template <typename TInterfaceColor = lw::Rgbw8Color> struct Tm1814
     using ProtocolType = lw::protocols::Tm1814ProtocolT<TInterfaceColor>;
     using SettingsType = typename ProtocolType::SettingsType;
 
-    static SettingsType defaultSettings()
+    static constexpr SettingsType defaultSettings()
     {
         SettingsType settings{};
         return normalizeSettings(std::move(settings));
     }
 
-    static SettingsType normalizeSettings(SettingsType settings)
+    static constexpr SettingsType normalizeSettings(SettingsType settings)
     {
         return SettingsType::template normalizeForColor<ColorType>(std::move(settings), "WRGB");
     }
@@ -168,13 +168,13 @@ template <typename TInterfaceColor = lw::Rgb8Color> struct Tm1914
     using ProtocolType = lw::protocols::Tm1914ProtocolT<TInterfaceColor>;
     using SettingsType = typename ProtocolType::SettingsType;
 
-    static SettingsType defaultSettings()
+    static constexpr SettingsType defaultSettings()
     {
         SettingsType settings{};
         return normalizeSettings(std::move(settings));
     }
 
-    static SettingsType normalizeSettings(SettingsType settings)
+    static constexpr SettingsType normalizeSettings(SettingsType settings)
     {
         return SettingsType::template normalizeForColor<ColorType>(std::move(settings), lw::ChannelOrder::GRB::value);
     }
@@ -201,7 +201,7 @@ struct Ws2812x
         return (TDefaultTiming != nullptr) ? *TDefaultTiming : lw::transports::timing::Ws2812x;
     }
 
-    static SettingsType defaultSettings()
+    static constexpr SettingsType defaultSettings()
     {
         SettingsType settings{};
         settings.channelOrder = TDefaultChannelOrder::value;
@@ -209,7 +209,7 @@ struct Ws2812x
         return normalizeSettings(std::move(settings));
     }
 
-    static SettingsType normalizeSettings(SettingsType settings)
+    static constexpr SettingsType normalizeSettings(SettingsType settings)
     {
         settings.idleHigh = static_cast<bool>(TIdleHigh);
         return SettingsType::template normalizeForColor<ColorType>(std::move(settings), TDefaultChannelOrder::value);
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include "colors/ChannelOrder.h"
+
+namespace lw::protocols
+{
+
+// Selects the runtime `settings.channelOrder` string. This is the default for every
+// protocol that accepts a channel-order template parameter.
+struct DynamicChannelOrder
+{
+};
+
+template <typename TChannelOrder>
+static constexpr bool IsStaticChannelOrder = !std::is_same<TChannelOrder, DynamicChannelOrder>::value;
+
+// True when a fixed channel order names at least `NChannels` channels. Dynamic orders
+// are validated by settings normalization instead.
+template <typename TChannelOrder, size_t NChannels, typename = void> struct ChannelOrderCovers : std::true_type
+{
+};
+
+template <typename TChannelOrder, size_t NChannels>
+struct ChannelOrderCovers<TChannelOrder, NChannels, std::enable_if_t<IsStaticChannelOrder<TChannelOrder>>>
+    : std::integral_constant<bool, (TChannelOrder::length >= NChannels)>
+{
+};
+
+// Resolves wire channel positions to color channel indexes for up to `NMaxChannels`
+// wire channels.
+//
+// With a `ChannelOrder::GRB`-style struct the index table is a `constexpr` array, so
+// serializer loops over `size()` become fixed-offset loads the compiler can unroll.
+// `DynamicChannelOrder` resolves the tags once per frame from the settings string.
+template <typename TColor, typename TChannelOrder, size_t NMaxChannels> class ChannelIndexMap
+{
+  public:
+    static constexpr size_t NChannels = (TChannelOrder::length < NMaxChannels) ? TChannelOrder::length : NMaxChannels;
+
+    static constexpr std::array<size_t, NChannels> Indexes = []()
+    {
+        std::array<size_t, NChannels> indexes{};
+        for (size_t channel = 0; channel < NChannels; ++channel)
+        {
+            indexes[channel] = TColor::channelIndexFromTag(TChannelOrder::value[channel]);
+        }
+
+        return indexes;
+    }();
+
+    static constexpr const char* resolve(const char*) { return TChannelOrder::value; }
+
+    constexpr explicit ChannelIndexMap(const char* = nullptr, size_t = NMaxChannels) {}
+
+    static constexpr size_t size() { return NChannels; }
+
+    constexpr size_t operator[](size_t channel) const { return Indexes[channel]; }
+};
+
+template <typename TColor, size_t NMaxChannels> class ChannelIndexMap<TColor, DynamicChannelOrder, NMaxChannels>
+{
+  public:
+    static constexpr const char* resolve(const char* channelOrder) { return channelOrder; }
+
+    explicit ChannelIndexMap(const char* channelOrder, size_t channelCount = NMaxChannels)
+        : _size{(channelCount < NMaxChannels) ? channelCount : NMaxChannels}
+    {
+        for (size_t channel = 0; channel < _size; ++channel)
+        {
+            _indexes[channel] = TColor::channelIndexFromTag(channelOrder[channel]);
+        }
+    }
+
+    size_t size() const { return _size; }
+
+    size_t operator[](size_t channel) const { return _indexes[channel]; }
+
+  private:
+    std::array<size_t, NMaxChannels> _indexes{};
+    size_t _size;
+};
+
+} // namespace lw::protocols
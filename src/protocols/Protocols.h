@@ -1,8 +1,10 @@
 #pragma once
 
+#include "protocols/BitStreamWriter.h"
 #include "protocols/DebugProtocol.h"
 #include "protocols/DotStarProtocol.h"
 #include "protocols/IProtocol.h"
+#include "protocols/ProtocolChannelOrder.h"
 #include "protocols/ProtocolDecoratorBase.h"
 #include "protocols/ProtocolAliases.h"
 #include "protocols/Lpd6803Protocol.h"
@@ -10,6 +12,7 @@
 #include "protocols/NilProtocol.h"
 #include "protocols/P9813Protocol.h"
 #include "protocols/PixieProtocol.h"
+#include "protocols/ShadedBlocks.h"
 #include "protocols/Sm16716Protocol.h"
 #include "protocols/Sm168xProtocol.h"
 #include "protocols/Tlc59711Protocol.h"
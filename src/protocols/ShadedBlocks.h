@@ -0,0 +1,44 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "core/Compat.h"
+
+namespace lw::protocols
+{
+
+// Shade functor for plain updates: encoders read straight from the source pixels.
+struct NoShade
+{
+};
+
+// Runs `encode(block, offset)` over `colors`, where `offset` is the index of `block[0]`
+// within `colors`. With a real `shade`, each block of up to
+// `LW_FUSED_SHADE_BLOCK_PIXELS` pixels is first copied to the stack and passed to
+// `shade(span<TColor>)`, so shaded pixels never need a frame-sized buffer and the
+// source is left untouched.
+template <typename TColor, typename TShade, typename TEncode>
+void forEachShadedBlock(span<const TColor> colors, TShade& shade, TEncode&& encode)
+{
+    if constexpr (std::is_same<lw::remove_cvref_t<TShade>, NoShade>::value)
+    {
+        (void)shade;
+        encode(colors, 0);
+    }
+    else
+    {
+        std::array<TColor, LW_FUSED_SHADE_BLOCK_PIXELS> block{};
+        for (size_t first = 0; first < colors.size(); first += block.size())
+        {
+            const size_t count = std::min(block.size(), colors.size() - first);
+            std::copy(colors.data() + first, colors.data() + first + count, block.begin());
+            shade(span<TColor>{block.data(), count});
+            encode(span<const TColor>{block.data(), count}, first);
+        }
+    }
+}
+
+} // namespace lw::protocols
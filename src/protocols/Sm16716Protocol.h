@@ -7,7 +7,9 @@
 #include <algorithm>
 #include <type_traits>
 
+#include "BitStreamWriter.h"
 #include "IProtocol.h"
+#include "ProtocolChannelOrder.h"
 
 namespace lw::protocols
 {
@@ -83,44 +85,30 @@ template <typename TInterfaceColor = Rgb8Color> class Sm16716ProtocolT : public
     size_t _requiredBufferSize{0};
     span<uint8_t> _byteBuffer{};
 
-    // Set a single bit in the buffer (MSB-first ordering)
-    void setBit(size_t bitPos) { _byteBuffer[bitPos / 8] |= (0x80 >> (bitPos % 8)); }
-
-    // Pack an 8-bit value at an arbitrary bit position (MSB-first)
-    void packByte(uint8_t val, size_t& bitPos)
-    {
-        size_t byteIdx = bitPos / 8;
-        uint8_t shift = bitPos % 8;
-
-        // Value may span two output bytes
-        _byteBuffer[byteIdx] |= (val >> shift);
-        if (shift > 0 && byteIdx + 1 < _byteBuffer.size())
-        {
-            _byteBuffer[byteIdx + 1] |= (val << (8 - shift));
-        }
-        bitPos += 8;
-    }
-
     void serialize(span<const InterfaceColorType> colors)
     {
-        // Clear buffer ? start frame is 50 zero-bits, so zeros are default
-        std::fill(_byteBuffer.begin(), _byteBuffer.end(), 0);
+        BitStreamWriter<> writer{_byteBuffer};
+        writer.writeZeros(StartFrameBits);
 
-        size_t bitPos = StartFrameBits; // skip 50 zero-bits
+        const ChannelIndexMap<InterfaceColorType, DynamicChannelOrder, ChannelCount> channels{_settings.channelOrder};
 
         const size_t pixelLimit = std::min(colors.size(), static_cast<size_t>(this->pixelCount()));
         for (size_t index = 0; index < pixelLimit; ++index)
         {
             const auto& color = colors[index];
-            // 1-bit HIGH separator
-            setBit(bitPos++);
 
-            // Channel bytes
+            // HIGH separator bit followed by the channel bytes, as one 25-bit field.
+            uint32_t pixel = 1;
             for (size_t channel = 0; channel < ChannelCount; ++channel)
             {
-                packByte(toWireComponent8(color[_settings.channelOrder[channel]]), bitPos);
+                pixel = (pixel << 8) | toWireComponent8(color.channelAtIndex(channels[channel]));
             }
+            writer.write(pixel, BitsPerPixel);
         }
+
+        // Pixels without a source color stay all-zero, separator included.
+        const size_t written = writer.finish();
+        std::fill(_byteBuffer.begin() + written, _byteBuffer.end(), 0);
     }
 
     static constexpr uint8_t toWireComponent8(typename InterfaceColorType::ComponentType value)
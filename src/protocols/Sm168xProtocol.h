@@ -7,6 +7,7 @@
 #include <algorithm>
 
 #include "IProtocol.h"
+#include "ProtocolChannelOrder.h"
 
 namespace lw::protocols
 {
@@ -17,12 +18,14 @@ struct Sm168xProtocolSettings : public ProtocolSettings
     std::array<uint8_t, 5> gains = {15, 15, 15, 15, 15};
 };
 
-template <typename TInterfaceColor = Rgb8Color, typename TStripColor = TInterfaceColor>
+template <typename TInterfaceColor = Rgb8Color, typename TStripColor = TInterfaceColor,
+          typename TChannelOrder = DynamicChannelOrder>
 class Sm168xProtocol : public IProtocol<TInterfaceColor>
 {
   public:
     using InterfaceColorType = TInterfaceColor;
     using StripColorType = TStripColor;
+    using ChannelOrderType = TChannelOrder;
     using SettingsType = Sm168xProtocolSettings;
 
     static_assert((std::is_same<typename InterfaceColorType::ComponentType, uint8_t>::value ||
@@ -34,6 +37,8 @@ class Sm168xProtocol : public IProtocol<TInterfaceColor>
                   "Sm168xProtocol requires 3, 4, or 5 interface channels.");
     static_assert(StripColorType::ChannelCount >= 3 && StripColorType::ChannelCount <= 5,
                   "Sm168xProtocol requires 3, 4, or 5 strip channels.");
+    static_assert(ChannelOrderCovers<TChannelOrder, StripColorType::ChannelCount>::value,
+                  "Sm168xProtocol channel order must name every strip channel.");
 
     static constexpr size_t requiredBufferSize(PixelCount pixelCount, const SettingsType&)
     {
@@ -85,6 +90,7 @@ class Sm168xProtocol : public IProtocol<TInterfaceColor>
 
     static constexpr size_t StripChannelCount = StripColorType::ChannelCount;
     static constexpr size_t SettingsSize = resolveSettingsSize(StripChannelCount);
+    using ChannelMapType = ChannelIndexMap<InterfaceColorType, TChannelOrder, StripChannelCount>;
 
     uint8_t gainFromChannel(char channel) const
     {
@@ -147,12 +153,13 @@ class Sm168xProtocol : public IProtocol<TInterfaceColor>
 
         const size_t maxPixels = (StripChannelCount == 0) ? 0 : (payloadSize / StripChannelCount);
         const size_t pixelLimit = std::min(std::min(colors.size(), maxPixels), static_cast<size_t>(this->pixelCount()));
+        const ChannelMapType channels{_settings.channelOrder};
         for (size_t index = 0; index < pixelLimit; ++index)
         {
             const auto& color = colors[index];
-            for (size_t channel = 0; channel < StripChannelCount; ++channel)
+            for (size_t channel = 0; channel < channels.size(); ++channel)
             {
-                _frameBuffer[offset++] = toWireComponent8(color[_settings.channelOrder[channel]]);
+                _frameBuffer[offset++] = toWireComponent8(color.channelAtIndex(channels[channel]));
             }
         }
     }
@@ -160,9 +167,10 @@ class Sm168xProtocol : public IProtocol<TInterfaceColor>
     void encodeSettings()
     {
         uint8_t ic[5] = {0, 0, 0, 0, 0};
+        const char* channelOrder = ChannelMapType::resolve(_settings.channelOrder);
         for (size_t channel = 0; channel < StripChannelCount; ++channel)
         {
-            ic[channel] = gainFromChannel(_settings.channelOrder[channel]);
+            ic[channel] = gainFromChannel(channelOrder[channel]);
         }
 
         uint8_t* encoded = _frameBuffer.data() + (_frameBuffer.size() - SettingsSize);
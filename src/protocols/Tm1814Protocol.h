@@ -7,6 +7,7 @@
 #include <type_traits>
 
 #include "IProtocol.h"
+#include "ProtocolChannelOrder.h"
 #include "transports/OneWireEncoding.h"
 #include "transports/OneWireTiming.h"
 
@@ -30,8 +31,8 @@ struct Tm1814ProtocolSettings : public ProtocolSettings
     Tm1814CurrentSettings current{};
 
     template <typename TColor>
-    static Tm1814ProtocolSettings normalizeForColor(Tm1814ProtocolSettings settings,
-                                                    const char* defaultChannelOrder = "WRGB")
+    static constexpr Tm1814ProtocolSettings normalizeForColor(Tm1814ProtocolSettings settings,
+                                                              const char* defaultChannelOrder = "WRGB")
     {
         settings.channelOrder = lw::detail::normalizeChannelOrderForCount(settings.channelOrder, defaultChannelOrder,
                                                                           static_cast<size_t>(TColor::ChannelCount));
@@ -45,17 +46,20 @@ struct Tm1814ProtocolSettings : public ProtocolSettings
     }
 };
 
-template <typename TInterfaceColor = Rgbw8Color> class Tm1814ProtocolT : public IProtocol<TInterfaceColor>
+template <typename TInterfaceColor = Rgbw8Color, typename TChannelOrder = DynamicChannelOrder>
+class Tm1814ProtocolT : public IProtocol<TInterfaceColor>
 {
   public:
     using InterfaceColorType = TInterfaceColor;
     using StripColorType = Rgbw8Color;
+    using ChannelOrderType = TChannelOrder;
     using SettingsType = Tm1814ProtocolSettings;
 
     static_assert((std::is_same<typename InterfaceColorType::ComponentType, uint8_t>::value ||
                    std::is_same<typename InterfaceColorType::ComponentType, uint16_t>::value),
                   "Tm1814Protocol requires uint8_t or uint16_t interface components.");
     static_assert(InterfaceColorType::ChannelCount >= 4, "Tm1814Protocol requires at least 4 interface channels.");
+    static_assert(ChannelOrderCovers<TChannelOrder, 4>::value, "Tm1814Protocol channel order must name 4 channels.");
 
     static constexpr size_t requiredBufferSize(PixelCount pixelCount, const SettingsType& settings)
     {
@@ -109,6 +113,7 @@ template <typename TInterfaceColor = Rgbw8Color> class Tm1814ProtocolT : public
   private:
     static constexpr bool ProtocolIdleHigh = true;
     static constexpr size_t ChannelCount = 4;
+    using ChannelMapType = ChannelIndexMap<InterfaceColorType, TChannelOrder, ChannelCount>;
     static constexpr size_t SettingsSize = 8;
     static constexpr uint16_t MinCurrent = 65;
     static constexpr uint16_t MaxCurrent = 380;
@@ -145,9 +150,10 @@ template <typename TInterfaceColor = Rgbw8Color> class Tm1814ProtocolT : public
 
     void encodeSettings()
     {
+        const char* channelOrder = ChannelMapType::resolve(_settings.channelOrder);
         for (size_t i = 0; i < ChannelCount; ++i)
         {
-            _frameBuffer[i] = currentForChannel(_settings.channelOrder[i]);
+            _frameBuffer[i] = currentForChannel(channelOrder[i]);
         }
 
         for (size_t i = 0; i < ChannelCount; ++i)
@@ -160,12 +166,13 @@ template <typename TInterfaceColor = Rgbw8Color> class Tm1814ProtocolT : public
     {
         size_t offset = SettingsSize;
         const size_t pixelLimit = std::min(colors.size(), static_cast<size_t>(this->pixelCount()));
+        const ChannelMapType channels{_settings.channelOrder};
         for (size_t index = 0; index < pixelLimit; ++index)
         {
             const auto& color = colors[index];
-            for (size_t channel = 0; channel < ChannelCount; ++channel)
+            for (size_t channel = 0; channel < channels.size(); ++channel)
             {
-                _frameBuffer[offset++] = toWireComponent8(color[_settings.channelOrder[channel]]);
+                _frameBuffer[offset++] = toWireComponent8(color.channelAtIndex(channels[channel]));
             }
         }
     }
@@ -7,6 +7,7 @@
 #include <type_traits>
 
 #include "IProtocol.h"
+#include "ProtocolChannelOrder.h"
 #include "transports/OneWireEncoding.h"
 #include "transports/OneWireTiming.h"
 
@@ -29,8 +30,8 @@ struct Tm1914ProtocolSettings : public ProtocolSettings
     Tm1914Mode mode = Tm1914Mode::DinOnly;
 
     template <typename TColor>
-    static Tm1914ProtocolSettings normalizeForColor(Tm1914ProtocolSettings settings,
-                                                    const char* defaultChannelOrder = ChannelOrder::GRB::value)
+    static constexpr Tm1914ProtocolSettings
+    normalizeForColor(Tm1914ProtocolSettings settings, const char* defaultChannelOrder = ChannelOrder::GRB::value)
     {
         settings.channelOrder = lw::detail::normalizeChannelOrderForCount(settings.channelOrder, defaultChannelOrder,
                                                                           static_cast<size_t>(TColor::ChannelCount));
@@ -44,17 +45,20 @@ struct Tm1914ProtocolSettings : public ProtocolSettings
     }
 };
 
-template <typename TInterfaceColor = Rgb8Color> class Tm1914ProtocolT : public IProtocol<TInterfaceColor>
+template <typename TInterfaceColor = Rgb8Color, typename TChannelOrder = DynamicChannelOrder>
+class Tm1914ProtocolT : public IProtocol<TInterfaceColor>
 {
   public:
     using InterfaceColorType = TInterfaceColor;
     using StripColorType = Rgb8Color;
+    using ChannelOrderType = TChannelOrder;
     using SettingsType = Tm1914ProtocolSettings;
 
     static_assert((std::is_same<typename InterfaceColorType::ComponentType, uint8_t>::value ||
                    std::is_same<typename InterfaceColorType::ComponentType, uint16_t>::value),
                   "Tm1914Protocol requires uint8_t or uint16_t interface components.");
     static_assert(InterfaceColorType::ChannelCount >= 3, "Tm1914Protocol requires at least 3 interface channels.");
+    static_assert(ChannelOrderCovers<TChannelOrder, 3>::value, "Tm1914Protocol channel order must name 3 channels.");
 
     static constexpr size_t requiredBufferSize(PixelCount pixelCount, const SettingsType& settings)
     {
@@ -108,6 +112,7 @@ template <typename TInterfaceColor = Rgb8Color> class Tm1914ProtocolT : public I
   private:
     static constexpr bool ProtocolIdleHigh = true;
     static constexpr size_t ChannelCount = 3;
+    using ChannelMapType = ChannelIndexMap<InterfaceColorType, TChannelOrder, ChannelCount>;
     static constexpr size_t SettingsSize = 6;
 
     uint8_t encodedMode() const
@@ -141,12 +146,13 @@ template <typename TInterfaceColor = Rgb8Color> class Tm1914ProtocolT : public I
     {
         size_t offset = SettingsSize;
         const size_t pixelLimit = std::min(colors.size(), static_cast<size_t>(this->pixelCount()));
+        const ChannelMapType channels{_settings.channelOrder};
         for (size_t index = 0; index < pixelLimit; ++index)
         {
             const auto& color = colors[index];
-            for (size_t channel = 0; channel < ChannelCount; ++channel)
+            for (size_t channel = 0; channel < channels.size(); ++channel)
             {
-                _frameBuffer[offset++] = toWireComponent8(color[_settings.channelOrder[channel]]);
+                _frameBuffer[offset++] = toWireComponent8(color.channelAtIndex(channels[channel]));
             }
         }
     }
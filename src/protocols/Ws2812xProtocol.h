@@ -8,8 +8,10 @@
 #include <type_traits>
 #include <utility>
 #include <algorithm>
+#include <array>
 
 #include "IProtocol.h"
+#include "ProtocolChannelOrder.h"
 #include "colors/Color.h"
 #include "transports/OneWireEncoding.h"
 #include "transports/OneWireTiming.h"
@@ -26,8 +28,8 @@ struct Ws2812xProtocolSettings : public ProtocolSettings
     bool idleHigh = false;
 
     template <typename TColor>
-    static Ws2812xProtocolSettings normalizeForColor(Ws2812xProtocolSettings settings,
-                                                     const char* defaultChannelOrder = ChannelOrder::GRB::value)
+    static constexpr Ws2812xProtocolSettings
+    normalizeForColor(Ws2812xProtocolSettings settings, const char* defaultChannelOrder = ChannelOrder::GRB::value)
     {
         settings.channelOrder = lw::detail::normalizeChannelOrderForCount(settings.channelOrder, defaultChannelOrder,
                                                                           static_cast<size_t>(TColor::ChannelCount));
@@ -55,14 +57,24 @@ struct Ws2812xProtocolSettings : public ProtocolSettings
     }
 };
 
-template <typename TInterfaceColor, typename TStripColor = TInterfaceColor>
+// `TChannelOrder` may name a fixed `ChannelOrder::GRB`-style struct; `settings.channelOrder`
+// is then ignored and the wire order is resolved at compile time.
+template <typename TInterfaceColor, typename TStripColor = TInterfaceColor,
+          typename TChannelOrder = DynamicChannelOrder>
 class Ws2812xProtocol : public IProtocol<TInterfaceColor>
 {
   public:
     using InterfaceColorType = TInterfaceColor;
     using StripColorType = TStripColor;
+    using ChannelOrderType = TChannelOrder;
     using SettingsType = Ws2812xProtocolSettings;
 
+    static constexpr bool SupportsPartialUpdate = true;
+    static constexpr bool SupportsStreaming = true;
+    static constexpr bool SupportsFusedShading = true;
+    // Pixels past the end of a short frame keep their last value once the reset latches.
+    static constexpr bool SupportsTruncation = true;
+
     static constexpr size_t requiredBufferSize(PixelCount pixelCount, const SettingsType& settings)
     {
         const char* channelOrder = resolveChannelOrder(settings.channelOrder);
@@ -78,7 +90,7 @@ class Ws2812xProtocol : public IProtocol<TInterfaceColor>
     }
 
     template <typename TTransportSettings>
-    static void normalizeTransportSettings(uint16_t, const SettingsType& settings,
+    static void normalizeTransportSettings(PixelCount, const SettingsType& settings,
                                            TTransportSettings& transportSettings)
     {
         transports::normalizeOneWireTransportClockDataBitRate(settings.timing, transportSettings);
@@ -152,6 +164,12 @@ class Ws2812xProtocol : public IProtocol<TInterfaceColor>
     void begin() override {}
 
     void update(span<const InterfaceColorType> colors, span<uint8_t> buffer = span<uint8_t>{}) override
+    {
+        updateShaded(colors, buffer, NoShade{});
+    }
+
+    template <typename TShade>
+    void updateShaded(span<const InterfaceColorType> colors, span<uint8_t> buffer, TShade&& shade)
     {
         if (buffer.size() < _sizeData)
         {
@@ -160,15 +178,130 @@ class Ws2812xProtocol : public IProtocol<TInterfaceColor>
 
         _frameData = span<uint8_t>{buffer.data(), _sizeData};
 
-        serialize(_frameData, colors);
+        // Single pass: each wire byte is expanded straight to its final offset instead of
+        // serializing raw bytes first and re-reading them for an in-place expansion.
+        const size_t prefixResetBytes = transports::OneWireEncoding::computeResetBytes(
+            _settings.timing, 0, _settings.prefixResetMultiplier);
+        const size_t suffixResetBytes = _sizeData - prefixResetBytes -
+                                        transports::OneWireEncoding::expandedPayloadSizeBytes(
+                                            _rawSizeData, _settings.timing.bitPattern());
+
+        transports::OneWireEncoding::fillResetBytes(_frameData.data(), prefixResetBytes, ProtocolIdleHigh);
+
+        uint8_t* const payloadEnd = serializeEncoded(_frameData.data() + prefixResetBytes, colors, shade);
+
+        transports::OneWireEncoding::fillResetBytes(payloadEnd, suffixResetBytes, ProtocolIdleHigh);
+    }
+
+    // Re-encodes pixels [firstPixel, endPixel) in place; every pixel occupies the same
+    // number of encoded bytes, so reset framing and the other pixels are untouched.
+    void updateRange(span<const InterfaceColorType> colors, span<uint8_t> buffer, size_t firstPixel, size_t endPixel)
+    {
+        updateRangeShaded(colors, buffer, firstPixel, endPixel, NoShade{});
+    }
 
-        const size_t encodedSize = transports::OneWireEncoding::encodeWithResets(
-            _frameData.data(), _rawSizeData, _frameData.data(), _frameData.size(), _settings.timing, 0,
-            _settings.prefixResetMultiplier, _settings.suffixResetMultiplier, ProtocolIdleHigh);
-        if (encodedSize == 0)
+    template <typename TShade>
+    void updateRangeShaded(span<const InterfaceColorType> colors, span<uint8_t> buffer, size_t firstPixel,
+                           size_t endPixel, TShade&& shade)
+    {
+        if (buffer.size() < _sizeData)
         {
             return;
         }
+
+        const size_t pixelLimit = std::min(std::min(endPixel, colors.size()), static_cast<size_t>(this->pixelCount()));
+        if (firstPixel >= pixelLimit)
+        {
+            return;
+        }
+
+        _frameData = span<uint8_t>{buffer.data(), _sizeData};
+
+        const size_t prefixResetBytes = transports::OneWireEncoding::computeResetBytes(
+            _settings.timing, 0, _settings.prefixResetMultiplier);
+        const size_t pixelStride = encodedPixelStride();
+
+        uint8_t* out = _frameData.data() + prefixResetBytes + (firstPixel * pixelStride);
+        forEachShadedBlock(span<const InterfaceColorType>{colors.data() + firstPixel, pixelLimit - firstPixel}, shade,
+                           [&](span<const InterfaceColorType> block, size_t) { out = encodePixels(out, block); });
+    }
+
+    // Streaming: the same frame update() produces, emitted in caller-sized pieces so a
+    // transport can drain it through a small chunk ring instead of a full buffer.
+    void beginStream(span<const InterfaceColorType> colors)
+    {
+        _streamColors = colors;
+        _streamPosition = 0;
+    }
+
+    size_t encodeNext(span<uint8_t> out) { return encodeNextShaded(out, NoShade{}); }
+
+    // As encodeNext(), shading the pixels of each piece on stack blocks as they are
+    // encoded; a pixel split across two pieces is shaded for each of them.
+    template <typename TShade> size_t encodeNextShaded(span<uint8_t> out, TShade&& shade)
+    {
+        const size_t prefixResetBytes = transports::OneWireEncoding::computeResetBytes(
+            _settings.timing, 0, _settings.prefixResetMultiplier);
+        const size_t pixelStride = encodedPixelStride();
+        const size_t payloadEnd = prefixResetBytes + (static_cast<size_t>(this->pixelCount()) * pixelStride);
+
+        size_t written = 0;
+        while (written < out.size() && _streamPosition < _sizeData)
+        {
+            uint8_t* const destination = out.data() + written;
+            const size_t room = out.size() - written;
+            size_t produced = 0;
+
+            if (_streamPosition < prefixResetBytes)
+            {
+                produced = std::min(room, prefixResetBytes - _streamPosition);
+                transports::OneWireEncoding::fillResetBytes(destination, produced, ProtocolIdleHigh);
+            }
+            else if (_streamPosition < payloadEnd)
+            {
+                const size_t pixel = (_streamPosition - prefixResetBytes) / pixelStride;
+                const size_t withinPixel = (_streamPosition - prefixResetBytes) % pixelStride;
+
+                if (withinPixel == 0 && room >= pixelStride)
+                {
+                    const size_t pixels =
+                        std::min(room / pixelStride, static_cast<size_t>(this->pixelCount()) - pixel);
+                    encodeStreamPixels(destination, pixel, pixels, shade);
+                    produced = pixels * pixelStride;
+                }
+                else
+                {
+                    // Chunk boundary inside a pixel: encode it aside and copy the slice.
+                    std::array<uint8_t, MaxEncodedPixelStride> pixelBytes{};
+                    encodeStreamPixels(pixelBytes.data(), pixel, 1, shade);
+                    produced = std::min(room, pixelStride - withinPixel);
+                    std::memcpy(destination, pixelBytes.data() + withinPixel, produced);
+                }
+            }
+            else
+            {
+                produced = std::min(room, _sizeData - _streamPosition);
+                transports::OneWireEncoding::fillResetBytes(destination, produced, ProtocolIdleHigh);
+            }
+
+            written += produced;
+            _streamPosition += produced;
+        }
+
+        return written;
+    }
+
+    size_t truncatedPayloadSize(size_t pixelCount) const
+    {
+        const size_t prefixResetBytes = transports::OneWireEncoding::computeResetBytes(
+            _settings.timing, 0, _settings.prefixResetMultiplier);
+        const size_t pixels = std::min(pixelCount, static_cast<size_t>(this->pixelCount()));
+        return prefixResetBytes + (pixels * encodedPixelStride());
+    }
+
+    size_t truncatedLatchSize(size_t) const
+    {
+        return transports::OneWireEncoding::computeResetBytes(_settings.timing, 0, _settings.suffixResetMultiplier);
     }
 
     ProtocolSettings& settings() override { return _settings; }
@@ -183,9 +316,12 @@ class Ws2812xProtocol : public IProtocol<TInterfaceColor>
   private:
     static constexpr bool ProtocolIdleHigh = false;
     SettingsType _settings;
+    using ChannelMapType = ChannelIndexMap<InterfaceColorType, TChannelOrder,
+                                           std::min(InterfaceColorType::ChannelCount, StripColorType::ChannelCount)>;
+
     static constexpr const char* resolveChannelOrder(const char* channelOrder)
     {
-        return (nullptr != channelOrder) ? channelOrder : ChannelOrder::GRB::value;
+        return ChannelMapType::resolve((nullptr != channelOrder) ? channelOrder : ChannelOrder::GRB::value);
     }
 
     static constexpr size_t resolveChannelCount(const char* channelOrder)
@@ -204,20 +340,19 @@ class Ws2812xProtocol : public IProtocol<TInterfaceColor>
         return pixelCount * channelCount * sizeof(typename StripColorType::ComponentType);
     }
 
-    static constexpr void appendWireComponent(span<uint8_t> pixels, size_t& offset,
-                                              typename InterfaceColorType::ComponentType value)
+    static uint8_t* appendWireComponent(uint8_t* out, typename InterfaceColorType::ComponentType value,
+                                        const transports::detail::OneWireExpansion& expansion)
     {
         if constexpr (std::is_same<typename StripColorType::ComponentType, uint8_t>::value)
         {
             if constexpr (std::is_same<typename InterfaceColorType::ComponentType, uint8_t>::value)
             {
-                pixels[offset++] = value;
+                return transports::OneWireEncoding::encodeByte(value, out, expansion);
             }
             else
             {
-                pixels[offset++] = static_cast<uint8_t>(value >> 8);
+                return transports::OneWireEncoding::encodeByte(static_cast<uint8_t>(value >> 8), out, expansion);
             }
-            return;
         }
 
         uint16_t encoded = 0;
@@ -230,23 +365,68 @@ class Ws2812xProtocol : public IProtocol<TInterfaceColor>
             encoded = static_cast<uint16_t>(value);
         }
 
-        pixels[offset++] = static_cast<uint8_t>(encoded >> 8);
-        pixels[offset++] = static_cast<uint8_t>(encoded & 0xFF);
+        out = transports::OneWireEncoding::encodeByte(static_cast<uint8_t>(encoded >> 8), out, expansion);
+        return transports::OneWireEncoding::encodeByte(static_cast<uint8_t>(encoded & 0xFF), out, expansion);
     }
 
-    void serialize(span<uint8_t> pixels, span<const InterfaceColorType> colors)
+    static constexpr size_t MaxEncodedPixelStride = 5 * sizeof(uint16_t) * 4;
+
+    size_t encodedPixelStride() const
     {
-        size_t offset = 0;
-        const size_t pixelLimit = std::min(colors.size(), static_cast<size_t>(this->pixelCount()));
+        return transports::OneWireEncoding::expandedPayloadSizeBytes(bytesNeeded(1, _channelCount),
+                                                                     _settings.timing.bitPattern());
+    }
 
-        for (size_t index = 0; index < pixelLimit; ++index)
+    template <typename TShade>
+    uint8_t* encodeStreamPixels(uint8_t* out, size_t firstPixel, size_t count, TShade& shade) const
+    {
+        const size_t available = (firstPixel < _streamColors.size()) ? (_streamColors.size() - firstPixel) : 0;
+        const size_t colored = std::min(count, available);
+        forEachShadedBlock(span<const InterfaceColorType>{_streamColors.data() + firstPixel, colored}, shade,
+                           [&](span<const InterfaceColorType> block, size_t) { out = encodePixels(out, block); });
+
+        const auto expansion = transports::OneWireEncoding::expansionFor(_settings.timing, ProtocolIdleHigh);
+        const size_t missingRawBytes = bytesNeeded(count - colored, _channelCount);
+        for (size_t index = 0; index < missingRawBytes; ++index)
         {
-            const auto& color = colors[index];
-            for (size_t channel = 0; channel < _channelCount; ++channel)
+            out = transports::OneWireEncoding::encodeByte(0, out, expansion);
+        }
+
+        return out;
+    }
+
+    uint8_t* encodePixels(uint8_t* out, span<const InterfaceColorType> colors) const
+    {
+        const auto expansion = transports::OneWireEncoding::expansionFor(_settings.timing, ProtocolIdleHigh);
+        const ChannelMapType channels{_channelOrder, _channelCount};
+
+        for (const auto& color : colors)
+        {
+            for (size_t channel = 0; channel < channels.size(); ++channel)
             {
-                appendWireComponent(pixels, offset, color[_channelOrder[channel]]);
+                out = appendWireComponent(out, color.channelAtIndex(channels[channel]), expansion);
             }
         }
+
+        return out;
+    }
+
+    template <typename TShade>
+    uint8_t* serializeEncoded(uint8_t* out, span<const InterfaceColorType> colors, TShade& shade) const
+    {
+        const size_t pixelLimit = std::min(colors.size(), static_cast<size_t>(this->pixelCount()));
+        forEachShadedBlock(span<const InterfaceColorType>{colors.data(), pixelLimit}, shade,
+                           [&](span<const InterfaceColorType> block, size_t) { out = encodePixels(out, block); });
+
+        // Pixels without a source color are sent as black.
+        const auto expansion = transports::OneWireEncoding::expansionFor(_settings.timing, ProtocolIdleHigh);
+        const size_t missingRawBytes = bytesNeeded(static_cast<size_t>(this->pixelCount()) - pixelLimit, _channelCount);
+        for (size_t index = 0; index < missingRawBytes; ++index)
+        {
+            out = transports::OneWireEncoding::encodeByte(0, out, expansion);
+        }
+
+        return out;
     }
 
     const char* _channelOrder;
@@ -254,6 +434,8 @@ class Ws2812xProtocol : public IProtocol<TInterfaceColor>
     size_t _rawSizeData;
     size_t _sizeData;
     span<uint8_t> _frameData{};
+    span<const InterfaceColorType> _streamColors{};
+    size_t _streamPosition{0};
 };
 
 } // namespace lw::protocols
@@ -49,6 +49,29 @@ struct TransportSettingsBase
 class ITransport
 {
   public:
+    // Transports that are done with the caller's bytes once transmitBytes() returns set
+    // this. Others, such as DMA transports, may read them until isReadyToUpdate().
+    static constexpr bool CompletesSynchronously = false;
+    // Transports that set this run the callback given to setTransferCompleteCallback()
+    // when a transfer ends and isReadyToUpdate() turns true. It runs in task context,
+    // never inside an interrupt handler: a transport whose transfers end in an
+    // interrupt defers the call to a task.
+    static constexpr bool SignalsTransferComplete = false;
+    // Transports that set this never write to the bytes given to transmitBytes(), so a
+    // bus may keep the encoded frame and re-encode only the pixels that changed. Others
+    // may invert or bit-reverse the caller's bytes in place.
+    static constexpr bool PreservesBuffer = false;
+    // Transports that set this send successive transmitBytes() calls within one
+    // transaction back to back as one continuous transfer, so a frame may be handed over
+    // in chunks. Others may restart or overwrite a transfer still in progress.
+    static constexpr bool StreamsChunks = false;
+    // How many chunks handed to transmitBytes(), the latest included, a chunk-streaming
+    // transport may still read once the call returns. It blocks in transmitBytes()
+    // rather than hold more, so a caller may refill a chunk after that many more calls.
+    static constexpr size_t StreamChunksInFlight = 0;
+
+    using TransferCompleteCallback = void (*)(void* context);
+
     virtual ~ITransport() = default;
 
     virtual void begin() = 0;
@@ -60,6 +83,12 @@ class ITransport
     virtual void endTransaction() {}
 
     virtual bool isReadyToUpdate() const { return true; }
+
+    virtual void setTransferCompleteCallback(TransferCompleteCallback callback, void* context)
+    {
+        (void)callback;
+        (void)context;
+    }
 };
 
 template <typename TTransportSettings, typename = void> struct TransportSettingsWithInvertImpl : std::false_type
@@ -90,6 +119,75 @@ struct TransportLikeImpl<TTransport, std::void_t<typename TTransport::TransportS
 
 template <typename TTransport> static constexpr bool TransportLike = TransportLikeImpl<TTransport>::value;
 
+template <typename TTransport, typename = void> struct TransportCompletesSynchronouslyImpl : std::false_type
+{
+};
+
+template <typename TTransport>
+struct TransportCompletesSynchronouslyImpl<TTransport, std::void_t<decltype(TTransport::CompletesSynchronously)>>
+    : std::integral_constant<bool, static_cast<bool>(TTransport::CompletesSynchronously)>
+{
+};
+
+template <typename TTransport>
+static constexpr bool TransportCompletesSynchronously =
+    TransportLike<TTransport> && TransportCompletesSynchronouslyImpl<TTransport>::value;
+
+template <typename TTransport, typename = void> struct TransportSignalsTransferCompleteImpl : std::false_type
+{
+};
+
+template <typename TTransport>
+struct TransportSignalsTransferCompleteImpl<TTransport, std::void_t<decltype(TTransport::SignalsTransferComplete)>>
+    : std::integral_constant<bool, static_cast<bool>(TTransport::SignalsTransferComplete)>
+{
+};
+
+template <typename TTransport>
+static constexpr bool TransportSignalsTransferComplete =
+    TransportLike<TTransport> && TransportSignalsTransferCompleteImpl<TTransport>::value;
+
+template <typename TTransport, typename = void> struct TransportPreservesBufferImpl : std::false_type
+{
+};
+
+template <typename TTransport>
+struct TransportPreservesBufferImpl<TTransport, std::void_t<decltype(TTransport::PreservesBuffer)>>
+    : std::integral_constant<bool, static_cast<bool>(TTransport::PreservesBuffer)>
+{
+};
+
+template <typename TTransport>
+static constexpr bool TransportPreservesBuffer =
+    TransportLike<TTransport> && TransportPreservesBufferImpl<TTransport>::value;
+
+template <typename TTransport, typename = void> struct TransportStreamsChunksImpl : std::false_type
+{
+};
+
+template <typename TTransport>
+struct TransportStreamsChunksImpl<TTransport, std::void_t<decltype(TTransport::StreamsChunks)>>
+    : std::integral_constant<bool, static_cast<bool>(TTransport::StreamsChunks)>
+{
+};
+
+template <typename TTransport>
+static constexpr bool TransportStreamsChunks = TransportLike<TTransport> && TransportStreamsChunksImpl<TTransport>::value;
+
+template <typename TTransport, typename = void> struct TransportStreamChunksInFlightImpl
+{
+    static constexpr size_t value = 0;
+};
+
+template <typename TTransport>
+struct TransportStreamChunksInFlightImpl<TTransport, std::void_t<decltype(TTransport::StreamChunksInFlight)>>
+{
+    static constexpr size_t value = static_cast<size_t>(TTransport::StreamChunksInFlight);
+};
+
+template <typename TTransport>
+static constexpr size_t TransportStreamChunksInFlight = TransportStreamChunksInFlightImpl<TTransport>::value;
+
 template <typename TTransport>
 static constexpr bool SettingsConstructibleTransportLike =
     TransportLike<TTransport> && std::is_constructible<TTransport, typename TTransport::TransportSettingsType>::value;
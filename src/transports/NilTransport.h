@@ -16,6 +16,9 @@ class NilTransport : public ITransport
 {
   public:
     using TransportSettingsType = NilTransportSettings;
+    static constexpr bool CompletesSynchronously = true;
+    static constexpr bool PreservesBuffer = true;
+    static constexpr bool StreamsChunks = true;
     explicit NilTransport(NilTransportSettings = {}) {}
 
     void begin() override {}
@@ -6,6 +6,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "OneWireEncodingBackend.h"
 #include "OneWireTiming.h"
 
 namespace lw::transports
@@ -69,6 +70,8 @@ struct OneWireEncoding
         return sourceBytes * encodedBitsPerDataBitFromPattern(bitPattern);
     }
 
+    using Backend = LW_ONE_WIRE_ENCODING_BACKEND;
+
     static size_t encodeStepBytesReverseInPlace(uint8_t* buffer, size_t srcSize, uint8_t encodedOne,
                                                 uint8_t encodedZero, uint8_t encodedBitsPerDataBit)
     {
@@ -77,29 +80,37 @@ struct OneWireEncoding
             return 0;
         }
 
-        for (size_t srcIndex = srcSize; srcIndex > 0; --srcIndex)
-        {
-            uint8_t value = buffer[srcIndex - 1];
-            uint32_t packed = 0;
-
-            for (uint8_t bit = 0; bit < 8; ++bit)
-            {
-                const uint8_t encoded = (value & 0x80) ? encodedOne : encodedZero;
-                value <<= 1;
-                packed = (packed << encodedBitsPerDataBit) | encoded;
-            }
-
-            const size_t outBase = (srcIndex - 1) * static_cast<size_t>(encodedBitsPerDataBit);
-            for (size_t byteIndex = 0; byteIndex < encodedBitsPerDataBit; ++byteIndex)
-            {
-                const uint8_t shift = static_cast<uint8_t>((encodedBitsPerDataBit - 1 - byteIndex) * 8);
-                buffer[outBase + byteIndex] = static_cast<uint8_t>((packed >> shift) & 0xFFu);
-            }
-        }
+        Backend::encodeReverseInPlace(buffer, srcSize, encodedOne, encodedZero, encodedBitsPerDataBit);
 
         return srcSize * static_cast<size_t>(encodedBitsPerDataBit);
     }
 
+    static constexpr detail::OneWireExpansion expansionFor(const OneWireTiming& timing, bool protocolIdleHigh = false)
+    {
+        const EncodedClockDataBitPattern pattern = timing.bitPattern();
+        const uint8_t bitsPerDataBit = encodedBitsPerDataBitFromPattern(pattern);
+        const uint8_t encodedOne =
+            (pattern == EncodedClockDataBitPattern::FourStep) ? EncodedOne4Step : EncodedOne3Step;
+        const uint8_t encodedZero =
+            (pattern == EncodedClockDataBitPattern::FourStep) ? EncodedZero4Step : EncodedZero3Step;
+
+        return detail::OneWireExpansion::make(
+            protocolIdleHigh ? invertEncodedPattern(encodedOne, bitsPerDataBit) : encodedOne,
+            protocolIdleHigh ? invertEncodedPattern(encodedZero, bitsPerDataBit) : encodedZero, bitsPerDataBit);
+    }
+
+    // Expands one data byte directly to its final position; returns the byte past the symbols written.
+    static uint8_t* encodeByte(uint8_t value, uint8_t* out, const detail::OneWireExpansion& expansion)
+    {
+        detail::storeExpandedBigEndian(out, Backend::expand(value, expansion), expansion.bitsPerDataBit);
+        return out + expansion.bitsPerDataBit;
+    }
+
+    static void fillResetBytes(uint8_t* out, size_t count, bool protocolIdleHigh = false)
+    {
+        std::memset(out, resetFillByte(protocolIdleHigh), count);
+    }
+
     static size_t encodeInPlace(uint8_t* protocolData, size_t protocolDataLength, uint8_t* transportBuffer,
                                 size_t transportCapacity, const OneWireTiming& timing, bool protocolIdleHigh = false)
     {
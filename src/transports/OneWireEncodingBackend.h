@@ -0,0 +1,264 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "core/Compat.h"
+
+namespace lw::transports::detail
+{
+
+// One-wire expansion replaces every data bit with an N-step symbol (N = 3 or 4),
+// MSB first. Because the symbols never overlap, an expanded byte can be written as
+//
+//   expanded = zeroFill ^ (spread(value) * (encodedOne ^ encodedZero))
+//
+// where spread() moves data bit k to bit position k * N and zeroFill is the
+// all-zeros symbol run. Inverted (idle-high) symbols use the same identity.
+struct OneWireExpansion
+{
+    uint32_t zeroFill;
+    uint32_t difference;
+    uint8_t encodedOne;
+    uint8_t encodedZero;
+    uint8_t bitsPerDataBit;
+
+    static constexpr OneWireExpansion make(uint8_t encodedOne, uint8_t encodedZero, uint8_t bitsPerDataBit)
+    {
+        uint32_t zeroFill = 0;
+        for (uint8_t bit = 0; bit < 8; ++bit)
+        {
+            zeroFill = (zeroFill << bitsPerDataBit) | encodedZero;
+        }
+
+        return OneWireExpansion{zeroFill, static_cast<uint32_t>(encodedOne ^ encodedZero), encodedOne, encodedZero,
+                                bitsPerDataBit};
+    }
+
+    static constexpr bool supportsWordExpansion(uint8_t bitsPerDataBit)
+    {
+        return bitsPerDataBit == 3 || bitsPerDataBit == 4;
+    }
+};
+
+inline void storeExpandedBigEndian(uint8_t* out, uint32_t packed, uint8_t bytes)
+{
+    if (bytes == 4)
+    {
+        out[0] = static_cast<uint8_t>(packed >> 24);
+        out[1] = static_cast<uint8_t>(packed >> 16);
+        out[2] = static_cast<uint8_t>(packed >> 8);
+        out[3] = static_cast<uint8_t>(packed);
+        return;
+    }
+
+    out[0] = static_cast<uint8_t>(packed >> 16);
+    out[1] = static_cast<uint8_t>(packed >> 8);
+    out[2] = static_cast<uint8_t>(packed);
+}
+
+// Reference encoder: one branch and one shift per data bit.
+struct BitwiseOneWireEncodingBackend
+{
+    static uint32_t expandByte(uint8_t value, uint8_t encodedOne, uint8_t encodedZero, uint8_t bitsPerDataBit)
+    {
+        uint32_t packed = 0;
+
+        for (uint8_t bit = 0; bit < 8; ++bit)
+        {
+            const uint8_t encoded = (value & 0x80) ? encodedOne : encodedZero;
+            value <<= 1;
+            packed = (packed << bitsPerDataBit) | encoded;
+        }
+
+        return packed;
+    }
+
+    static uint32_t expand(uint8_t value, const OneWireExpansion& expansion)
+    {
+        return expandByte(value, expansion.encodedOne, expansion.encodedZero, expansion.bitsPerDataBit);
+    }
+
+    static void encodeReverseInPlace(uint8_t* buffer, size_t srcSize, uint8_t encodedOne, uint8_t encodedZero,
+                                     uint8_t bitsPerDataBit)
+    {
+        for (size_t srcIndex = srcSize; srcIndex > 0; --srcIndex)
+        {
+            const uint32_t packed = expandByte(buffer[srcIndex - 1], encodedOne, encodedZero, bitsPerDataBit);
+
+            const size_t outBase = (srcIndex - 1) * static_cast<size_t>(bitsPerDataBit);
+            for (size_t byteIndex = 0; byteIndex < bitsPerDataBit; ++byteIndex)
+            {
+                const uint8_t shift = static_cast<uint8_t>((bitsPerDataBit - 1 - byteIndex) * 8);
+                buffer[outBase + byteIndex] = static_cast<uint8_t>((packed >> shift) & 0xFFu);
+            }
+        }
+    }
+};
+
+constexpr std::array<uint32_t, 256> makeOneWireSpreadTable(uint8_t bitsPerDataBit)
+{
+    std::array<uint32_t, 256> table{};
+    for (uint32_t value = 0; value < 256; ++value)
+    {
+        uint32_t spread = 0;
+        for (uint8_t bit = 0; bit < 8; ++bit)
+        {
+            if (value & (1u << bit))
+            {
+                spread |= 1u << (bit * bitsPerDataBit);
+            }
+        }
+        table[value] = spread;
+    }
+
+    return table;
+}
+
+// Precomputed 256-entry spread tables (1 KiB each) indexed by the source byte.
+struct TableOneWireEncodingBackend
+{
+    static constexpr std::array<uint32_t, 256> Spread3 = makeOneWireSpreadTable(3);
+    static constexpr std::array<uint32_t, 256> Spread4 = makeOneWireSpreadTable(4);
+
+    static uint32_t expand(uint8_t value, const OneWireExpansion& expansion)
+    {
+        const uint32_t spread = (expansion.bitsPerDataBit == 4) ? Spread4[value] : Spread3[value];
+        return expansion.zeroFill ^ (spread * expansion.difference);
+    }
+
+    static uint32_t expandByte(uint8_t value, uint8_t encodedOne, uint8_t encodedZero, uint8_t bitsPerDataBit)
+    {
+        if (!OneWireExpansion::supportsWordExpansion(bitsPerDataBit))
+        {
+            return BitwiseOneWireEncodingBackend::expandByte(value, encodedOne, encodedZero, bitsPerDataBit);
+        }
+
+        return expand(value, OneWireExpansion::make(encodedOne, encodedZero, bitsPerDataBit));
+    }
+
+    static void encodeReverseInPlace(uint8_t* buffer, size_t srcSize, uint8_t encodedOne, uint8_t encodedZero,
+                                     uint8_t bitsPerDataBit)
+    {
+        if (!OneWireExpansion::supportsWordExpansion(bitsPerDataBit))
+        {
+            BitwiseOneWireEncodingBackend::encodeReverseInPlace(buffer, srcSize, encodedOne, encodedZero,
+                                                                bitsPerDataBit);
+            return;
+        }
+
+        const OneWireExpansion expansion = OneWireExpansion::make(encodedOne, encodedZero, bitsPerDataBit);
+        const uint32_t* spread = (bitsPerDataBit == 4) ? Spread4.data() : Spread3.data();
+
+        for (size_t srcIndex = srcSize; srcIndex > 0; --srcIndex)
+        {
+            const uint32_t packed = expansion.zeroFill ^ (spread[buffer[srcIndex - 1]] * expansion.difference);
+            storeExpandedBigEndian(buffer + ((srcIndex - 1) * bitsPerDataBit), packed, bitsPerDataBit);
+        }
+    }
+};
+
+// Table-free encoder: spreads source bits with shift/mask steps on whole words.
+// Hosts with 64-bit registers expand two source bytes per step.
+struct SwarOneWireEncodingBackend
+{
+    static constexpr uint32_t spread3(uint32_t value)
+    {
+        value &= 0xFFu;
+        value = (value | (value << 8)) & 0x00F00Fu;
+        value = (value | (value << 4)) & 0x0C30C3u;
+        value = (value | (value << 2)) & 0x249249u;
+        return value;
+    }
+
+    static constexpr uint32_t spread4(uint32_t value)
+    {
+        value &= 0xFFu;
+        value = (value | (value << 12)) & 0x000F000Fu;
+        value = (value | (value << 6)) & 0x03030303u;
+        value = (value | (value << 3)) & 0x11111111u;
+        return value;
+    }
+
+    static constexpr uint64_t spread3Pair(uint64_t value)
+    {
+        value &= 0xFFFFu;
+        value = (value | (value << 16)) & 0x0000FF0000FFull;
+        value = (value | (value << 8)) & 0x00F00F00F00Full;
+        value = (value | (value << 4)) & 0x0C30C30C30C3ull;
+        value = (value | (value << 2)) & 0x249249249249ull;
+        return value;
+    }
+
+    static constexpr uint64_t spread4Pair(uint64_t value)
+    {
+        value &= 0xFFFFu;
+        value = (value | (value << 24)) & 0x000000FF000000FFull;
+        value = (value | (value << 12)) & 0x000F000F000F000Full;
+        value = (value | (value << 6)) & 0x0303030303030303ull;
+        value = (value | (value << 3)) & 0x1111111111111111ull;
+        return value;
+    }
+
+    static uint32_t expand(uint8_t value, const OneWireExpansion& expansion)
+    {
+        const uint32_t spread = (expansion.bitsPerDataBit == 4) ? spread4(value) : spread3(value);
+        return expansion.zeroFill ^ (spread * expansion.difference);
+    }
+
+    static uint32_t expandByte(uint8_t value, uint8_t encodedOne, uint8_t encodedZero, uint8_t bitsPerDataBit)
+    {
+        if (!OneWireExpansion::supportsWordExpansion(bitsPerDataBit))
+        {
+            return BitwiseOneWireEncodingBackend::expandByte(value, encodedOne, encodedZero, bitsPerDataBit);
+        }
+
+        return expand(value, OneWireExpansion::make(encodedOne, encodedZero, bitsPerDataBit));
+    }
+
+    static void encodeReverseInPlace(uint8_t* buffer, size_t srcSize, uint8_t encodedOne, uint8_t encodedZero,
+                                     uint8_t bitsPerDataBit)
+    {
+        if (!OneWireExpansion::supportsWordExpansion(bitsPerDataBit))
+        {
+            BitwiseOneWireEncodingBackend::encodeReverseInPlace(buffer, srcSize, encodedOne, encodedZero,
+                                                                bitsPerDataBit);
+            return;
+        }
+
+        const OneWireExpansion expansion = OneWireExpansion::make(encodedOne, encodedZero, bitsPerDataBit);
+        size_t srcIndex = srcSize;
+
+        if constexpr (sizeof(void*) >= sizeof(uint64_t))
+        {
+            const uint64_t pairZeroFill =
+                (static_cast<uint64_t>(expansion.zeroFill) << (8u * bitsPerDataBit)) | expansion.zeroFill;
+
+            // Both source bytes are read before the 2N output bytes are written; the
+            // output window never reaches below the pair being expanded.
+            for (; srcIndex >= 2; srcIndex -= 2)
+            {
+                const uint64_t value =
+                    (static_cast<uint64_t>(buffer[srcIndex - 2]) << 8) | static_cast<uint64_t>(buffer[srcIndex - 1]);
+                const uint64_t spread = (bitsPerDataBit == 4) ? spread4Pair(value) : spread3Pair(value);
+                const uint64_t packed = pairZeroFill ^ (spread * expansion.difference);
+
+                uint8_t* out = buffer + ((srcIndex - 2) * bitsPerDataBit);
+                const uint8_t byteCount = static_cast<uint8_t>(bitsPerDataBit * 2u);
+                for (uint8_t byteIndex = 0; byteIndex < byteCount; ++byteIndex)
+                {
+                    out[byteIndex] = static_cast<uint8_t>(packed >> ((byteCount - 1u - byteIndex) * 8u));
+                }
+            }
+        }
+
+        for (; srcIndex > 0; --srcIndex)
+        {
+            storeExpandedBigEndian(buffer + ((srcIndex - 1) * bitsPerDataBit), expand(buffer[srcIndex - 1], expansion),
+                                   bitsPerDataBit);
+        }
+    }
+};
+
+} // namespace lw::transports::detail
@@ -49,6 +49,9 @@ class PrintTransportT : public ITransport
 {
   public:
     using TransportSettingsType = PrintTransportSettingsT<TWritable>;
+    static constexpr bool CompletesSynchronously = true;
+    static constexpr bool PreservesBuffer = true;
+    static constexpr bool StreamsChunks = true;
     explicit PrintTransportT(PrintTransportSettingsT<TWritable> config) : _config{std::move(config)}
     {
         captureIdentifier();
@@ -40,6 +40,9 @@ class SpiTransport : public ITransport
 {
   public:
     using TransportSettingsType = SpiTransportSettings;
+    static constexpr bool CompletesSynchronously = true;
+    static constexpr bool PreservesBuffer = true;
+    static constexpr bool StreamsChunks = true;
 
     explicit SpiTransport(SpiTransportSettings config) : _config{config} {}
 
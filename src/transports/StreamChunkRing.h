@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "core/Compat.h"
+#include "transports/ITransport.h"
+
+namespace lw::transports
+{
+
+// Pulls an encoded frame from a streaming source in fixed-size chunks and hands each
+// chunk to the transport inside one transaction.
+//
+// The chunks are carved from caller-owned storage and used round-robin, so peak
+// memory is `storage.size()` no matter how long the frame is. A transport that queues
+// a chunk and returns early may keep it in flight while the next `chunkCount - 1`
+// chunks are filled; it must be done with it before that slot comes around again.
+class StreamChunkRing
+{
+  public:
+    StreamChunkRing(span<uint8_t> storage, size_t chunkCount)
+        : _storage{storage}, _chunkCount{(chunkCount == 0) ? 1 : chunkCount},
+          _chunkBytes{storage.size() / _chunkCount}
+    {
+    }
+
+    size_t chunkBytes() const { return _chunkBytes; }
+
+    size_t chunkCount() const { return _chunkCount; }
+
+    // `source.encodeNext(span<uint8_t>)` fills up to one chunk and returns the byte
+    // count, 0 when the frame is complete. Returns the total bytes transmitted.
+    template <typename TSource> size_t transmit(ITransport& transport, TSource& source)
+    {
+        if (_chunkBytes == 0)
+        {
+            return 0;
+        }
+
+        size_t total = 0;
+        size_t slot = 0;
+
+        transport.beginTransaction();
+        for (;;)
+        {
+            uint8_t* chunk = _storage.data() + (slot * _chunkBytes);
+            const size_t produced = source.encodeNext(span<uint8_t>{chunk, _chunkBytes});
+            if (produced == 0)
+            {
+                break;
+            }
+
+            transport.transmitBytes(span<uint8_t>{chunk, produced});
+            total += produced;
+            slot = (slot + 1 == _chunkCount) ? 0 : slot + 1;
+        }
+        transport.endTransaction();
+
+        return total;
+    }
+
+  private:
+    span<uint8_t> _storage;
+    size_t _chunkCount;
+    size_t _chunkBytes;
+};
+
+} // namespace lw::transports
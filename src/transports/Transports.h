@@ -9,6 +9,7 @@
 #include "transports/PrintLightDriver.h"
 #include "transports/PrintTransport.h"
 #include "transports/SpiTransport.h"
+#include "transports/StreamChunkRing.h"
 
 #ifdef ARDUINO_ARCH_RP2040
 #include "transports/rp2040/RpPwmLightDriver.h"
@@ -16,6 +16,8 @@
 #include "esp_intr.h"
 #endif
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/timers.h"
 #include "rom/lldesc.h"
 #include "soc/gpio_sig_map.h"
 #include "soc/i2s_struct.h"
@@ -45,6 +47,8 @@ class Esp32I2sTransport : public ITransport
   public:
     using TransportSettingsType = Esp32I2sTransportSettings;
     static constexpr size_t DmaBitsPerClockDataBit = 1;
+    static constexpr bool SignalsTransferComplete = true;
+    static constexpr bool PreservesBuffer = true;
 
     explicit Esp32I2sTransport(Esp32I2sTransportSettings config) : _config{config}, _bus{resolveBus(config.busNumber)}
     {
@@ -54,7 +58,7 @@ class Esp32I2sTransport : public ITransport
     {
         if (_initialised)
         {
-            while (!isReadyToUpdate())
+            while (!isReadyToUpdate() || _deliveryRunning)
             {
                 yield();
             }
@@ -100,7 +104,17 @@ class Esp32I2sTransport : public ITransport
         {
             return true;
         }
-        return i2sWriteDone();
+        return i2sWriteDone() && !_deliveryPending;
+    }
+
+    // The DMA interrupt only queues the callback; it runs in the FreeRTOS timer service
+    // task. If that queue is full the callback is skipped and the bus's pollCompletion()
+    // delivers the completion instead. Until a queued callback runs the transport reports
+    // busy, so no new frame starts that a late callback could be mistaken for.
+    void setTransferCompleteCallback(TransferCompleteCallback callback, void* context) override
+    {
+        _transferCompleteContext = context;
+        _transferComplete = callback;
     }
 
   private:
@@ -130,6 +144,10 @@ class Esp32I2sTransport : public ITransport
     size_t _dmaCount{0};
     size_t _dataBlockCount{0};
     volatile uint32_t _sendState{I2sIsIdle};
+    volatile TransferCompleteCallback _transferComplete{nullptr};
+    void* volatile _transferCompleteContext{nullptr};
+    volatile bool _deliveryPending{false};
+    volatile bool _deliveryRunning{false};
     uint8_t* _silenceBuffer{nullptr};
     size_t _frameBytes{0};
     bool _initialised{false};
@@ -488,15 +506,52 @@ class Esp32I2sTransport : public ITransport
             return;
         }
 
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+
         if (_bus->int_st.out_eof && _sendState != I2sIsIdle)
         {
             lldesc_t* loop = &_dmaItems[0];
             lldesc_t* loopBreaker = loop + 1;
             loopBreaker->qe.stqe_next = loop;
             _sendState = I2sIsIdle;
+
+            // The handler is IRAM-resident and may run while the flash cache is off; the
+            // callback and everything it calls are not, so they run from a task instead.
+            if (_transferComplete != nullptr)
+            {
+                _deliveryPending = true;
+                _deliveryRunning = true;
+                if (xTimerPendFunctionCallFromISR(&Esp32I2sTransport::deliverTransferComplete, this, 0,
+                                                  &higherPriorityTaskWoken) != pdPASS)
+                {
+                    _deliveryPending = false;
+                    _deliveryRunning = false;
+                }
+            }
         }
 
         _bus->int_clr.val = _bus->int_st.val;
+
+        if (higherPriorityTaskWoken == pdTRUE)
+        {
+            portYIELD_FROM_ISR();
+        }
+    }
+
+    static void deliverTransferComplete(void* context, uint32_t)
+    {
+        auto* self = static_cast<Esp32I2sTransport*>(context);
+
+        // Ready again before the callback runs, so the bus can deliver the completion
+        // from it; teardown still waits for the callback to return.
+        self->_deliveryPending = false;
+        TransferCompleteCallback callback = self->_transferComplete;
+        if (callback != nullptr)
+        {
+            callback(self->_transferCompleteContext);
+        }
+
+        self->_deliveryRunning = false;
     }
 
     bool initI2s(size_t dmaBlockCount, uint16_t bitSendTimeNs)
@@ -675,7 +730,7 @@ class Esp32I2sTransport : public ITransport
 
         if (_initialised)
         {
-            while (!isReadyToUpdate())
+            while (!isReadyToUpdate() || _deliveryRunning)
             {
                 yield();
             }
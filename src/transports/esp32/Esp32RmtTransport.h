@@ -45,6 +45,7 @@ class Esp32RmtTransport : public ITransport
 {
   public:
     using TransportSettingsType = Esp32RmtTransportSettings;
+    static constexpr bool PreservesBuffer = true;
     explicit Esp32RmtTransport(Esp32RmtTransportSettings config) : _config{config} { _computeRmtItems(); }
 
     ~Esp32RmtTransport()
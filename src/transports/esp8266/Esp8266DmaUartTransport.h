@@ -38,6 +38,10 @@ class Esp8266DmaUartTransport : public ITransport
 {
   public:
     using TransportSettingsType = Esp8266DmaUartTransportSettings;
+    // Bytes are copied into the UART FIFO before transmitBytes() returns.
+    static constexpr bool CompletesSynchronously = true;
+    static constexpr bool PreservesBuffer = true;
+    static constexpr bool StreamsChunks = true;
     static constexpr size_t UartFifoSize = 128;
     static constexpr uint8_t Uart0Pin = 1;
     static constexpr uint8_t Uart1Pin = 2;
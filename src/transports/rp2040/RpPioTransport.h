@@ -29,6 +29,7 @@ class RpPioTransport : public ITransport
 {
   public:
     using TransportSettingsType = RpPioTransportSettings;
+    static constexpr bool PreservesBuffer = true;
 
     explicit RpPioTransport(RpPioTransportSettings config)
         : _config{config},
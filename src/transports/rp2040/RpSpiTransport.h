@@ -31,6 +31,7 @@ class RpSpiTransport : public ITransport
 {
   public:
     using TransportSettingsType = RpSpiTransportSettings;
+    static constexpr bool PreservesBuffer = true;
 
     explicit RpSpiTransport(RpSpiTransportSettings config)
         : _config{config},
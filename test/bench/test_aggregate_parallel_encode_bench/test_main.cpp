@@ -0,0 +1,111 @@
+#include <unity.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "BenchHelpers.h"
+#include "buses/AggregateBus.h"
+#include "buses/PixelBus.h"
+#include "colors/Color.h"
+#include "colors/GammaShader.h"
+#include "core/ThreadPoolExecutor.h"
+#include "protocols/Ws2812xProtocol.h"
+#include "transports/NilTransport.h"
+
+namespace
+{
+constexpr size_t BusCount = 32;
+constexpr size_t PixelsPerBus = 1000;
+constexpr size_t Iterations = 50;
+
+using Ws2812x = lw::protocols::Ws2812xProtocol<lw::Rgb8Color>;
+using GammaBus = lw::busses::PixelBus<Ws2812x, lw::transports::NilTransport, lw::shaders::GammaShader<lw::Rgb8Color>>;
+
+std::unique_ptr<lw::busses::AggregateBus<lw::Rgb8Color>> make_aggregate(std::vector<GammaBus*>& members)
+{
+    std::vector<std::unique_ptr<lw::IPixelBus<lw::Rgb8Color>>> buses{};
+    uint32_t state = 0xBADC0DEu;
+    for (size_t bus = 0; bus < BusCount; ++bus)
+    {
+        auto member = std::make_unique<GammaBus>(
+            PixelsPerBus, lw::protocols::Ws2812xProtocolSettings{{}, lw::ChannelOrder::GRB::value},
+            lw::transports::NilTransportSettings{}, lw::shaders::GammaShader<lw::Rgb8Color>{});
+        for (auto& color : member->rootPixels())
+        {
+            state = (state * 1664525u) + 1013904223u;
+            color = lw::Rgb8Color{static_cast<uint8_t>(state >> 8), static_cast<uint8_t>(state >> 16),
+                                  static_cast<uint8_t>(state >> 24)};
+        }
+
+        members.push_back(member.get());
+        buses.emplace_back(std::move(member));
+    }
+
+    return std::make_unique<lw::busses::AggregateBus<lw::Rgb8Color>>(std::move(buses));
+}
+
+void test_bench_aggregate_encode_scaling(void)
+{
+    std::vector<GammaBus*> members{};
+    auto aggregate = make_aggregate(members);
+
+    const auto showFrame = [&]()
+    {
+        for (auto* member : members)
+        {
+            member->pixels();
+        }
+
+        aggregate->show();
+        lw::test::doNotOptimize(members.back()->protocolBuffer().data());
+    };
+
+    showFrame();
+    const std::vector<uint8_t> sequentialFrame(members.back()->protocolBuffer().begin(),
+                                               members.back()->protocolBuffer().end());
+
+    const size_t hardwareThreads = std::thread::hardware_concurrency();
+    const size_t maxWorkers = (hardwareThreads < 2) ? 2 : hardwareThreads;
+    double singleWorkerNs = 0.0;
+    for (size_t workers = 1; workers <= maxWorkers; workers *= 2)
+    {
+        lw::ThreadPoolExecutor executor(workers);
+        aggregate->setExecutor(&executor);
+
+        const double ns = lw::test::measureNsPerIteration(Iterations, showFrame);
+        singleWorkerNs = (workers == 1) ? ns : singleWorkerNs;
+
+        char name[64]{};
+        std::snprintf(name, sizeof(name), "aggregate/show/32x1000/workers_%zu", workers);
+        lw::test::reportBenchmark(name, BusCount * PixelsPerBus, ns);
+        std::printf("[bench] %-48s %10.2fx\n", "  speedup vs 1 worker", singleWorkerNs / ns);
+
+        aggregate->setExecutor(nullptr);
+    }
+
+    const std::vector<uint8_t> parallelFrame(members.back()->protocolBuffer().begin(),
+                                             members.back()->protocolBuffer().end());
+    TEST_ASSERT_TRUE(parallelFrame == sequentialFrame);
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_aggregate_encode_scaling);
+    return UNITY_END();
+}
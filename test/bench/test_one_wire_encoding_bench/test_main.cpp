@@ -0,0 +1,96 @@
+#include <unity.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "BenchHelpers.h"
+#include "transports/OneWireEncoding.h"
+#include "transports/OneWireEncodingBackend.h"
+
+namespace
+{
+using lw::transports::OneWireEncoding;
+
+constexpr size_t PixelCount = 4096;
+constexpr size_t ChannelCount = 3;
+constexpr size_t RawBytes = PixelCount * ChannelCount;
+constexpr size_t Iterations = 200;
+
+std::vector<uint8_t> make_frame()
+{
+    std::vector<uint8_t> frame(RawBytes);
+    uint32_t state = 0xC0FFEEu;
+    for (auto& value : frame)
+    {
+        state = (state * 1664525u) + 1013904223u;
+        value = static_cast<uint8_t>(state >> 24);
+    }
+    return frame;
+}
+
+template <typename TBackend>
+std::vector<uint8_t> run_backend(const char* name, const std::vector<uint8_t>& frame, uint8_t one, uint8_t zero,
+                                 uint8_t bits)
+{
+    std::vector<uint8_t> buffer(RawBytes * bits, 0);
+    const double ns = lw::test::measureNsPerIteration(Iterations,
+                                                      [&]()
+                                                      {
+                                                          std::copy(frame.begin(), frame.end(), buffer.begin());
+                                                          TBackend::encodeReverseInPlace(buffer.data(), RawBytes, one,
+                                                                                         zero, bits);
+                                                          lw::test::doNotOptimize(buffer.data());
+                                                      });
+    lw::test::reportBenchmark(name, PixelCount, ns);
+    return buffer;
+}
+
+void compare_backends(uint8_t one, uint8_t zero, uint8_t bits, const char* bitwiseName, const char* tableName,
+                      const char* swarName)
+{
+    const auto frame = make_frame();
+
+    const auto reference =
+        run_backend<lw::transports::detail::BitwiseOneWireEncodingBackend>(bitwiseName, frame, one, zero, bits);
+    const auto table =
+        run_backend<lw::transports::detail::TableOneWireEncodingBackend>(tableName, frame, one, zero, bits);
+    const auto swar = run_backend<lw::transports::detail::SwarOneWireEncodingBackend>(swarName, frame, one, zero, bits);
+
+    TEST_ASSERT_TRUE(reference == table);
+    TEST_ASSERT_TRUE(reference == swar);
+}
+
+void test_bench_three_step_4096_pixels(void)
+{
+    compare_backends(OneWireEncoding::EncodedOne3Step, OneWireEncoding::EncodedZero3Step, 3,
+                     "one_wire/3step/bitwise/4096", "one_wire/3step/table/4096", "one_wire/3step/swar/4096");
+}
+
+void test_bench_four_step_idle_high_4096_pixels(void)
+{
+    compare_backends(static_cast<uint8_t>(~OneWireEncoding::EncodedOne4Step & 0x0F),
+                     static_cast<uint8_t>(~OneWireEncoding::EncodedZero4Step & 0x0F), 4,
+                     "one_wire/4step_inverted/bitwise/4096", "one_wire/4step_inverted/table/4096",
+                     "one_wire/4step_inverted/swar/4096");
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_three_step_4096_pixels);
+    RUN_TEST(test_bench_four_step_idle_high_4096_pixels);
+    return UNITY_END();
+}
@@ -0,0 +1,146 @@
+#include <unity.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "BenchHelpers.h"
+#include "colors/Color.h"
+#include "core/PixelView.h"
+#include "core/PixelViewAlgorithms.h"
+
+namespace
+{
+using Color = lw::Rgb8Color;
+
+// An aggregate bus's view: one chunk per strip.
+constexpr size_t StripCount = 8;
+
+struct StripView
+{
+    explicit StripView(size_t pixelCount) : colors(lw::test::makeBenchColors<Color>(pixelCount))
+    {
+        const size_t stripPixels = pixelCount / StripCount;
+        for (size_t strip = 0; strip < StripCount; ++strip)
+        {
+            const size_t first = strip * stripPixels;
+            const size_t count = (strip + 1 == StripCount) ? pixelCount - first : stripPixels;
+            chunks[strip] = lw::span<Color>{colors.data() + first, count};
+        }
+    }
+
+    lw::PixelView<Color> view() { return lw::PixelView<Color>{lw::span<lw::span<Color>>{chunks.data(), chunks.size()}}; }
+
+    std::vector<Color> colors;
+    std::array<lw::span<Color>, StripCount> chunks{};
+};
+
+template <typename TFunction>
+void bench(const char* operation, size_t pixelCount, size_t bytesPerIteration, TFunction&& function)
+{
+    const double ns = lw::test::measureNsPerIteration(lw::test::benchIterations(pixelCount), function);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "pixel_view_bulk/%s/%zu", operation, pixelCount);
+    lw::test::reportBenchmark(name, pixelCount, ns, bytesPerIteration);
+}
+
+// Bulk operations against a single memcpy of the frame and against the same copy done
+// pixel by pixel through the view's iterators.
+void test_bench_pixel_view_bulk_operations(void)
+{
+    const Color fill{1, 2, 3};
+
+    for (const size_t pixelCount : lw::test::BenchPixelCounts)
+    {
+        StripView source(pixelCount);
+        StripView destination(pixelCount);
+        auto sourceView = source.view();
+        auto view = destination.view();
+        const size_t frameBytes = pixelCount * sizeof(Color);
+
+        bench("memcpy_reference", pixelCount, frameBytes,
+              [&]()
+              {
+                  std::memcpy(destination.colors.data(), source.colors.data(), frameBytes);
+                  lw::test::doNotOptimize(destination.colors.data());
+              });
+
+        bench("iterator_copy", pixelCount, frameBytes,
+              [&]()
+              {
+                  auto target = view.begin();
+                  for (const auto& color : sourceView)
+                  {
+                      *target = color;
+                      ++target;
+                  }
+                  lw::test::doNotOptimize(destination.colors.data());
+              });
+
+        bench("copy", pixelCount, frameBytes,
+              [&]()
+              {
+                  lw::copyPixels(view, sourceView);
+                  lw::test::doNotOptimize(destination.colors.data());
+              });
+
+        bench("fill", pixelCount, frameBytes,
+              [&]()
+              {
+                  lw::fillPixels(view, fill);
+                  lw::test::doNotOptimize(destination.colors.data());
+              });
+
+        bench("shift_left_1", pixelCount, frameBytes,
+              [&]()
+              {
+                  lw::shiftPixelsLeft(view, 1, fill);
+                  lw::test::doNotOptimize(destination.colors.data());
+              });
+
+        bench("rotate_right_1", pixelCount, frameBytes,
+              [&]()
+              {
+                  lw::rotatePixelsRight(view, 1);
+                  lw::test::doNotOptimize(destination.colors.data());
+              });
+
+        bench("rotate_half", pixelCount, frameBytes,
+              [&]()
+              {
+                  lw::rotatePixelsLeft(view, static_cast<uint32_t>(pixelCount / 2));
+                  lw::test::doNotOptimize(destination.colors.data());
+              });
+
+        bench("reverse", pixelCount, frameBytes,
+              [&]()
+              {
+                  lw::reversePixels(view);
+                  lw::test::doNotOptimize(destination.colors.data());
+              });
+
+        TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(pixelCount), view.size());
+    }
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_pixel_view_bulk_operations);
+    return UNITY_END();
+}
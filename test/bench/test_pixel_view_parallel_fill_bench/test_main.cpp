@@ -0,0 +1,156 @@
+#include <unity.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "BenchHelpers.h"
+#include "colors/Color.h"
+#include "core/PixelView.h"
+#include "core/PixelViewExecution.h"
+#include "core/ThreadPoolExecutor.h"
+
+namespace
+{
+using Color = lw::Rgb8Color;
+
+// A 256x256 canvas driven as 16 strips of 4096 pixels.
+constexpr uint32_t CanvasWidth = 256;
+constexpr uint32_t CanvasPixels = CanvasWidth * CanvasWidth;
+constexpr size_t StripCount = 16;
+constexpr size_t Iterations = 20;
+
+struct Canvas
+{
+    Canvas() : colors(CanvasPixels)
+    {
+        const size_t stripPixels = CanvasPixels / StripCount;
+        for (size_t strip = 0; strip < StripCount; ++strip)
+        {
+            chunks[strip] = lw::span<Color>{colors.data() + (strip * stripPixels), stripPixels};
+        }
+    }
+
+    lw::PixelView<Color> view() { return lw::PixelView<Color>{lw::span<lw::span<Color>>{chunks.data(), chunks.size()}}; }
+
+    std::vector<Color> colors;
+    std::array<lw::span<Color>, StripCount> chunks{};
+};
+
+uint32_t lattice(uint32_t x, uint32_t y)
+{
+    uint32_t hash = (x * 374761393u) + (y * 668265263u);
+    hash = (hash ^ (hash >> 13)) * 1274126177u;
+    return hash ^ (hash >> 16);
+}
+
+// Three octaves of bilinear value noise, a stand-in for a host effect's generator.
+uint8_t valueNoise(uint32_t x, uint32_t y)
+{
+    uint32_t total = 0;
+    for (uint32_t octave = 0; octave < 3; ++octave)
+    {
+        const uint32_t cell = 32u >> octave;
+        const uint32_t cx = x / cell;
+        const uint32_t cy = y / cell;
+        const uint32_t fx = ((x % cell) * 256u) / cell;
+        const uint32_t fy = ((y % cell) * 256u) / cell;
+        const uint32_t top = ((lattice(cx, cy) & 0xFF) * (256u - fx)) + ((lattice(cx + 1, cy) & 0xFF) * fx);
+        const uint32_t bottom =
+            ((lattice(cx, cy + 1) & 0xFF) * (256u - fx)) + ((lattice(cx + 1, cy + 1) & 0xFF) * fx);
+        total += ((top * (256u - fy)) + (bottom * fy)) >> (16 + octave);
+    }
+
+    return static_cast<uint8_t>(total > 255 ? 255 : total);
+}
+
+Color noisePixel(uint32_t index)
+{
+    const uint32_t x = index % CanvasWidth;
+    const uint32_t y = index / CanvasWidth;
+    return Color{valueNoise(x, y), valueNoise(x + 97, y), valueNoise(x, y + 193)};
+}
+
+template <typename TFunction> double bench(const char* name, TFunction&& function)
+{
+    const double ns = lw::test::measureNsPerIteration(Iterations, function);
+    lw::test::reportBenchmark(name, CanvasPixels, ns);
+    return ns;
+}
+
+// The per-pixel iterator loop against each execution policy, and the parallel policy
+// across worker counts. Every run must produce the sequential frame.
+void test_bench_fill_pixels_indexed_scaling(void)
+{
+    Canvas canvas;
+    auto view = canvas.view();
+
+    bench("parallel_fill/64k/iterator_loop",
+          [&]()
+          {
+              uint32_t index = 0;
+              for (auto& pixel : view)
+              {
+                  pixel = noisePixel(index++);
+              }
+              lw::test::doNotOptimize(canvas.colors.data());
+          });
+    const std::vector<Color> expected = canvas.colors;
+
+    bench("parallel_fill/64k/seq",
+          [&]()
+          {
+              lw::fillPixelsIndexed(lw::execution::seq, view, noisePixel);
+              lw::test::doNotOptimize(canvas.colors.data());
+          });
+    TEST_ASSERT_TRUE(expected == canvas.colors);
+
+    bench("parallel_fill/64k/unseq",
+          [&]()
+          {
+              lw::fillPixelsIndexed(lw::execution::unseq, view, noisePixel);
+              lw::test::doNotOptimize(canvas.colors.data());
+          });
+    TEST_ASSERT_TRUE(expected == canvas.colors);
+
+    const size_t hardwareThreads = std::thread::hardware_concurrency();
+    const size_t maxWorkers = (hardwareThreads < 2) ? 2 : hardwareThreads;
+    double singleWorkerNs = 0.0;
+    for (size_t workers = 1; workers <= maxWorkers; workers *= 2)
+    {
+        lw::ThreadPoolExecutor executor(workers);
+        char name[64]{};
+        std::snprintf(name, sizeof(name), "parallel_fill/64k/par_workers_%zu", workers);
+
+        const double ns = bench(name,
+                                [&]()
+                                {
+                                    lw::fillPixelsIndexed(lw::execution::par(executor), view, noisePixel);
+                                    lw::test::doNotOptimize(canvas.colors.data());
+                                });
+        singleWorkerNs = (workers == 1) ? ns : singleWorkerNs;
+        std::printf("[bench] %-48s %10.2fx\n", "  speedup vs 1 worker", singleWorkerNs / ns);
+        TEST_ASSERT_TRUE(expected == canvas.colors);
+    }
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_fill_pixels_indexed_scaling);
+    return UNITY_END();
+}
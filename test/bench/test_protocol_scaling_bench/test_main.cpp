@@ -0,0 +1,142 @@
+#include <unity.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "BenchHelpers.h"
+#include "colors/Color.h"
+#include "protocols/DotStarProtocol.h"
+#include "protocols/Lpd6803Protocol.h"
+#include "protocols/Lpd8806Protocol.h"
+#include "protocols/P9813Protocol.h"
+#include "protocols/PixieProtocol.h"
+#include "protocols/Sm16716Protocol.h"
+#include "protocols/Sm168xProtocol.h"
+#include "protocols/Tlc59711Protocol.h"
+#include "protocols/Tm1814Protocol.h"
+#include "protocols/Tm1914Protocol.h"
+#include "protocols/Ws2801Protocol.h"
+#include "protocols/Ws2812xProtocol.h"
+#include "transports/OneWireEncoding.h"
+
+namespace
+{
+// Runs `update()` of one protocol over every benchmark size; bytes/s counts the
+// protocol buffer written per frame.
+template <typename TProtocol>
+void bench_protocol_update(const char* protocolName, const typename TProtocol::SettingsType& settings)
+{
+    using ColorType = typename TProtocol::ColorType;
+
+    for (const size_t pixelCount : lw::test::BenchPixelCounts)
+    {
+        const auto colors = lw::test::makeBenchColors<ColorType>(pixelCount);
+        const lw::span<const ColorType> input{colors.data(), colors.size()};
+
+        TProtocol protocol(static_cast<lw::PixelCount>(pixelCount), settings);
+        std::vector<uint8_t> buffer(protocol.requiredBufferSizeBytes(), 0);
+        const lw::span<uint8_t> bytes{buffer.data(), buffer.size()};
+
+        const double ns = lw::test::measureNsPerIteration(lw::test::benchIterations(pixelCount),
+                                                          [&]()
+                                                          {
+                                                              protocol.update(input, bytes);
+                                                              lw::test::doNotOptimize(buffer.data());
+                                                          });
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "%s/update/%zu", protocolName, pixelCount);
+        lw::test::reportBenchmark(name, pixelCount, ns, buffer.size());
+        TEST_ASSERT_FALSE(buffer.empty());
+    }
+}
+
+void test_bench_one_wire_protocol_update(void)
+{
+    using namespace lw::protocols;
+    namespace order = lw::ChannelOrder;
+
+    bench_protocol_update<Ws2812xProtocol<lw::Rgb8Color>>("ws2812x", Ws2812xProtocolSettings{{}, order::GRB::value});
+
+    Tm1814ProtocolSettings tm1814{};
+    bench_protocol_update<Tm1814ProtocolT<lw::Rgbw8Color>>("tm1814", tm1814);
+
+    Tm1914ProtocolSettings tm1914{};
+    bench_protocol_update<Tm1914ProtocolT<lw::Rgb8Color>>("tm1914", tm1914);
+}
+
+void test_bench_clocked_protocol_update(void)
+{
+    using namespace lw::protocols;
+    namespace order = lw::ChannelOrder;
+
+    bench_protocol_update<Apa102Protocol<lw::Rgb8Color>>("apa102", Apa102ProtocolSettings{});
+    bench_protocol_update<Hd108Protocol<lw::Rgb16Color>>("hd108", Hd108ProtocolSettings{});
+    bench_protocol_update<Lpd6803ProtocolT<lw::Rgb8Color>>("lpd6803", Lpd6803ProtocolSettings{});
+    bench_protocol_update<Lpd8806ProtocolT<lw::Rgb8Color>>("lpd8806", Lpd8806ProtocolSettings{});
+    bench_protocol_update<P9813ProtocolT<lw::Rgb8Color>>("p9813", P9813ProtocolSettings{});
+    bench_protocol_update<PixieProtocolT<lw::Rgb8Color>>("pixie", PixieProtocolSettings{});
+    bench_protocol_update<Ws2801ProtocolT<lw::Rgb8Color>>("ws2801", Ws2801ProtocolSettings{});
+    bench_protocol_update<Tlc59711ProtocolT<lw::Rgb8Color>>("tlc59711", Tlc59711ProtocolSettings{});
+    bench_protocol_update<Sm16716ProtocolT<lw::Rgb8Color>>("sm16716", Sm16716ProtocolSettings{{}, order::RGB::value});
+
+    Sm168xProtocolSettings sm168x{};
+    sm168x.channelOrder = order::RGBW::value;
+    bench_protocol_update<Sm168xProtocol<lw::Rgbw8Color>>("sm168x", sm168x);
+}
+
+void test_bench_one_wire_encoding_expansion(void)
+{
+    constexpr size_t ChannelCount = 3;
+    const lw::transports::OneWireTiming timing = lw::transports::timing::Ws2812x;
+
+    for (const size_t pixelCount : lw::test::BenchPixelCounts)
+    {
+        const auto colors = lw::test::makeBenchColors<lw::Rgb8Color>(pixelCount);
+        std::vector<uint8_t> raw(pixelCount * ChannelCount);
+        for (size_t pixel = 0; pixel < pixelCount; ++pixel)
+        {
+            for (size_t channel = 0; channel < ChannelCount; ++channel)
+            {
+                raw[(pixel * ChannelCount) + channel] = colors[pixel].channelAtIndex(channel);
+            }
+        }
+
+        std::vector<uint8_t> encoded(
+            lw::transports::OneWireEncoding::expandedPayloadSizeBytes(raw.size(), timing.bitPattern()), 0);
+        const double ns = lw::test::measureNsPerIteration(lw::test::benchIterations(pixelCount),
+                                                          [&]()
+                                                          {
+                                                              lw::transports::OneWireEncoding::encodeInPlace(
+                                                                  raw.data(), raw.size(), encoded.data(),
+                                                                  encoded.size(), timing);
+                                                              lw::test::doNotOptimize(encoded.data());
+                                                          });
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "one_wire/encode/%zu", pixelCount);
+        lw::test::reportBenchmark(name, pixelCount, ns, encoded.size());
+    }
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_one_wire_protocol_update);
+    RUN_TEST(test_bench_clocked_protocol_update);
+    RUN_TEST(test_bench_one_wire_encoding_expansion);
+    return UNITY_END();
+}
@@ -0,0 +1,296 @@
+#include <unity.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "BenchHelpers.h"
+#include "colors/Color.h"
+#include "colors/GammaShader.h"
+#include "protocols/DotStarProtocol.h"
+#include "protocols/Sm16716Protocol.h"
+#include "protocols/Sm168xProtocol.h"
+#include "protocols/Tm1814Protocol.h"
+#include "protocols/Tm1914Protocol.h"
+#include "protocols/Ws2812xProtocol.h"
+#include "transports/OneWireEncoding.h"
+
+namespace
+{
+constexpr uint16_t PixelCount = 4096;
+constexpr size_t Iterations = 200;
+
+template <typename TColor> std::vector<TColor> make_colors(size_t count)
+{
+    std::vector<TColor> colors(count);
+    uint32_t state = 0xBADC0DEu;
+    for (auto& color : colors)
+    {
+        for (auto channel : TColor::channelIndexes())
+        {
+            state = (state * 1664525u) + 1013904223u;
+            color[channel] = static_cast<typename TColor::ComponentType>(state >> 16);
+        }
+    }
+    return colors;
+}
+
+void test_bench_ws2812x_single_pass_vs_two_step(void)
+{
+    const auto colors = make_colors<lw::Rgb8Color>(PixelCount);
+    const lw::span<const lw::Rgb8Color> input{colors.data(), colors.size()};
+
+    lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+    lw::protocols::Ws2812xProtocol<lw::Rgb8Color> protocol(PixelCount, settings);
+    std::vector<uint8_t> fused(protocol.requiredBufferSizeBytes(), 0);
+
+    const double fusedNs = lw::test::measureNsPerIteration(Iterations,
+                                                           [&]()
+                                                           {
+                                                               protocol.update(input, lw::span<uint8_t>{fused.data(),
+                                                                                                        fused.size()});
+                                                               lw::test::doNotOptimize(fused.data());
+                                                           });
+    lw::test::reportBenchmark("ws2812x/update/single_pass/4096", PixelCount, fusedNs);
+
+    // Reference: serialize raw channel bytes, then expand them in place.
+    std::vector<uint8_t> twoStep(fused.size(), 0);
+    const double twoStepNs = lw::test::measureNsPerIteration(
+        Iterations,
+        [&]()
+        {
+            size_t offset = 0;
+            for (const auto& color : colors)
+            {
+                twoStep[offset++] = color['G'];
+                twoStep[offset++] = color['R'];
+                twoStep[offset++] = color['B'];
+            }
+
+            lw::transports::OneWireEncoding::encodeWithResets(twoStep.data(), offset, twoStep.data(), twoStep.size(),
+                                                              settings.timing, 0, settings.prefixResetMultiplier,
+                                                              settings.suffixResetMultiplier, false);
+            lw::test::doNotOptimize(twoStep.data());
+        });
+    lw::test::reportBenchmark("ws2812x/update/two_step/4096", PixelCount, twoStepNs);
+
+    TEST_ASSERT_TRUE(fused == twoStep);
+}
+
+void test_bench_ws2812x_partial_update_sparkle(void)
+{
+    constexpr size_t SparklePixels = 20;
+    auto colors = make_colors<lw::Rgb8Color>(PixelCount);
+    const lw::span<const lw::Rgb8Color> input{colors.data(), colors.size()};
+
+    lw::protocols::Ws2812xProtocol<lw::Rgb8Color> protocol(
+        PixelCount, lw::protocols::Ws2812xProtocolSettings{{}, lw::ChannelOrder::GRB::value});
+    std::vector<uint8_t> buffer(protocol.requiredBufferSizeBytes(), 0);
+    const lw::span<uint8_t> bytes{buffer.data(), buffer.size()};
+    protocol.update(input, bytes);
+
+    const double fullNs = lw::test::measureNsPerIteration(Iterations,
+                                                          [&]()
+                                                          {
+                                                              protocol.update(input, bytes);
+                                                              lw::test::doNotOptimize(buffer.data());
+                                                          });
+    lw::test::reportBenchmark("ws2812x/update/full/4096", PixelCount, fullNs);
+
+    size_t first = 0;
+    const double partialNs = lw::test::measureNsPerIteration(Iterations,
+                                                             [&]()
+                                                             {
+                                                                 first = (first + 397) % (PixelCount - SparklePixels);
+                                                                 protocol.updateRange(input, bytes, first,
+                                                                                      first + SparklePixels);
+                                                                 lw::test::doNotOptimize(buffer.data());
+                                                             });
+    lw::test::reportBenchmark("ws2812x/update_range/20_of_4096", PixelCount, partialNs);
+
+    std::vector<uint8_t> expected(buffer.size(), 0);
+    protocol.update(input, lw::span<uint8_t>{expected.data(), expected.size()});
+    TEST_ASSERT_TRUE(buffer == expected);
+}
+
+template <typename TRuntimeProtocol, typename TFixedProtocol>
+void bench_channel_order(const char* runtimeName, const char* fixedName,
+                         const typename TRuntimeProtocol::SettingsType& settings)
+{
+    using ColorType = typename TRuntimeProtocol::InterfaceColorType;
+    const auto colors = make_colors<ColorType>(PixelCount);
+    const lw::span<const ColorType> input{colors.data(), colors.size()};
+
+    TRuntimeProtocol runtimeProtocol(PixelCount, settings);
+    std::vector<uint8_t> runtimeBuffer(runtimeProtocol.requiredBufferSizeBytes(), 0);
+    const double runtimeNs = lw::test::measureNsPerIteration(
+        Iterations,
+        [&]()
+        {
+            runtimeProtocol.update(input, lw::span<uint8_t>{runtimeBuffer.data(), runtimeBuffer.size()});
+            lw::test::doNotOptimize(runtimeBuffer.data());
+        });
+    lw::test::reportBenchmark(runtimeName, PixelCount, runtimeNs);
+
+    TFixedProtocol fixedProtocol(PixelCount, settings);
+    std::vector<uint8_t> fixedBuffer(fixedProtocol.requiredBufferSizeBytes(), 0);
+    const double fixedNs = lw::test::measureNsPerIteration(
+        Iterations,
+        [&]()
+        {
+            fixedProtocol.update(input, lw::span<uint8_t>{fixedBuffer.data(), fixedBuffer.size()});
+            lw::test::doNotOptimize(fixedBuffer.data());
+        });
+    lw::test::reportBenchmark(fixedName, PixelCount, fixedNs);
+
+    TEST_ASSERT_TRUE(runtimeBuffer == fixedBuffer);
+}
+
+void test_bench_channel_order_runtime_vs_fixed(void)
+{
+    using namespace lw::protocols;
+    namespace order = lw::ChannelOrder;
+
+    Ws2812xProtocolSettings ws2812x{{}, order::GRB::value};
+    bench_channel_order<Ws2812xProtocol<lw::Rgb8Color>, Ws2812xProtocol<lw::Rgb8Color, lw::Rgb8Color, order::GRB>>(
+        "ws2812x/update/runtime_order/4096", "ws2812x/update/fixed_order/4096", ws2812x);
+
+    Apa102ProtocolSettings apa102{};
+    apa102.channelOrder = order::BGR::value;
+    bench_channel_order<Apa102Protocol<lw::Rgb8Color>, Apa102Protocol<lw::Rgb8Color, lw::Rgb8Color, order::BGR>>(
+        "apa102/update/runtime_order/4096", "apa102/update/fixed_order/4096", apa102);
+
+    Hd108ProtocolSettings hd108{};
+    hd108.channelOrder = order::BGR::value;
+    bench_channel_order<Hd108Protocol<lw::Rgb16Color>, Hd108Protocol<lw::Rgb16Color, lw::Rgb16Color, order::BGR>>(
+        "hd108/update/runtime_order/4096", "hd108/update/fixed_order/4096", hd108);
+
+    Sm168xProtocolSettings sm168x{};
+    sm168x.channelOrder = order::RGBW::value;
+    bench_channel_order<Sm168xProtocol<lw::Rgbw8Color>, Sm168xProtocol<lw::Rgbw8Color, lw::Rgbw8Color, order::RGBW>>(
+        "sm168x/update/runtime_order/4096", "sm168x/update/fixed_order/4096", sm168x);
+
+    Tm1814ProtocolSettings tm1814{};
+    tm1814.channelOrder = order::WRGB::value;
+    bench_channel_order<Tm1814ProtocolT<lw::Rgbw8Color>, Tm1814ProtocolT<lw::Rgbw8Color, order::WRGB>>(
+        "tm1814/update/runtime_order/4096", "tm1814/update/fixed_order/4096", tm1814);
+
+    Tm1914ProtocolSettings tm1914{};
+    tm1914.channelOrder = order::GRB::value;
+    bench_channel_order<Tm1914ProtocolT<lw::Rgb8Color>, Tm1914ProtocolT<lw::Rgb8Color, order::GRB>>(
+        "tm1914/update/runtime_order/4096", "tm1914/update/fixed_order/4096", tm1914);
+}
+
+void test_bench_sm16716_word_writer_vs_per_bit(void)
+{
+    const auto colors = make_colors<lw::Rgb8Color>(PixelCount);
+    const lw::span<const lw::Rgb8Color> input{colors.data(), colors.size()};
+
+    const lw::protocols::Sm16716ProtocolSettings settings{{}, lw::ChannelOrder::RGB::value};
+    lw::protocols::Sm16716ProtocolT<> protocol(PixelCount, settings);
+    std::vector<uint8_t> wordBuffer(protocol.requiredBufferSizeBytes(), 0);
+    const double wordNs = lw::test::measureNsPerIteration(
+        Iterations,
+        [&]()
+        {
+            protocol.update(input, lw::span<uint8_t>{wordBuffer.data(), wordBuffer.size()});
+            lw::test::doNotOptimize(wordBuffer.data());
+        });
+    lw::test::reportBenchmark("sm16716/update/word_writer/4096", PixelCount, wordNs);
+
+    // Reference: one read-modify-write per bit, as the protocol used to serialize.
+    std::vector<uint8_t> bitBuffer(wordBuffer.size(), 0);
+    const double bitNs = lw::test::measureNsPerIteration(
+        Iterations,
+        [&]()
+        {
+            std::fill(bitBuffer.begin(), bitBuffer.end(), 0);
+            size_t bitPos = 50;
+            for (const auto& color : colors)
+            {
+                bitBuffer[bitPos / 8] |= static_cast<uint8_t>(0x80 >> (bitPos % 8));
+                ++bitPos;
+                for (size_t channel = 0; channel < 3; ++channel)
+                {
+                    const uint8_t value = color[settings.channelOrder[channel]];
+                    const size_t byteIndex = bitPos / 8;
+                    const uint8_t shift = bitPos % 8;
+                    bitBuffer[byteIndex] |= static_cast<uint8_t>(value >> shift);
+                    if (shift > 0 && byteIndex + 1 < bitBuffer.size())
+                    {
+                        bitBuffer[byteIndex + 1] |= static_cast<uint8_t>(value << (8 - shift));
+                    }
+                    bitPos += 8;
+                }
+            }
+            lw::test::doNotOptimize(bitBuffer.data());
+        });
+    lw::test::reportBenchmark("sm16716/update/per_bit/4096", PixelCount, bitNs);
+
+    TEST_ASSERT_TRUE(wordBuffer == bitBuffer);
+}
+void test_bench_apa102_fused_gamma_vs_shader_scratch(void)
+{
+    const auto colors = make_colors<lw::Rgb8Color>(PixelCount);
+    const lw::span<const lw::Rgb8Color> input{colors.data(), colors.size()};
+
+    lw::shaders::GammaShader<lw::Rgb8Color> shader{};
+    lw::protocols::Apa102Protocol<lw::Rgb8Color> protocol(PixelCount, lw::protocols::Apa102ProtocolSettings{});
+    std::vector<uint8_t> fused(protocol.requiredBufferSizeBytes(), 0);
+
+    const auto shade = [&](lw::span<lw::Rgb8Color> block)
+    {
+        for (auto& color : block)
+        {
+            shader.applyOne(color);
+        }
+    };
+    const double fusedNs = lw::test::measureNsPerIteration(
+        Iterations,
+        [&]()
+        {
+            protocol.updateShaded(input, lw::span<uint8_t>{fused.data(), fused.size()}, shade);
+            lw::test::doNotOptimize(fused.data());
+        });
+    lw::test::reportBenchmark("apa102/gamma/fused_blocks/4096", PixelCount, fusedNs);
+
+    // Reference: copy the frame into shader scratch, shade it, then encode.
+    std::vector<lw::Rgb8Color> scratch(colors.size());
+    std::vector<uint8_t> twoPhase(fused.size(), 0);
+    const double twoPhaseNs = lw::test::measureNsPerIteration(
+        Iterations,
+        [&]()
+        {
+            std::copy(colors.begin(), colors.end(), scratch.begin());
+            shader.apply(lw::span<lw::Rgb8Color>{scratch.data(), scratch.size()});
+            protocol.update(lw::span<const lw::Rgb8Color>{scratch.data(), scratch.size()},
+                            lw::span<uint8_t>{twoPhase.data(), twoPhase.size()});
+            lw::test::doNotOptimize(twoPhase.data());
+        });
+    lw::test::reportBenchmark("apa102/gamma/shader_scratch/4096", PixelCount, twoPhaseNs);
+
+    TEST_ASSERT_TRUE(fused == twoPhase);
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_ws2812x_single_pass_vs_two_step);
+    RUN_TEST(test_bench_channel_order_runtime_vs_fixed);
+    RUN_TEST(test_bench_ws2812x_partial_update_sparkle);
+    RUN_TEST(test_bench_sm16716_word_writer_vs_per_bit);
+    RUN_TEST(test_bench_apa102_fused_gamma_vs_shader_scratch);
+    return UNITY_END();
+}
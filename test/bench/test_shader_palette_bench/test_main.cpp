@@ -0,0 +1,153 @@
+#include <unity.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "BenchHelpers.h"
+#include "colors/AggregateShader.h"
+#include "colors/AutoWhiteBalanceShader.h"
+#include "colors/CCTWhiteBalanceShader.h"
+#include "colors/Color.h"
+#include "colors/CurrentLimiterShader.h"
+#include "colors/GammaShader.h"
+#include "colors/TemporalDitherShader.h"
+#include "colors/palette/Palette.h"
+#include "core/IndexIterator.h"
+
+namespace
+{
+// Each iteration copies the frame into scratch and shades it, as PixelBus does.
+template <typename TShader> void bench_shader_apply(const char* shaderName, TShader& shader)
+{
+    using ColorType = typename TShader::ColorType;
+
+    for (const size_t pixelCount : lw::test::BenchPixelCounts)
+    {
+        const auto colors = lw::test::makeBenchColors<ColorType>(pixelCount);
+        std::vector<ColorType> scratch(colors.size());
+        const lw::span<ColorType> frame{scratch.data(), scratch.size()};
+
+        const double ns = lw::test::measureNsPerIteration(lw::test::benchIterations(pixelCount),
+                                                          [&]()
+                                                          {
+                                                              std::copy(colors.begin(), colors.end(), scratch.begin());
+                                                              shader.apply(frame);
+                                                              lw::test::doNotOptimize(scratch.data());
+                                                          });
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "%s/apply/%zu", shaderName, pixelCount);
+        lw::test::reportBenchmark(name, pixelCount, ns, pixelCount * sizeof(ColorType));
+    }
+}
+
+void test_bench_shader_apply(void)
+{
+    lw::shaders::GammaShader<lw::Rgb8Color> gamma{};
+    bench_shader_apply("gamma", gamma);
+
+    lw::shaders::CurrentLimiterShaderSettings<lw::Rgb8Color> limiterSettings{};
+    limiterSettings.maxMilliamps = 2000;
+    lw::shaders::CurrentLimiterShader<lw::Rgb8Color> limiter{limiterSettings};
+    bench_shader_apply("current_limiter", limiter);
+
+    lw::shaders::AutoWhiteBalanceShader<lw::Rgbw8Color> autoWhite{
+        lw::shaders::AutoWhiteBalanceShaderSettings<lw::Rgbw8Color>{}};
+    bench_shader_apply("auto_white_balance", autoWhite);
+
+    lw::shaders::CCTWhiteBalanceShader<lw::Rgbcw8Color> cct{
+        lw::shaders::CCTWhiteBalanceShaderSettings<lw::Rgbcw8Color>{}};
+    bench_shader_apply("cct_white_balance", cct);
+
+    lw::shaders::TemporalDitherShader<lw::Rgb16Color> dither{lw::test::BenchPixelCounts.back()};
+    bench_shader_apply("temporal_dither", dither);
+
+    lw::shaders::AggregateShaderSettings<lw::Rgb8Color> aggregateSettings{};
+    aggregateSettings.shaders.push_back(std::make_unique<lw::shaders::GammaShader<lw::Rgb8Color>>());
+    aggregateSettings.shaders.push_back(
+        std::make_unique<lw::shaders::CurrentLimiterShader<lw::Rgb8Color>>(limiterSettings));
+    lw::shaders::AggregateShader<lw::Rgb8Color> aggregate{std::move(aggregateSettings)};
+    bench_shader_apply("aggregate_gamma_limiter", aggregate);
+}
+
+struct NamedBlendMode
+{
+    lw::colors::palettes::BlendMode mode;
+    const char* name;
+};
+
+void test_bench_sample_palette_blend_modes(void)
+{
+    using lw::colors::palettes::BlendMode;
+    using Stop = lw::colors::palettes::PaletteStop<lw::Rgb8Color>;
+
+    const lw::colors::palettes::Palette<lw::Rgb8Color> palette{
+        Stop::fromRgb8(0, 0xFF0000),   Stop::fromRgb8(36, 0xFF8000),  Stop::fromRgb8(72, 0xFFFF00),
+        Stop::fromRgb8(108, 0x00FF00), Stop::fromRgb8(144, 0x00FFFF), Stop::fromRgb8(180, 0x0000FF),
+        Stop::fromRgb8(216, 0x8000FF), Stop::fromRgb8(255, 0xFF00FF)};
+
+    const NamedBlendMode modes[] = {
+        {BlendMode::Linear, "linear"},
+        {BlendMode::Nearest, "nearest"},
+        {BlendMode::Step, "step"},
+        {BlendMode::HoldMidpoint, "hold_midpoint"},
+        {BlendMode::Smoothstep, "smoothstep"},
+        {BlendMode::Cubic, "cubic"},
+        {BlendMode::Cosine, "cosine"},
+        {BlendMode::GammaLinear, "gamma_linear"},
+        {BlendMode::Quantized, "quantized"},
+        {BlendMode::DitheredLinear, "dithered_linear"},
+    };
+
+    for (const auto& mode : modes)
+    {
+        lw::colors::palettes::PaletteSampleOptions<lw::Rgb8Color> options{};
+        options.wrapMode = lw::colors::palettes::WrapMode::Circular;
+        options.blendMode = mode.mode;
+
+        for (const size_t pixelCount : lw::test::BenchPixelCounts)
+        {
+            std::vector<lw::Rgb8Color> output(pixelCount);
+            const lw::span<lw::Rgb8Color> outputSpan{output.data(), output.size()};
+            const size_t step = std::max<size_t>(1, 256 / pixelCount);
+            size_t written = 0;
+
+            const double ns = lw::test::measureNsPerIteration(
+                lw::test::benchIterations(pixelCount),
+                [&]()
+                {
+                    written = lw::colors::palettes::samplePalette(palette, lw::IndexRange(0, step, pixelCount),
+                                                                  outputSpan, options);
+                    lw::test::doNotOptimize(output.data());
+                });
+
+            char name[64];
+            std::snprintf(name, sizeof(name), "palette/%s/%zu", mode.name, pixelCount);
+            lw::test::reportBenchmark(name, pixelCount, ns, pixelCount * sizeof(lw::Rgb8Color));
+            TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(pixelCount), static_cast<uint32_t>(written));
+        }
+    }
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_shader_apply);
+    RUN_TEST(test_bench_sample_palette_blend_modes);
+    return UNITY_END();
+}
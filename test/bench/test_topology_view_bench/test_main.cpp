@@ -0,0 +1,251 @@
+#include <unity.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "BenchHelpers.h"
+#include "colors/Color.h"
+#include "core/PixelView.h"
+#include "core/Topology.h"
+
+namespace
+{
+struct GridSize
+{
+    lw::PixelCount width;
+    lw::PixelCount height;
+};
+
+// Grids with BenchPixelCounts pixels, each dimension even so they split into 2x2 tiles.
+constexpr std::array<GridSize, 3> GridSizes{GridSize{10, 6}, GridSize{50, 20}, GridSize{100, 100}};
+
+void bench_topology_map(const char* layoutName, const lw::Topology& topology)
+{
+    const size_t pixelCount = topology.pixelCount();
+    const auto width = static_cast<int32_t>(topology.width());
+    const auto height = static_cast<int32_t>(topology.height());
+    size_t checksum = 0;
+    const double ns = lw::test::measureNsPerIteration(lw::test::benchIterations(pixelCount),
+                                                      [&]()
+                                                      {
+                                                          for (int32_t y = 0; y < height; ++y)
+                                                          {
+                                                              for (int32_t x = 0; x < width; ++x)
+                                                              {
+                                                                  checksum += topology.map(x, y);
+                                                              }
+                                                          }
+                                                          lw::test::doNotOptimize(&checksum);
+                                                      });
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "topology/%s/%zu", layoutName, pixelCount);
+    lw::test::reportBenchmark(name, pixelCount, ns);
+    TEST_ASSERT_TRUE(checksum != 0);
+}
+
+void test_bench_topology_map(void)
+{
+    using lw::GridMapping;
+
+    for (const auto& grid : GridSizes)
+    {
+        bench_topology_map("serpentine", lw::Topology{lw::TopologySettings{grid.width, grid.height,
+                                                                           GridMapping::RowsFirstSerpentine, 1, 1,
+                                                                           GridMapping::RowsFirstProgressive, false}});
+
+        bench_topology_map("tiled_mosaic",
+                           lw::Topology{lw::TopologySettings{static_cast<lw::PixelCount>(grid.width / 2),
+                                                             static_cast<lw::PixelCount>(grid.height / 2),
+                                                             GridMapping::RowsFirstSerpentine, 2, 2,
+                                                             GridMapping::RowsFirstProgressive, true}});
+    }
+}
+
+// Iterates a view over four equal chunks, the shape an aggregate bus presents.
+void test_bench_pixel_view_iteration(void)
+{
+    constexpr size_t ChunkCount = 4;
+
+    for (const size_t pixelCount : lw::test::BenchPixelCounts)
+    {
+        auto colors = lw::test::makeBenchColors<lw::Rgb8Color>(pixelCount);
+        std::array<lw::span<lw::Rgb8Color>, ChunkCount> chunks{};
+        const size_t chunkPixels = pixelCount / ChunkCount;
+        for (size_t chunk = 0; chunk < ChunkCount; ++chunk)
+        {
+            const size_t first = chunk * chunkPixels;
+            const size_t count = (chunk + 1 == ChunkCount) ? pixelCount - first : chunkPixels;
+            chunks[chunk] = lw::span<lw::Rgb8Color>{colors.data() + first, count};
+        }
+
+        lw::PixelView<lw::Rgb8Color> view(lw::span<lw::span<lw::Rgb8Color>>{chunks.data(), chunks.size()});
+        const size_t iterations = lw::test::benchIterations(pixelCount);
+        const size_t frameBytes = pixelCount * sizeof(lw::Rgb8Color);
+        uint32_t checksum = 0;
+        char name[64];
+
+        const double iterateNs = lw::test::measureNsPerIteration(iterations,
+                                                                 [&]()
+                                                                 {
+                                                                     for (auto& color : view)
+                                                                     {
+                                                                         color['R'] += 1;
+                                                                     }
+                                                                     lw::test::doNotOptimize(colors.data());
+                                                                 });
+        std::snprintf(name, sizeof(name), "pixel_view/iterate/%zu", pixelCount);
+        lw::test::reportBenchmark(name, pixelCount, iterateNs, frameBytes);
+
+        const double indexNs = lw::test::measureNsPerIteration(iterations,
+                                                               [&]()
+                                                               {
+                                                                   for (uint32_t index = 0; index < view.size(); ++index)
+                                                                   {
+                                                                       checksum += view[index]['G'];
+                                                                   }
+                                                                   lw::test::doNotOptimize(&checksum);
+                                                               });
+        std::snprintf(name, sizeof(name), "pixel_view/index/%zu", pixelCount);
+        lw::test::reportBenchmark(name, pixelCount, indexNs, frameBytes);
+
+        // Reference: a plain loop per chunk, the floor for any view traversal.
+        const double chunkNs = lw::test::measureNsPerIteration(iterations,
+                                                               [&]()
+                                                               {
+                                                                   for (auto chunk : view.chunks())
+                                                                   {
+                                                                       for (auto& color : chunk)
+                                                                       {
+                                                                           color['R'] += 1;
+                                                                       }
+                                                                   }
+                                                                   lw::test::doNotOptimize(colors.data());
+                                                               });
+        std::snprintf(name, sizeof(name), "pixel_view/chunk_loop/%zu", pixelCount);
+        lw::test::reportBenchmark(name, pixelCount, chunkNs, frameBytes);
+
+        TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(pixelCount), view.size());
+    }
+}
+// Reference for the many-chunk bench: how views located a pixel before they kept a
+// chunk index, scanning the chunk list from the start on every access.
+lw::Rgb8Color& linearScanAt(lw::span<lw::span<lw::Rgb8Color>> chunks, uint32_t index)
+{
+    uint32_t offset = index;
+    for (auto chunk : chunks)
+    {
+        const auto chunkSize = static_cast<uint32_t>(chunk.size());
+        if (offset < chunkSize)
+        {
+            return chunk[offset];
+        }
+        offset -= chunkSize;
+    }
+
+    return chunks[0][0];
+}
+
+// A 16-strip aggregate: per-pixel access cost should not grow with the chunk count.
+void test_bench_pixel_view_many_chunks(void)
+{
+    constexpr size_t ChunkCount = 16;
+    constexpr size_t ChunkPixels = 1024;
+    constexpr size_t PixelCount = ChunkCount * ChunkPixels;
+
+    auto colors = lw::test::makeBenchColors<lw::Rgb8Color>(PixelCount);
+    std::array<lw::span<lw::Rgb8Color>, ChunkCount> chunks{};
+    for (size_t chunk = 0; chunk < ChunkCount; ++chunk)
+    {
+        chunks[chunk] = lw::span<lw::Rgb8Color>{colors.data() + (chunk * ChunkPixels), ChunkPixels};
+    }
+
+    const lw::span<lw::span<lw::Rgb8Color>> chunkList{chunks.data(), chunks.size()};
+    lw::PixelView<lw::Rgb8Color> view(chunkList);
+    const size_t iterations = lw::test::benchIterations(PixelCount);
+    const size_t frameBytes = PixelCount * sizeof(lw::Rgb8Color);
+    uint32_t checksum = 0;
+    char name[64];
+
+    const double scanNs = lw::test::measureNsPerIteration(iterations,
+                                                          [&]()
+                                                          {
+                                                              for (uint32_t index = 0; index < PixelCount; ++index)
+                                                              {
+                                                                  linearScanAt(chunkList, index)['R'] += 1;
+                                                              }
+                                                              lw::test::doNotOptimize(colors.data());
+                                                          });
+    std::snprintf(name, sizeof(name), "pixel_view_16_chunks/linear_scan/%zu", PixelCount);
+    lw::test::reportBenchmark(name, PixelCount, scanNs, frameBytes);
+
+    const double iterateNs = lw::test::measureNsPerIteration(iterations,
+                                                             [&]()
+                                                             {
+                                                                 for (auto& color : view)
+                                                                 {
+                                                                     color['R'] += 1;
+                                                                 }
+                                                                 lw::test::doNotOptimize(colors.data());
+                                                             });
+    std::snprintf(name, sizeof(name), "pixel_view_16_chunks/iterate/%zu", PixelCount);
+    lw::test::reportBenchmark(name, PixelCount, iterateNs, frameBytes);
+
+    const double indexNs = lw::test::measureNsPerIteration(iterations,
+                                                           [&]()
+                                                           {
+                                                               for (uint32_t index = 0; index < view.size(); ++index)
+                                                               {
+                                                                   checksum += view[index]['G'];
+                                                               }
+                                                               lw::test::doNotOptimize(&checksum);
+                                                           });
+    std::snprintf(name, sizeof(name), "pixel_view_16_chunks/index/%zu", PixelCount);
+    lw::test::reportBenchmark(name, PixelCount, indexNs, frameBytes);
+
+    const double fillNs = lw::test::measureNsPerIteration(iterations,
+                                                          [&]()
+                                                          {
+                                                              lw::fillPixels(view, lw::Rgb8Color{1, 2, 3});
+                                                              lw::test::doNotOptimize(colors.data());
+                                                          });
+    std::snprintf(name, sizeof(name), "pixel_view_16_chunks/fill/%zu", PixelCount);
+    lw::test::reportBenchmark(name, PixelCount, fillNs, frameBytes);
+
+    const double fillIndexedNs = lw::test::measureNsPerIteration(
+        iterations,
+        [&]()
+        {
+            lw::fillPixelsIndexed(view, [](uint32_t index)
+                                  { return lw::Rgb8Color{static_cast<uint8_t>(index), 0, 0}; });
+            lw::test::doNotOptimize(colors.data());
+        });
+    std::snprintf(name, sizeof(name), "pixel_view_16_chunks/fill_indexed/%zu", PixelCount);
+    lw::test::reportBenchmark(name, PixelCount, fillIndexedNs, frameBytes);
+
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(PixelCount), view.size());
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(PixelCount - 1), view[PixelCount - 1]['R']);
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_topology_map);
+    RUN_TEST(test_bench_pixel_view_iteration);
+    RUN_TEST(test_bench_pixel_view_many_chunks);
+    return UNITY_END();
+}
@@ -2,10 +2,15 @@
 
 #include <array>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "buses/AggregateBus.h"
+#include "buses/FrameTiming.h"
+#include "buses/PixelBus.h"
 #include "colors/Color.h"
+#include "core/ThreadPoolExecutor.h"
+#include "protocols/Ws2812xProtocol.h"
 
 namespace
 {
@@ -25,6 +30,8 @@ class StubBus : public lw::IPixelBus<TestColor>
 
     bool isReadyToUpdate() const override { return _ready; }
 
+    void setFrameTiming(lw::busses::FrameTiming* timing) override { frameTiming = timing; }
+
     lw::PixelView<TestColor>& pixels() override
     {
         ++dirtyCalls;
@@ -36,6 +43,7 @@ class StubBus : public lw::IPixelBus<TestColor>
     size_t beginCalls{0};
     size_t showCalls{0};
     size_t dirtyCalls{0};
+    lw::busses::FrameTiming* frameTiming{nullptr};
 
   private:
     std::array<lw::span<TestColor>, 1> _chunks;
@@ -43,6 +51,638 @@ class StubBus : public lw::IPixelBus<TestColor>
     bool _ready{true};
 };
 
+struct CaptureTransportSettings : lw::transports::TransportSettingsBase
+{
+};
+
+class CaptureTransport : public lw::transports::ITransport
+{
+  public:
+    using TransportSettingsType = CaptureTransportSettings;
+    static constexpr bool CompletesSynchronously = true;
+
+    explicit CaptureTransport(TransportSettingsType) {}
+
+    void begin() override {}
+
+    void transmitBytes(lw::span<uint8_t> data) override
+    {
+        transmitted.assign(data.begin(), data.end());
+        lastData = data.data();
+    }
+
+    std::vector<uint8_t> transmitted{};
+    const uint8_t* lastData{nullptr};
+};
+
+// Same as CaptureTransport but, like a DMA transport, may still read the bytes later.
+class DeferredCaptureTransport : public CaptureTransport
+{
+  public:
+    using CaptureTransport::CaptureTransport;
+    static constexpr bool CompletesSynchronously = false;
+};
+
+class IncrementRedShader : public lw::IShader<TestColor>
+{
+  public:
+    void apply(lw::span<TestColor> colors) override
+    {
+        for (auto& color : colors)
+        {
+            ++color['R'];
+        }
+    }
+};
+
+using Ws2812x = lw::protocols::Ws2812xProtocol<TestColor>;
+using ShadedSyncBus = lw::busses::PixelBus<Ws2812x, CaptureTransport, IncrementRedShader>;
+using DeferredBus = lw::busses::PixelBus<Ws2812x, DeferredCaptureTransport>;
+
+void fill_pixels(lw::PixelView<TestColor>& pixels, uint8_t seed)
+{
+    for (size_t index = 0; index < pixels.size(); ++index)
+    {
+        pixels[index] = TestColor{static_cast<uint8_t>(seed + index), 0x20, 0x40};
+    }
+}
+
+void test_aggregate_bus_members_share_scratch_and_synchronous_protocol_buffer(void)
+{
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+
+    auto small = std::make_unique<ShadedSyncBus>(4, settings, CaptureTransportSettings{}, IncrementRedShader{});
+    auto large = std::make_unique<ShadedSyncBus>(6, settings, CaptureTransportSettings{}, IncrementRedShader{});
+    auto deferred = std::make_unique<DeferredBus>(3, settings, CaptureTransportSettings{});
+    auto* smallPtr = small.get();
+    auto* largePtr = large.get();
+    auto* deferredPtr = deferred.get();
+    const uint8_t* deferredBuffer = deferredPtr->protocolBuffer().data();
+
+    std::vector<std::unique_ptr<lw::IPixelBus<TestColor>>> buses{};
+    buses.emplace_back(std::move(small));
+    buses.emplace_back(std::move(large));
+    buses.emplace_back(std::move(deferred));
+    lw::busses::AggregateBus<TestColor> aggregate(std::move(buses));
+    TEST_ASSERT_TRUE(aggregate.bufferPool() == nullptr);
+
+    aggregate.shareMemberBuffers();
+
+    const auto* pool = aggregate.bufferPool();
+    TEST_ASSERT_TRUE(pool != nullptr);
+    TEST_ASSERT_EQUAL_UINT32(6U, static_cast<uint32_t>(pool->scratchCapacity()));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(ShadedSyncBus::bufferRequirements(6, settings).protocolBytes),
+                             static_cast<uint32_t>(pool->protocolCapacity()));
+    TEST_ASSERT_TRUE(deferredPtr->protocolBuffer().data() == deferredBuffer);
+
+    ShadedSyncBus smallReference(4, settings, CaptureTransportSettings{}, IncrementRedShader{});
+    ShadedSyncBus largeReference(6, settings, CaptureTransportSettings{}, IncrementRedShader{});
+
+    for (uint8_t frame = 0; frame < 2; ++frame)
+    {
+        fill_pixels(smallPtr->pixels(), static_cast<uint8_t>(0x10 + frame));
+        fill_pixels(largePtr->pixels(), static_cast<uint8_t>(0x60 + frame));
+        fill_pixels(deferredPtr->pixels(), 0xA0);
+        fill_pixels(smallReference.pixels(), static_cast<uint8_t>(0x10 + frame));
+        fill_pixels(largeReference.pixels(), static_cast<uint8_t>(0x60 + frame));
+
+        aggregate.show();
+        smallReference.show();
+        largeReference.show();
+
+        TEST_ASSERT_TRUE(smallPtr->transport().transmitted == smallReference.transport().transmitted);
+        TEST_ASSERT_TRUE(largePtr->transport().transmitted == largeReference.transport().transmitted);
+        TEST_ASSERT_TRUE(smallPtr->transport().lastData == largePtr->transport().lastData);
+        TEST_ASSERT_TRUE(deferredPtr->transport().lastData == deferredBuffer);
+    }
+
+    // Re-encoding only a dirty range would build on bytes another member overwrote.
+    smallPtr->editPixels(1, 1)[0] = TestColor{0xEE, 0xEE, 0xEE};
+    smallReference.editPixels(1, 1)[0] = TestColor{0xEE, 0xEE, 0xEE};
+    aggregate.show();
+    smallReference.show();
+    TEST_ASSERT_TRUE(smallPtr->transport().transmitted == smallReference.transport().transmitted);
+
+    // Double buffering keeps the frame on the wire, so the bus takes its own buffer back.
+    smallPtr->setDoubleBuffered(true);
+    fill_pixels(smallPtr->pixels(), 0x30);
+    aggregate.show();
+    TEST_ASSERT_TRUE(smallPtr->transport().lastData != largePtr->transport().lastData);
+}
+
+uint32_t simulatedNowUs = 0;
+std::vector<std::string> frameEvents{};
+
+uint32_t simulatedClock()
+{
+    return simulatedNowUs;
+}
+
+struct SimulatedTransportSettings : lw::transports::TransportSettingsBase
+{
+    char name{'?'};
+    uint32_t callLatencyUs{0};
+    uint32_t wireTimeUs{0};
+};
+
+// transmitBytes() blocks for `callLatencyUs` of simulated time, then the transport
+// stays busy for `wireTimeUs`.
+class SimulatedTransport : public lw::transports::ITransport
+{
+  public:
+    using TransportSettingsType = SimulatedTransportSettings;
+
+    explicit SimulatedTransport(TransportSettingsType settings) : _settings{settings} {}
+
+    void begin() override {}
+
+    void transmitBytes(lw::span<uint8_t>) override
+    {
+        frameEvents.push_back(std::string("send ") + _settings.name);
+        startedAtUs = simulatedNowUs;
+        simulatedNowUs += _settings.callLatencyUs;
+        _busyUntilUs = simulatedNowUs + _settings.wireTimeUs;
+        ++transmitCount;
+    }
+
+    bool isReadyToUpdate() const override { return simulatedNowUs >= _busyUntilUs; }
+
+    uint32_t startedAtUs{0};
+    size_t transmitCount{0};
+
+  private:
+    TransportSettingsType _settings;
+    uint32_t _busyUntilUs{0};
+};
+
+// SimulatedTransport with an end-of-transfer interrupt, raised by finishTransfer().
+class SignallingTransport : public SimulatedTransport
+{
+  public:
+    static constexpr bool SignalsTransferComplete = true;
+
+    using SimulatedTransport::SimulatedTransport;
+
+    void setTransferCompleteCallback(TransferCompleteCallback callback, void* context) override
+    {
+        _callback = callback;
+        _context = context;
+    }
+
+    void finishTransfer()
+    {
+        if (isReadyToUpdate())
+        {
+            deliverSignal();
+        }
+    }
+
+    // Raises the signal whatever the wire is doing, as a deferred interrupt delivery
+    // that lands after the next frame started would.
+    void deliverSignal()
+    {
+        if (_callback != nullptr)
+        {
+            _callback(_context);
+        }
+    }
+
+  private:
+    TransferCompleteCallback _callback{nullptr};
+    void* _context{nullptr};
+};
+
+class EncodeLoggingShader : public lw::IShader<TestColor>
+{
+  public:
+    explicit EncodeLoggingShader(char name = '?') : _name{name} {}
+
+    void apply(lw::span<TestColor>) override { frameEvents.push_back(std::string("encode ") + _name); }
+
+  private:
+    char _name;
+};
+
+using SimulatedBus = lw::busses::PixelBus<Ws2812x, SimulatedTransport, EncodeLoggingShader>;
+
+std::unique_ptr<SimulatedBus> make_simulated_bus(char name, uint32_t callLatencyUs, uint32_t wireTimeUs)
+{
+    SimulatedTransportSettings transportSettings{};
+    transportSettings.name = name;
+    transportSettings.callLatencyUs = callLatencyUs;
+    transportSettings.wireTimeUs = wireTimeUs;
+    return std::make_unique<SimulatedBus>(2, lw::protocols::Ws2812xProtocolSettings{{}, lw::ChannelOrder::GRB::value},
+                                          transportSettings, EncodeLoggingShader{name});
+}
+
+void test_aggregate_bus_frame_barrier_encodes_all_then_sends_back_to_back(void)
+{
+    simulatedNowUs = 1000;
+    frameEvents.clear();
+
+    auto fast = make_simulated_bus('a', 5, 50);
+    auto blocking = make_simulated_bus('b', 40, 0);
+    auto slow = make_simulated_bus('c', 2, 300);
+    std::array<SimulatedBus*, 3> members{fast.get(), blocking.get(), slow.get()};
+
+    std::vector<std::unique_ptr<lw::IPixelBus<TestColor>>> buses{};
+    buses.emplace_back(std::move(fast));
+    buses.emplace_back(std::move(blocking));
+    buses.emplace_back(std::move(slow));
+    lw::busses::AggregateBus<TestColor> aggregate(std::move(buses));
+    aggregate.setFrameBarrier(true);
+    aggregate.frameBarrier().setClock(simulatedClock);
+
+    aggregate.show();
+
+    const std::vector<std::string> expected{"encode a", "encode b", "encode c", "send a", "send b", "send c"};
+    TEST_ASSERT_TRUE(frameEvents == expected);
+
+    const auto stats = aggregate.frameBarrier().memberStats();
+    TEST_ASSERT_EQUAL_UINT32(0U, stats[0].skewUs);
+    TEST_ASSERT_EQUAL_UINT32(5U, stats[1].skewUs);
+    TEST_ASSERT_EQUAL_UINT32(45U, stats[2].skewUs);
+    TEST_ASSERT_EQUAL_UINT32(45U, stats[2].maxSkewUs);
+    TEST_ASSERT_EQUAL_UINT32(1U, aggregate.frameBarrier().shownFrames());
+
+    // The slow member is still on the wire: nobody shows, rather than two strips
+    // moving ahead of it.
+    simulatedNowUs += 100;
+    for (auto* member : members)
+    {
+        member->pixels()[0] = TestColor{1, 2, 3};
+    }
+
+    aggregate.show();
+
+    for (auto* member : members)
+    {
+        TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(member->transport().transmitCount));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0U, stats[0].skippedFrames);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats[1].skippedFrames);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats[2].skippedFrames);
+    TEST_ASSERT_EQUAL_UINT32(1U, aggregate.frameBarrier().refusedFrames());
+
+    simulatedNowUs += 300;
+    aggregate.show();
+
+    for (auto* member : members)
+    {
+        TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(member->transport().transmitCount));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(members[0]->transport().startedAtUs + 45U, members[2]->transport().startedAtUs);
+    TEST_ASSERT_EQUAL_UINT32(2U, aggregate.frameBarrier().shownFrames());
+}
+
+// SimulatedTransport whose transmitBytes() returns only once the frame is sent, so
+// members may pool their protocol buffer.
+class SynchronousSimulatedTransport : public SimulatedTransport
+{
+  public:
+    static constexpr bool CompletesSynchronously = true;
+
+    using SimulatedTransport::SimulatedTransport;
+};
+
+// Charges `costUs` of simulated time per shaded frame.
+class ShadeCostShader : public lw::IShader<TestColor>
+{
+  public:
+    explicit ShadeCostShader(uint32_t costUs = 0) : _costUs{costUs} {}
+
+    void apply(lw::span<TestColor>) override { simulatedNowUs += _costUs; }
+
+  private:
+    uint32_t _costUs;
+};
+
+uint32_t barrier_skew_with_shared_buffers(uint32_t encodeCostUs)
+{
+    using PooledBus = lw::busses::PixelBus<Ws2812x, SynchronousSimulatedTransport, ShadeCostShader>;
+
+    simulatedNowUs = 0;
+    frameEvents.clear();
+
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+    std::vector<std::unique_ptr<lw::IPixelBus<TestColor>>> buses{};
+    for (const char name : {'a', 'b', 'c'})
+    {
+        SimulatedTransportSettings transportSettings{};
+        transportSettings.name = name;
+        transportSettings.callLatencyUs = 5;
+        buses.emplace_back(std::make_unique<PooledBus>(2, settings, transportSettings, ShadeCostShader{encodeCostUs}));
+    }
+
+    lw::busses::AggregateBus<TestColor> aggregate(std::move(buses));
+    aggregate.shareMemberBuffers();
+    aggregate.setFrameBarrier(true);
+    aggregate.frameBarrier().setClock(simulatedClock);
+    aggregate.show();
+
+    return aggregate.frameBarrier().memberStats()[2].maxSkewUs;
+}
+
+void test_aggregate_bus_frame_barrier_skew_ignores_encode_cost_with_shared_buffers(void)
+{
+    // Back-to-back starts cost only the call latency of the members before.
+    TEST_ASSERT_EQUAL_UINT32(10U, barrier_skew_with_shared_buffers(0));
+    TEST_ASSERT_EQUAL_UINT32(10U, barrier_skew_with_shared_buffers(400));
+}
+
+void test_aggregate_bus_without_barrier_lets_busy_members_fall_behind(void)
+{
+    simulatedNowUs = 1000;
+    frameEvents.clear();
+
+    auto fast = make_simulated_bus('a', 5, 50);
+    auto slow = make_simulated_bus('c', 2, 300);
+    auto* fastPtr = fast.get();
+    auto* slowPtr = slow.get();
+
+    std::vector<std::unique_ptr<lw::IPixelBus<TestColor>>> buses{};
+    buses.emplace_back(std::move(fast));
+    buses.emplace_back(std::move(slow));
+    lw::busses::AggregateBus<TestColor> aggregate(std::move(buses));
+
+    aggregate.show();
+    const std::vector<std::string> expected{"encode a", "send a", "encode c", "send c"};
+    TEST_ASSERT_TRUE(frameEvents == expected);
+
+    simulatedNowUs += 100;
+    fastPtr->pixels()[0] = TestColor{1, 2, 3};
+    slowPtr->pixels()[0] = TestColor{1, 2, 3};
+    aggregate.show();
+
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(fastPtr->transport().transmitCount));
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(slowPtr->transport().transmitCount));
+}
+
+void count_completion(void* context)
+{
+    ++*static_cast<size_t*>(context);
+}
+
+void test_pixel_bus_show_async_completes_when_polled_after_transfer(void)
+{
+    simulatedNowUs = 1000;
+    auto bus = make_simulated_bus('a', 5, 100);
+    size_t completions = 0;
+    const lw::ShowCompletion completion{count_completion, &completions};
+
+    TEST_ASSERT_TRUE(bus->showAsync(completion) == lw::ShowStatus::Queued);
+    TEST_ASSERT_EQUAL_size_t(0U, completions);
+    TEST_ASSERT_FALSE(bus->pollCompletion());
+
+    bus->pixels()[0] = TestColor{1, 2, 3};
+    TEST_ASSERT_TRUE(bus->showAsync(completion) == lw::ShowStatus::BusyDropped);
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(bus->transport().transmitCount));
+
+    simulatedNowUs += 100;
+    TEST_ASSERT_TRUE(bus->pollCompletion());
+    TEST_ASSERT_FALSE(bus->pollCompletion());
+    TEST_ASSERT_EQUAL_size_t(1U, completions);
+
+    // The dropped frame is still dirty, so it goes out on the next call.
+    TEST_ASSERT_TRUE(bus->showAsync(completion) == lw::ShowStatus::Queued);
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(bus->transport().transmitCount));
+
+    simulatedNowUs += 100;
+    TEST_ASSERT_TRUE(bus->showAsync(completion) == lw::ShowStatus::SkippedClean);
+    TEST_ASSERT_EQUAL_size_t(2U, completions);
+
+    auto instant = make_simulated_bus('b', 5, 0);
+    TEST_ASSERT_TRUE(instant->showAsync(completion) == lw::ShowStatus::Queued);
+    TEST_ASSERT_EQUAL_size_t(3U, completions);
+}
+
+using SignallingBus = lw::busses::PixelBus<Ws2812x, SignallingTransport, EncodeLoggingShader>;
+
+std::unique_ptr<SignallingBus> make_signalling_bus(char name, uint32_t wireTimeUs)
+{
+    SimulatedTransportSettings transportSettings{};
+    transportSettings.name = name;
+    transportSettings.wireTimeUs = wireTimeUs;
+    return std::make_unique<SignallingBus>(2, lw::protocols::Ws2812xProtocolSettings{{}, lw::ChannelOrder::GRB::value},
+                                           transportSettings, EncodeLoggingShader{name});
+}
+
+void test_pixel_bus_show_async_completes_from_transport_signal(void)
+{
+    static_assert(lw::transports::TransportSignalsTransferComplete<SignallingTransport>);
+    static_assert(!lw::transports::TransportSignalsTransferComplete<SimulatedTransport>);
+
+    simulatedNowUs = 1000;
+    auto bus = make_signalling_bus('a', 100);
+    size_t completions = 0;
+
+    TEST_ASSERT_TRUE(bus->showAsync(lw::ShowCompletion{count_completion, &completions}) == lw::ShowStatus::Queued);
+    simulatedNowUs += 100;
+    bus->transport().finishTransfer();
+    TEST_ASSERT_EQUAL_size_t(1U, completions);
+
+    // The signal and a later poll racing for the same completion deliver it once.
+    TEST_ASSERT_FALSE(bus->pollCompletion());
+    TEST_ASSERT_EQUAL_size_t(1U, completions);
+}
+
+void test_pixel_bus_show_async_ignores_signal_arriving_after_next_frame(void)
+{
+    simulatedNowUs = 1000;
+    auto bus = make_signalling_bus('a', 100);
+    size_t first = 0;
+    size_t second = 0;
+
+    TEST_ASSERT_TRUE(bus->showAsync(lw::ShowCompletion{count_completion, &first}) == lw::ShowStatus::Queued);
+
+    // The wire finished but the signal is still queued; the next show polls the first
+    // completion out and starts the second frame.
+    simulatedNowUs += 100;
+    bus->pixels()[0] = TestColor{1, 2, 3};
+    TEST_ASSERT_TRUE(bus->showAsync(lw::ShowCompletion{count_completion, &second}) == lw::ShowStatus::Queued);
+    TEST_ASSERT_EQUAL_size_t(1U, first);
+
+    // The first frame's late signal must not complete the frame now on the wire.
+    simulatedNowUs += 10;
+    bus->transport().deliverSignal();
+    TEST_ASSERT_EQUAL_size_t(0U, second);
+
+    simulatedNowUs += 90;
+    bus->transport().finishTransfer();
+    TEST_ASSERT_EQUAL_size_t(1U, first);
+    TEST_ASSERT_EQUAL_size_t(1U, second);
+}
+
+void test_aggregate_bus_show_async_completes_after_last_member(void)
+{
+    simulatedNowUs = 1000;
+    auto fast = make_signalling_bus('a', 50);
+    auto slow = make_signalling_bus('c', 300);
+    auto* fastPtr = fast.get();
+    auto* slowPtr = slow.get();
+
+    std::vector<std::unique_ptr<lw::IPixelBus<TestColor>>> buses{};
+    buses.emplace_back(std::move(fast));
+    buses.emplace_back(std::move(slow));
+    lw::busses::AggregateBus<TestColor> aggregate(std::move(buses));
+
+    size_t completions = 0;
+    const lw::ShowCompletion completion{count_completion, &completions};
+    TEST_ASSERT_TRUE(aggregate.showAsync(completion) == lw::ShowStatus::Queued);
+
+    simulatedNowUs += 50;
+    fastPtr->transport().finishTransfer();
+    TEST_ASSERT_EQUAL_size_t(0U, completions);
+
+    // The group frame is still on the wire.
+    fastPtr->pixels()[0] = TestColor{1, 2, 3};
+    TEST_ASSERT_TRUE(aggregate.showAsync(completion) == lw::ShowStatus::BusyDropped);
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(fastPtr->transport().transmitCount));
+
+    simulatedNowUs += 250;
+    slowPtr->transport().finishTransfer();
+    TEST_ASSERT_EQUAL_size_t(1U, completions);
+
+    TEST_ASSERT_TRUE(aggregate.showAsync(completion) == lw::ShowStatus::Queued);
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(fastPtr->transport().transmitCount));
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(slowPtr->transport().transmitCount));
+
+    simulatedNowUs += 50;
+    TEST_ASSERT_TRUE(aggregate.pollCompletion());
+    TEST_ASSERT_EQUAL_size_t(2U, completions);
+    TEST_ASSERT_TRUE(aggregate.showAsync(completion) == lw::ShowStatus::SkippedClean);
+}
+
+void test_aggregate_bus_show_async_through_frame_barrier_reports_members(void)
+{
+    simulatedNowUs = 1000;
+    auto fast = make_signalling_bus('a', 50);
+    auto slow = make_signalling_bus('c', 300);
+    auto* fastPtr = fast.get();
+    auto* slowPtr = slow.get();
+
+    std::vector<std::unique_ptr<lw::IPixelBus<TestColor>>> buses{};
+    buses.emplace_back(std::move(fast));
+    buses.emplace_back(std::move(slow));
+    lw::busses::AggregateBus<TestColor> aggregate(std::move(buses));
+    aggregate.setFrameBarrier(true);
+    aggregate.frameBarrier().setClock(simulatedClock);
+
+    size_t completions = 0;
+    const lw::ShowCompletion completion{count_completion, &completions};
+    TEST_ASSERT_TRUE(aggregate.showAsync(completion) == lw::ShowStatus::Queued);
+    TEST_ASSERT_EQUAL_size_t(0U, completions);
+
+    simulatedNowUs += 50;
+    fastPtr->transport().finishTransfer();
+    TEST_ASSERT_EQUAL_size_t(0U, completions);
+
+    // The barrier refuses while the slow member is on the wire.
+    fastPtr->pixels()[0] = TestColor{1, 2, 3};
+    TEST_ASSERT_TRUE(aggregate.showAsync(completion) == lw::ShowStatus::BusyDropped);
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(fastPtr->transport().transmitCount));
+
+    simulatedNowUs += 250;
+    slowPtr->transport().finishTransfer();
+    TEST_ASSERT_EQUAL_size_t(1U, completions);
+
+    TEST_ASSERT_TRUE(aggregate.showAsync(completion) == lw::ShowStatus::Queued);
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(fastPtr->transport().transmitCount));
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(slowPtr->transport().transmitCount));
+    TEST_ASSERT_EQUAL_size_t(1U, completions);
+
+    simulatedNowUs += 50;
+    fastPtr->transport().finishTransfer();
+    TEST_ASSERT_EQUAL_size_t(2U, completions);
+    TEST_ASSERT_TRUE(aggregate.showAsync(completion) == lw::ShowStatus::SkippedClean);
+    TEST_ASSERT_EQUAL_UINT32(3U, aggregate.frameBarrier().shownFrames());
+}
+
+void test_aggregate_bus_show_async_on_executor_completes_after_last_member(void)
+{
+    simulatedNowUs = 1000;
+    auto fast = make_signalling_bus('a', 50);
+    auto slow = make_signalling_bus('c', 300);
+    auto* fastPtr = fast.get();
+    auto* slowPtr = slow.get();
+
+    std::vector<std::unique_ptr<lw::IPixelBus<TestColor>>> buses{};
+    buses.emplace_back(std::move(fast));
+    buses.emplace_back(std::move(slow));
+    lw::busses::AggregateBus<TestColor> aggregate(std::move(buses));
+    lw::ThreadPoolExecutor executor(2);
+    aggregate.setExecutor(&executor);
+
+    size_t completions = 0;
+    const lw::ShowCompletion completion{count_completion, &completions};
+    TEST_ASSERT_TRUE(aggregate.showAsync(completion) == lw::ShowStatus::Queued);
+    TEST_ASSERT_EQUAL_size_t(0U, completions);
+
+    simulatedNowUs += 50;
+    fastPtr->transport().finishTransfer();
+    TEST_ASSERT_EQUAL_size_t(0U, completions);
+
+    simulatedNowUs += 250;
+    slowPtr->transport().finishTransfer();
+    TEST_ASSERT_EQUAL_size_t(1U, completions);
+    TEST_ASSERT_TRUE(aggregate.showAsync(completion) == lw::ShowStatus::SkippedClean);
+}
+
+void test_aggregate_bus_encodes_members_on_executor_and_sends_in_order(void)
+{
+    using ParallelBus = lw::busses::PixelBus<Ws2812x, SimulatedTransport, IncrementRedShader>;
+    constexpr size_t MemberCount = 8;
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+
+    simulatedNowUs = 0;
+    frameEvents.clear();
+
+    std::vector<std::unique_ptr<lw::IPixelBus<TestColor>>> buses{};
+    std::vector<ParallelBus*> members{};
+    std::vector<std::unique_ptr<ParallelBus>> references{};
+    std::vector<std::string> expectedSends{};
+    for (size_t member = 0; member < MemberCount; ++member)
+    {
+        SimulatedTransportSettings transportSettings{};
+        transportSettings.name = static_cast<char>('a' + member);
+        auto bus = std::make_unique<ParallelBus>(16 + member, settings, transportSettings, IncrementRedShader{});
+        fill_pixels(bus->pixels(), static_cast<uint8_t>(member * 16));
+        members.push_back(bus.get());
+        buses.emplace_back(std::move(bus));
+
+        references.push_back(
+            std::make_unique<ParallelBus>(16 + member, settings, SimulatedTransportSettings{}, IncrementRedShader{}));
+        fill_pixels(references.back()->pixels(), static_cast<uint8_t>(member * 16));
+        expectedSends.push_back(std::string("send ") + static_cast<char>('a' + member));
+    }
+
+    lw::ThreadPoolExecutor executor(4);
+    lw::busses::AggregateBus<TestColor> aggregate(std::move(buses));
+    lw::busses::FrameTiming timing;
+    aggregate.setExecutor(&executor);
+    aggregate.setFrameTiming(&timing);
+    aggregate.show();
+
+    TEST_ASSERT_TRUE(frameEvents == expectedSends);
+
+    // Members shading and encoding on different workers share the one FrameTiming.
+    const lw::busses::FrameTimingStats stats = timing.stats();
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(MemberCount), stats.shownFrames);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(MemberCount), stats.shade.samples);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(MemberCount), stats.serialize.samples);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(MemberCount), stats.transmit.samples);
+    for (size_t member = 0; member < MemberCount; ++member)
+    {
+        references[member]->show();
+        const auto actual = members[member]->protocolBuffer();
+        const auto expected = references[member]->protocolBuffer();
+        TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.size()), static_cast<uint32_t>(actual.size()));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), actual.data(), expected.size());
+    }
+}
+
 void test_aggregate_bus_pixels_concatenate_child_views(void)
 {
     std::array<TestColor, 2> left{};
@@ -89,15 +729,23 @@ void test_aggregate_bus_forwards_lifecycle_and_ready_state(void)
     buses.emplace_back(std::move(secondBus));
 
     lw::busses::AggregateBus<TestColor> aggregate(std::move(buses));
+    lw::busses::FrameTiming timing;
 
     aggregate.begin();
+    aggregate.setFrameTiming(&timing);
     aggregate.show();
 
     TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(firstBusPtr->beginCalls));
     TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(secondBusPtr->beginCalls));
     TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(firstBusPtr->showCalls));
     TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(secondBusPtr->showCalls));
+    TEST_ASSERT_TRUE(firstBusPtr->frameTiming == &timing);
+    TEST_ASSERT_TRUE(secondBusPtr->frameTiming == &timing);
     TEST_ASSERT_FALSE(aggregate.isReadyToUpdate());
+
+    aggregate.setFrameTiming(nullptr);
+    TEST_ASSERT_TRUE(firstBusPtr->frameTiming == nullptr);
+    TEST_ASSERT_TRUE(secondBusPtr->frameTiming == nullptr);
 }
 
 void test_reference_aggregate_bus_pixels_concatenate_child_views(void)
@@ -138,9 +786,13 @@ void test_reference_aggregate_bus_forwards_lifecycle_and_ready_state(void)
     std::array<lw::IPixelBus<TestColor>*, 2> buses{&firstBus, &secondBus};
     lw::busses::ReferenceAggregateBus<TestColor> aggregate(
         lw::span<lw::IPixelBus<TestColor>*>{buses.data(), buses.size()});
+    lw::busses::FrameTiming timing;
 
     aggregate.begin();
+    aggregate.setFrameTiming(&timing);
     aggregate.show();
+    TEST_ASSERT_TRUE(firstBus.frameTiming == &timing);
+    TEST_ASSERT_TRUE(secondBus.frameTiming == &timing);
 
     TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(firstBus.beginCalls));
     TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(secondBus.beginCalls));
@@ -168,5 +820,16 @@ int main(int argc, char** argv)
     RUN_TEST(test_aggregate_bus_forwards_lifecycle_and_ready_state);
     RUN_TEST(test_reference_aggregate_bus_pixels_concatenate_child_views);
     RUN_TEST(test_reference_aggregate_bus_forwards_lifecycle_and_ready_state);
+    RUN_TEST(test_aggregate_bus_members_share_scratch_and_synchronous_protocol_buffer);
+    RUN_TEST(test_aggregate_bus_frame_barrier_encodes_all_then_sends_back_to_back);
+    RUN_TEST(test_aggregate_bus_frame_barrier_skew_ignores_encode_cost_with_shared_buffers);
+    RUN_TEST(test_aggregate_bus_without_barrier_lets_busy_members_fall_behind);
+    RUN_TEST(test_aggregate_bus_encodes_members_on_executor_and_sends_in_order);
+    RUN_TEST(test_pixel_bus_show_async_completes_when_polled_after_transfer);
+    RUN_TEST(test_pixel_bus_show_async_completes_from_transport_signal);
+    RUN_TEST(test_pixel_bus_show_async_ignores_signal_arriving_after_next_frame);
+    RUN_TEST(test_aggregate_bus_show_async_completes_after_last_member);
+    RUN_TEST(test_aggregate_bus_show_async_through_frame_barrier_reports_members);
+    RUN_TEST(test_aggregate_bus_show_async_on_executor_completes_after_last_member);
     return UNITY_END();
 }
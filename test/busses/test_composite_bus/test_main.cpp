@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "buses/CompositeBus.h"
+#include "buses/FrameTiming.h"
 #include "colors/Color.h"
 
 namespace
@@ -27,6 +28,8 @@ class StubBus : public lw::IPixelBus<TestColor>
 
     bool isReadyToUpdate() const override { return _ready; }
 
+    void setFrameTiming(lw::busses::FrameTiming* timing) override { frameTiming = timing; }
+
     lw::PixelView<TestColor>& pixels() override
     {
         ++dirtyCalls;
@@ -38,6 +41,7 @@ class StubBus : public lw::IPixelBus<TestColor>
     size_t beginCalls{0};
     size_t showCalls{0};
     size_t dirtyCalls{0};
+    lw::busses::FrameTiming* frameTiming{nullptr};
 
   private:
     std::vector<TestColor> _pixelsStorage;
@@ -75,17 +79,54 @@ void test_composite_bus_forwards_lifecycle_and_ready_state(void)
     StubBus secondBus(1, false);
 
     lw::busses::CompositeBus<StubBus, StubBus> composite(std::move(firstBus), std::move(secondBus));
+    lw::busses::FrameTiming timing;
 
     composite.begin();
+    composite.setFrameTiming(&timing);
     composite.show();
 
     auto& buses = composite.buses();
+    TEST_ASSERT_TRUE(std::get<0>(buses).frameTiming == &timing);
+    TEST_ASSERT_TRUE(std::get<1>(buses).frameTiming == &timing);
     TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(std::get<0>(buses).beginCalls));
     TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(std::get<1>(buses).beginCalls));
     TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(std::get<0>(buses).showCalls));
     TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(std::get<1>(buses).showCalls));
     TEST_ASSERT_FALSE(composite.isReadyToUpdate());
 }
+
+void test_composite_bus_frame_barrier_refuses_partial_frames(void)
+{
+    lw::busses::CompositeBus<StubBus, StubBus> busyComposite(StubBus(1, true), StubBus(1, false));
+    busyComposite.setFrameBarrier(true);
+
+    busyComposite.show();
+
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(std::get<0>(busyComposite.buses()).showCalls));
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(std::get<1>(busyComposite.buses()).showCalls));
+    TEST_ASSERT_EQUAL_UINT32(0U, busyComposite.frameBarrier().memberStats()[0].skippedFrames);
+    TEST_ASSERT_EQUAL_UINT32(1U, busyComposite.frameBarrier().memberStats()[1].skippedFrames);
+    TEST_ASSERT_EQUAL_UINT32(1U, busyComposite.frameBarrier().refusedFrames());
+    TEST_ASSERT_TRUE(busyComposite.showAsync() == lw::ShowStatus::BusyDropped);
+    TEST_ASSERT_EQUAL_UINT32(2U, busyComposite.frameBarrier().refusedFrames());
+
+    lw::busses::CompositeBus<StubBus, StubBus> readyComposite(StubBus(1), StubBus(2));
+    readyComposite.setFrameBarrier(true);
+
+    readyComposite.show();
+
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(std::get<0>(readyComposite.buses()).showCalls));
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(std::get<1>(readyComposite.buses()).showCalls));
+    TEST_ASSERT_EQUAL_UINT32(1U, readyComposite.frameBarrier().shownFrames());
+
+    // Members that cannot tell when a transfer ends complete as they commit.
+    size_t completions = 0;
+    const lw::ShowCompletion completion{[](void* context) { ++*static_cast<size_t*>(context); }, &completions};
+    TEST_ASSERT_TRUE(readyComposite.showAsync(completion) == lw::ShowStatus::Queued);
+    TEST_ASSERT_EQUAL_size_t(1U, completions);
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(std::get<1>(readyComposite.buses()).showCalls));
+    TEST_ASSERT_EQUAL_UINT32(2U, readyComposite.frameBarrier().shownFrames());
+}
 } // namespace
 
 void setUp(void)
@@ -104,5 +145,6 @@ int main(int argc, char** argv)
     UNITY_BEGIN();
     RUN_TEST(test_composite_bus_pixels_concatenate_child_views);
     RUN_TEST(test_composite_bus_forwards_lifecycle_and_ready_state);
+    RUN_TEST(test_composite_bus_frame_barrier_refuses_partial_frames);
     return UNITY_END();
 }
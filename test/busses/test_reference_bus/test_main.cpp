@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 
+#include "buses/FrameTiming.h"
 #include "buses/ReferenceBus.h"
 #include "colors/Color.h"
 #include "colors/IShader.h"
@@ -41,6 +42,10 @@ class CaptureProtocol : public lw::protocols::IProtocol<TestColor>
 
     size_t requiredBufferSizeBytes() const override { return 4U; }
 
+    using SettingsType = lw::protocols::ProtocolSettings;
+
+    static constexpr size_t requiredBufferSize(lw::PixelCount, const SettingsType&) { return 4U; }
+
     static int destructorCount;
     bool began{false};
     const TestColor* lastSource{nullptr};
@@ -66,8 +71,11 @@ class CaptureTransport : public lw::transports::ITransport
 
     void endTransaction() override { ++endTransactionCount; }
 
+    bool isReadyToUpdate() const override { return ready; }
+
     static int destructorCount;
     bool began{false};
+    bool ready{true};
     size_t beginTransactionCount{0};
     size_t endTransactionCount{0};
     std::vector<uint8_t> transmitted{};
@@ -213,6 +221,41 @@ void test_reference_bus_uses_root_buffer_when_shader_is_absent(void)
     TEST_ASSERT_EQUAL_UINT8(20, bus.rootBuffer()[1]['R']);
 }
 
+uint32_t tickCount = 0;
+
+// Every reading advances one tick, so each timed stage measures exactly one.
+uint32_t tickingClock()
+{
+    return tickCount++;
+}
+
+void test_reference_bus_records_frame_timing(void)
+{
+    resetDestructorCounters();
+
+    auto transport = std::make_unique<CaptureTransport>();
+    auto* transportPtr = transport.get();
+    lw::busses::ReferenceBus<TestColor> bus(2, std::make_unique<CaptureProtocol>(2), std::move(transport),
+                                            std::make_unique<IncrementRedShader>());
+    lw::busses::FrameTiming timing{tickingClock};
+    bus.setFrameTiming(&timing);
+
+    bus.show();
+    bus.show();
+    transportPtr->ready = false;
+    bus.pixels()[0] = TestColor{1, 2, 3};
+    bus.show();
+
+    const lw::busses::FrameTimingStats stats = timing.stats();
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.shownFrames);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.cleanSkippedShows);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.busySkippedShows);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.shade.samples);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.shade.max);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.serialize.samples);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.transmit.samples);
+}
+
 void test_reference_bus_owns_all_resources(void)
 {
     resetDestructorCounters();
@@ -230,6 +273,60 @@ void test_reference_bus_owns_all_resources(void)
     TEST_ASSERT_EQUAL_INT(1, NoopShaderOwnedColor::destructorCount);
     TEST_ASSERT_EQUAL_INT(2, OwnedColor::destructorCount);
 }
+
+void test_reference_bus_runs_on_supplied_buffers(void)
+{
+    resetDestructorCounters();
+
+    const auto requirements =
+        lw::busses::ReferenceBus<TestColor>::bufferRequirements<CaptureProtocol>(2, CaptureProtocol::SettingsType{},
+                                                                                 true);
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(requirements.shaderScratch));
+
+    std::vector<uint8_t> arenaStorage(requirements.arenaBytes<TestColor>());
+    lw::busses::BufferArena arena{lw::span<uint8_t>{arenaStorage.data(), arenaStorage.size()}};
+    const auto buffers = arena.takeBusBuffers<TestColor>(requirements);
+    TEST_ASSERT_TRUE(buffers.satisfies(requirements));
+
+    auto protocol = std::make_unique<CaptureProtocol>(2);
+    auto transport = std::make_unique<CaptureTransport>();
+    auto* protocolPtr = protocol.get();
+    auto* transportPtr = transport.get();
+
+    lw::busses::ReferenceBus<TestColor> bus(2, std::move(protocol), std::move(transport), buffers,
+                                            std::make_unique<IncrementRedShader>());
+    TEST_ASSERT_TRUE(bus.hasValidBuffers());
+    TEST_ASSERT_TRUE(bus.rootBuffer() == buffers.rootPixels.data());
+    TEST_ASSERT_TRUE(bus.shaderBuffer() == buffers.shaderScratch.data());
+    TEST_ASSERT_TRUE(bus.protocolBuffer() == buffers.protocolBuffer.data());
+
+    bus.pixels()[0] = TestColor{1, 2, 3};
+    bus.pixels()[1] = TestColor{4, 5, 6};
+    bus.show();
+
+    TEST_ASSERT_TRUE(protocolPtr->lastSource == buffers.shaderScratch.data());
+    TEST_ASSERT_EQUAL_UINT8(2, buffers.shaderScratch[0]['R']);
+    TEST_ASSERT_EQUAL_UINT8(0x5A, buffers.protocolBuffer[3]);
+    TEST_ASSERT_EQUAL_UINT32(4U, static_cast<uint32_t>(transportPtr->transmitted.size()));
+}
+
+void test_reference_bus_rejects_undersized_supplied_buffers(void)
+{
+    std::array<TestColor, 2> pixels{};
+    std::array<uint8_t, 3> protocolBytes{};
+    lw::busses::BusBuffers<TestColor> buffers{};
+    buffers.rootPixels = lw::span<TestColor>{pixels.data(), pixels.size()};
+    buffers.protocolBuffer = lw::span<uint8_t>{protocolBytes.data(), protocolBytes.size()};
+
+    auto transport = std::make_unique<CaptureTransport>();
+    auto* transportPtr = transport.get();
+    lw::busses::ReferenceBus<TestColor> bus(2, std::make_unique<CaptureProtocol>(2), std::move(transport), buffers);
+
+    TEST_ASSERT_FALSE(bus.hasValidBuffers());
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(bus.pixels().size()));
+    bus.show();
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(transportPtr->beginTransactionCount));
+}
 } // namespace
 
 void setUp(void)
@@ -249,5 +346,8 @@ int main(int argc, char** argv)
     RUN_TEST(test_reference_bus_uses_shader_scratch_when_provided);
     RUN_TEST(test_reference_bus_uses_root_buffer_when_shader_is_absent);
     RUN_TEST(test_reference_bus_owns_all_resources);
+    RUN_TEST(test_reference_bus_records_frame_timing);
+    RUN_TEST(test_reference_bus_runs_on_supplied_buffers);
+    RUN_TEST(test_reference_bus_rejects_undersized_supplied_buffers);
     return UNITY_END();
 }
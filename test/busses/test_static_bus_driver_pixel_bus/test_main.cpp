@@ -1,13 +1,21 @@
 #include <unity.h>
 
 #include <algorithm>
+#include <cstdio>
+#include <thread>
 #include <vector>
 
+#include "buses/FrameTiming.h"
 #include "buses/PixelBus.h"
 #include "colors/Color.h"
+#include "colors/CurrentLimiterShader.h"
+#include "colors/GammaShader.h"
 #include "colors/IShader.h"
+#include "protocols/DotStarProtocol.h"
 #include "protocols/IProtocol.h"
+#include "protocols/Ws2812xProtocol.h"
 #include "transports/ITransport.h"
+#include "transports/NilTransport.h"
 
 namespace
 {
@@ -65,6 +73,28 @@ class MockProtocol : public lw::protocols::IProtocol<TestColor>
     size_t _required{0};
 };
 
+class MockPartialProtocol : public MockProtocol
+{
+  public:
+    static constexpr bool SupportsPartialUpdate = true;
+
+    using MockProtocol::MockProtocol;
+
+    void update(lw::span<const TestColor> colors, lw::span<uint8_t> buffer = lw::span<uint8_t>{}) override
+    {
+        ++fullUpdateCount;
+        MockProtocol::update(colors, buffer);
+    }
+
+    void updateRange(lw::span<const TestColor>, lw::span<uint8_t>, size_t firstPixel, size_t endPixel)
+    {
+        ranges.push_back(lw::PixelRange{firstPixel, endPixel});
+    }
+
+    size_t fullUpdateCount{0};
+    std::vector<lw::PixelRange> ranges{};
+};
+
 struct MockTransportSettings
 {
     bool invert{false};
@@ -74,6 +104,7 @@ class MockTransport : public lw::transports::ITransport
 {
   public:
     using TransportSettingsType = MockTransportSettings;
+    static constexpr bool PreservesBuffer = true;
 
     explicit MockTransport(TransportSettingsType settings) : _settings(settings) {}
 
@@ -108,6 +139,71 @@ class IncrementRedShader : public lw::IShader<TestColor>
     }
 };
 
+// Host stand-in for a DMA transport: a frame occupies the wire for `wireTime` ticks of
+// a simulated clock, and a shader charges `encodeTime` ticks per encoded frame.
+struct SimulatedWire
+{
+    uint32_t now{0};
+    uint32_t busyUntil{0};
+    const uint8_t* inFlight{nullptr};
+    size_t framesSent{0};
+    size_t inFlightOverwrites{0};
+};
+
+SimulatedWire simulatedWire{};
+
+class WireCheckingProtocol : public MockProtocol
+{
+  public:
+    using MockProtocol::MockProtocol;
+
+    void update(lw::span<const TestColor> colors, lw::span<uint8_t> buffer = lw::span<uint8_t>{}) override
+    {
+        if (simulatedWire.now < simulatedWire.busyUntil && buffer.data() == simulatedWire.inFlight)
+        {
+            ++simulatedWire.inFlightOverwrites;
+        }
+
+        MockProtocol::update(colors, buffer);
+    }
+};
+
+struct LatencyTransportSettings
+{
+    bool invert{false};
+    uint32_t wireTime{60};
+    uint32_t callTime{0};
+};
+
+class LatencyTransport : public lw::transports::ITransport
+{
+  public:
+    using TransportSettingsType = LatencyTransportSettings;
+
+    explicit LatencyTransport(TransportSettingsType settings) : _settings(settings) {}
+
+    void begin() override {}
+
+    void transmitBytes(lw::span<uint8_t> data) override
+    {
+        simulatedWire.now += _settings.callTime;
+        simulatedWire.inFlight = data.data();
+        simulatedWire.busyUntil = simulatedWire.now + _settings.wireTime;
+        ++simulatedWire.framesSent;
+    }
+
+    bool isReadyToUpdate() const override { return simulatedWire.now >= simulatedWire.busyUntil; }
+
+  private:
+    TransportSettingsType _settings{};
+};
+
+class EncodeCostShader : public lw::IShader<TestColor>
+{
+  public:
+    void apply(lw::span<TestColor>) override { simulatedWire.now += 30; }
+};
+
 void test_constructor_manages_internal_typed_buffers_and_runs_pipeline(void)
 {
     MockProtocolSettings protocolSettings{};
@@ -235,6 +331,1043 @@ void test_platform_default_transport_template_default_constructs(void)
     TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(bus.protocolBuffer().size()),
                              static_cast<uint32_t>(bus.protocol().lastBufferSize));
 }
+void test_dirty_ranges_use_partial_update_after_first_full_frame(void)
+{
+    static_assert(lw::protocols::ProtocolSupportsPartialUpdate<MockPartialProtocol>,
+                  "mock opts into partial updates");
+    static_assert(!lw::protocols::ProtocolSupportsPartialUpdate<MockProtocol>, "base protocols stay full-frame");
+
+    lw::busses::PixelBus<MockPartialProtocol, MockTransport> bus(16, MockProtocolSettings{}, MockTransportSettings{});
+    bus.begin();
+
+    // The first frame is always encoded in full, even if only a range was marked.
+    bus.editPixels(2, 3)[0] = TestColor{1, 2, 3};
+    bus.show();
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(bus.protocol().fullUpdateCount));
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(bus.protocol().ranges.size()));
+
+    bus.editPixels(4, 2)[1] = TestColor{9, 9, 9};
+    bus.markDirty(6, 1);
+    bus.markDirty(12, 10);
+    bus.show();
+
+    const auto& protocol = bus.protocol();
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(protocol.fullUpdateCount));
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(protocol.ranges.size()));
+    TEST_ASSERT_EQUAL_UINT32(4U, static_cast<uint32_t>(protocol.ranges[0].first));
+    TEST_ASSERT_EQUAL_UINT32(7U, static_cast<uint32_t>(protocol.ranges[0].end));
+    TEST_ASSERT_EQUAL_UINT32(12U, static_cast<uint32_t>(protocol.ranges[1].first));
+    TEST_ASSERT_EQUAL_UINT32(16U, static_cast<uint32_t>(protocol.ranges[1].end));
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(bus.transport().beginTransactionCount));
+    TEST_ASSERT_TRUE(bus.dirtyRanges().empty());
+
+    // Clean bus: nothing to send.
+    bus.show();
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(bus.transport().beginTransactionCount));
+
+    // Whole-view access still forces a full frame.
+    bus.pixels();
+    bus.show();
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(protocol.fullUpdateCount));
+}
+
+void test_dirty_ranges_fall_back_to_full_update_without_capability(void)
+{
+    lw::busses::PixelBus<MockProtocol, MockTransport> bus(4, MockProtocolSettings{}, MockTransportSettings{});
+    bus.begin();
+    bus.show();
+
+    bus.editPixels(1, 1)[0] = TestColor{7, 7, 7};
+    bus.show();
+
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(bus.transport().beginTransactionCount));
+    TEST_ASSERT_EQUAL_UINT32(4U, static_cast<uint32_t>(bus.protocol().captured.size()));
+    TEST_ASSERT_EQUAL_UINT8(7U, bus.protocol().captured[1]['R']);
+}
+
+template <typename TProtocol> void assert_partial_frames_match_full_encode(typename TProtocol::SettingsType settings)
+{
+    constexpr uint16_t PixelCount = 40;
+    lw::busses::PixelBus<TProtocol, MockTransport> bus(PixelCount, settings, MockTransportSettings{});
+    bus.begin();
+
+    auto root = bus.rootPixels();
+    for (size_t index = 0; index < root.size(); ++index)
+    {
+        root[index] = TestColor{static_cast<uint8_t>(index), static_cast<uint8_t>(index * 3),
+                                static_cast<uint8_t>(255 - index)};
+    }
+    bus.pixels();
+    bus.show();
+
+    auto sparkle = bus.editPixels(0, 2);
+    sparkle[0] = TestColor{200, 100, 50};
+    sparkle[1] = TestColor{1, 2, 3};
+    bus.editPixels(17, 3)[2] = TestColor{0xAA, 0x55, 0x0F};
+    bus.editPixels(39, 1)[0] = TestColor{9, 8, 7};
+    bus.show();
+
+    TProtocol reference(PixelCount, settings);
+    std::vector<uint8_t> expected(reference.requiredBufferSizeBytes(), 0);
+    reference.update(lw::span<const TestColor>{root.data(), root.size()},
+                     lw::span<uint8_t>{expected.data(), expected.size()});
+
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.size()),
+                             static_cast<uint32_t>(bus.transport().transmitted.size()));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected.data(), bus.transport().transmitted.data(), expected.size());
+}
+
+void test_dirty_ranges_partial_frames_match_full_encode_for_fixed_stride_protocols(void)
+{
+    assert_partial_frames_match_full_encode<lw::protocols::Ws2812xProtocol<TestColor>>(
+        lw::protocols::Ws2812xProtocolSettings{{}, lw::ChannelOrder::GRB::value});
+    assert_partial_frames_match_full_encode<lw::protocols::Apa102Protocol<TestColor>>(
+        lw::protocols::Apa102ProtocolSettings{});
+    assert_partial_frames_match_full_encode<lw::protocols::Hd108Protocol<TestColor>>(
+        lw::protocols::Hd108ProtocolSettings{});
+}
+// Inverts the caller's bytes in place before sending, as DMA transports with an
+// inverted output do, and records what reached the wire.
+class InvertingTransport : public MockTransport
+{
+  public:
+    using MockTransport::MockTransport;
+    static constexpr bool PreservesBuffer = false;
+
+    void transmitBytes(lw::span<uint8_t> data) override
+    {
+        for (auto& byte : data)
+        {
+            byte = static_cast<uint8_t>(~byte);
+        }
+
+        MockTransport::transmitBytes(data);
+    }
+};
+
+void test_dirty_ranges_re_encode_whole_frame_when_transport_mutates_buffer(void)
+{
+    using Protocol = lw::protocols::Ws2812xProtocol<TestColor>;
+    using Bus = lw::busses::PixelBus<Protocol, InvertingTransport>;
+    static_assert(!Bus::UsesPartialUpdate, "a mutated buffer cannot be patched in place");
+    static_assert(lw::busses::PixelBus<Protocol, MockTransport>::UsesPartialUpdate, "an intact buffer can");
+
+    constexpr size_t PixelCount = 24;
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+    Bus bus(PixelCount, settings, MockTransportSettings{});
+    bus.begin();
+
+    auto root = bus.rootPixels();
+    for (size_t index = 0; index < root.size(); ++index)
+    {
+        root[index] = TestColor{static_cast<uint8_t>(index * 9), 0x42, static_cast<uint8_t>(~index)};
+    }
+    bus.pixels();
+    bus.show();
+
+    bus.editPixels(3, 2)[0] = TestColor{0x80, 0x01, 0xFE};
+    bus.editPixels(20, 1)[0] = TestColor{0x0F, 0xF0, 0x33};
+    bus.show();
+
+    Protocol reference(PixelCount, settings);
+    std::vector<uint8_t> expected(reference.requiredBufferSizeBytes(), 0);
+    reference.update(lw::span<const TestColor>{root.data(), root.size()},
+                     lw::span<uint8_t>{expected.data(), expected.size()});
+    for (auto& byte : expected)
+    {
+        byte = static_cast<uint8_t>(~byte);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.size()),
+                             static_cast<uint32_t>(bus.transport().transmitted.size()));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected.data(), bus.transport().transmitted.data(), expected.size());
+}
+
+size_t run_simulated_frames(bool doubleBuffered, uint32_t duration)
+{
+    simulatedWire = SimulatedWire{};
+
+    lw::busses::PixelBus<WireCheckingProtocol, LatencyTransport, EncodeCostShader> bus(
+        8, MockProtocolSettings{}, LatencyTransportSettings{}, EncodeCostShader{});
+    bus.setDoubleBuffered(doubleBuffered);
+    bus.begin();
+
+    // Render loop: a new frame every iteration, one tick of other work in between.
+    uint8_t value = 0;
+    while (simulatedWire.now < duration)
+    {
+        bus.pixels()[0] = TestColor{value++, 0, 0};
+        bus.show();
+        ++simulatedWire.now;
+    }
+
+    return simulatedWire.framesSent;
+}
+
+uint32_t simulatedWireClock()
+{
+    return simulatedWire.now;
+}
+
+class SerializeCostProtocol : public MockProtocol
+{
+  public:
+    using MockProtocol::MockProtocol;
+
+    void update(lw::span<const TestColor> colors, lw::span<uint8_t> buffer = lw::span<uint8_t>{}) override
+    {
+        simulatedWire.now += 7;
+        MockProtocol::update(colors, buffer);
+    }
+};
+
+void test_frame_timing_records_stages_and_skipped_shows(void)
+{
+    simulatedWire = SimulatedWire{};
+    lw::busses::FrameTiming timing{simulatedWireClock};
+
+    lw::busses::PixelBus<SerializeCostProtocol, LatencyTransport, EncodeCostShader> bus(
+        4, MockProtocolSettings{}, LatencyTransportSettings{false, 60, 5}, EncodeCostShader{});
+    bus.setFrameTiming(&timing);
+
+    bus.show();
+    bus.pixels()[0] = TestColor{1, 2, 3};
+    bus.show();
+    simulatedWire.now = simulatedWire.busyUntil;
+    bus.show();
+    simulatedWire.now = simulatedWire.busyUntil;
+    bus.show();
+
+    const lw::busses::FrameTimingStats stats = timing.stats();
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.shownFrames);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.busySkippedShows);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.cleanSkippedShows);
+
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.shade.samples);
+    TEST_ASSERT_EQUAL_UINT32(30U, stats.shade.max);
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.serialize.samples);
+    TEST_ASSERT_EQUAL_UINT32(7U, stats.serialize.avg);
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.transmit.samples);
+    TEST_ASSERT_EQUAL_UINT32(5U, stats.transmit.min);
+
+    bus.setFrameTiming(nullptr);
+    bus.pixels()[0] = TestColor{4, 5, 6};
+    bus.show();
+    TEST_ASSERT_EQUAL_UINT32(2U, timing.stats().shownFrames);
+}
+
+// Charges 100 ticks to whichever stage changed the watched buffer since the last read.
+lw::span<const uint8_t> watchedEncodeBuffer{};
+std::vector<uint8_t> watchedEncodeSnapshot{};
+uint32_t watchedEncodeNow{0};
+
+uint32_t encodeWatchingClock()
+{
+    if (!std::equal(watchedEncodeBuffer.begin(), watchedEncodeBuffer.end(), watchedEncodeSnapshot.begin(),
+                    watchedEncodeSnapshot.end()))
+    {
+        watchedEncodeSnapshot.assign(watchedEncodeBuffer.begin(), watchedEncodeBuffer.end());
+        watchedEncodeNow += 100;
+    }
+
+    return watchedEncodeNow;
+}
+
+void test_frame_timing_records_one_wire_encoding_as_serialize(void)
+{
+    lw::busses::PixelBus<lw::protocols::Ws2812xProtocol<TestColor>, MockTransport> bus(
+        4, lw::protocols::Ws2812xProtocolSettings{{}, lw::ChannelOrder::GRB::value}, MockTransportSettings{});
+    const auto protocolBytes = bus.protocolBuffer();
+    watchedEncodeBuffer = lw::span<const uint8_t>{protocolBytes.data(), protocolBytes.size()};
+    watchedEncodeSnapshot.assign(protocolBytes.begin(), protocolBytes.end());
+    watchedEncodeNow = 0;
+
+    lw::busses::FrameTiming timing{encodeWatchingClock};
+    bus.setFrameTiming(&timing);
+    bus.pixels()[1] = TestColor{0x12, 0x34, 0x56};
+    bus.show();
+
+    const lw::busses::FrameTimingStats stats = timing.stats();
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.serialize.samples);
+    TEST_ASSERT_EQUAL_UINT32(100U, stats.serialize.max);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.transmit.samples);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.transmit.max);
+}
+
+void test_frame_timing_keeps_rolling_window_percentiles(void)
+{
+    lw::busses::FrameTiming timing{simulatedWireClock};
+    for (uint32_t sample = 1; sample <= 100; ++sample)
+    {
+        timing.record(lw::busses::FrameStage::Transmit, sample);
+    }
+
+    lw::busses::FrameStageStats stats = timing.stage(lw::busses::FrameStage::Transmit);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.min);
+    TEST_ASSERT_EQUAL_UINT32(50U, stats.avg);
+    TEST_ASSERT_EQUAL_UINT32(99U, stats.p99);
+    TEST_ASSERT_EQUAL_UINT32(100U, stats.max);
+
+    // Older samples roll out of the window.
+    for (size_t sample = 0; sample < lw::busses::FrameTiming::WindowSamples; ++sample)
+    {
+        timing.record(lw::busses::FrameStage::Transmit, 500);
+    }
+
+    stats = timing.stage(lw::busses::FrameStage::Transmit);
+    TEST_ASSERT_EQUAL_UINT32(500U, stats.min);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(lw::busses::FrameTiming::WindowSamples), stats.samples);
+    TEST_ASSERT_EQUAL_UINT32(0U, timing.stage(lw::busses::FrameStage::Shade).samples);
+}
+
+void test_frame_timing_counts_concurrent_shows_exactly(void)
+{
+    constexpr size_t ThreadCount = 4;
+    constexpr uint32_t ShowsPerThread = 20000;
+    lw::busses::FrameTiming timing{simulatedWireClock};
+
+    // Buses sharing one FrameTiming while they prepare on different workers.
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < ThreadCount; ++thread)
+    {
+        threads.emplace_back(
+            [&timing]()
+            {
+                for (uint32_t show = 0; show < ShowsPerThread; ++show)
+                {
+                    timing.record(lw::busses::FrameStage::Serialize, 7);
+                    timing.countShow(lw::ShowStatus::Queued);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const lw::busses::FrameTimingStats stats = timing.stats();
+    TEST_ASSERT_EQUAL_UINT32(ThreadCount * ShowsPerThread, stats.shownFrames);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(lw::busses::FrameTiming::WindowSamples), stats.serialize.samples);
+    TEST_ASSERT_EQUAL_UINT32(7U, stats.serialize.min);
+    TEST_ASSERT_EQUAL_UINT32(7U, stats.serialize.max);
+
+    timing.reset();
+    TEST_ASSERT_EQUAL_UINT32(0U, timing.stats().shownFrames);
+    TEST_ASSERT_EQUAL_UINT32(0U, timing.stats().serialize.samples);
+}
+
+void test_double_buffered_show_overlaps_encode_with_transmission(void)
+{
+    constexpr uint32_t Duration = 6000;
+    const size_t singleFrames = run_simulated_frames(false, Duration);
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(simulatedWire.inFlightOverwrites));
+
+    const size_t doubleFrames = run_simulated_frames(true, Duration);
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(simulatedWire.inFlightOverwrites));
+
+    char message[96];
+    std::snprintf(message, sizeof(message), "encode 30 + wire 60 ticks: single %u frames, double %u frames",
+                  static_cast<unsigned>(singleFrames), static_cast<unsigned>(doubleFrames));
+    TEST_MESSAGE(message);
+
+    // Serial: encode + wire = 91 ticks per frame. Overlapped: bounded by the wire time.
+    TEST_ASSERT_TRUE(singleFrames <= (Duration / 90U) + 1U);
+    TEST_ASSERT_TRUE(doubleFrames * 100U >= singleFrames * 140U);
+}
+
+void test_double_buffered_show_holds_frame_until_transport_ready(void)
+{
+    simulatedWire = SimulatedWire{};
+
+    lw::busses::PixelBus<WireCheckingProtocol, LatencyTransport> bus(4, MockProtocolSettings{},
+                                                                     LatencyTransportSettings{});
+    bus.setDoubleBuffered(true);
+    TEST_ASSERT_TRUE(bus.isDoubleBuffered());
+
+    bus.pixels()[1] = TestColor{1, 2, 3};
+    bus.show();
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(simulatedWire.framesSent));
+    TEST_ASSERT_FALSE(bus.hasPendingFrame());
+    const uint8_t* firstWireBuffer = simulatedWire.inFlight;
+
+    // Transport busy: the frame is encoded into the other buffer and held.
+    bus.pixels()[1] = TestColor{4, 5, 6};
+    bus.show();
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(simulatedWire.framesSent));
+    TEST_ASSERT_TRUE(bus.hasPendingFrame());
+    TEST_ASSERT_TRUE(bus.protocol().lastBuffer != firstWireBuffer);
+    TEST_ASSERT_EQUAL_UINT8(4U, bus.protocol().captured[1]['R']);
+
+    // Nothing new to encode; the held frame goes out once the wire is free.
+    simulatedWire.now = simulatedWire.busyUntil;
+    bus.show();
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(simulatedWire.framesSent));
+    TEST_ASSERT_FALSE(bus.hasPendingFrame());
+    TEST_ASSERT_TRUE(simulatedWire.inFlight != firstWireBuffer);
+    TEST_ASSERT_TRUE(bus.protocolBuffer().data() == simulatedWire.inFlight);
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(simulatedWire.inFlightOverwrites));
+}
+void count_completion(void* context)
+{
+    ++*static_cast<size_t*>(context);
+}
+
+void test_double_buffered_show_async_completes_held_frames(void)
+{
+    simulatedWire = SimulatedWire{};
+
+    lw::busses::PixelBus<WireCheckingProtocol, LatencyTransport> bus(4, MockProtocolSettings{},
+                                                                     LatencyTransportSettings{});
+    bus.setDoubleBuffered(true);
+    size_t first = 0;
+    size_t held = 0;
+    size_t flush = 0;
+
+    TEST_ASSERT_EQUAL(lw::ShowStatus::Queued, bus.showAsync(lw::ShowCompletion{count_completion, &first}));
+
+    // Held behind the frame on the wire: queued, completing once it has been sent.
+    bus.pixels()[1] = TestColor{4, 5, 6};
+    TEST_ASSERT_EQUAL(lw::ShowStatus::Queued, bus.showAsync(lw::ShowCompletion{count_completion, &held}));
+    TEST_ASSERT_TRUE(bus.hasPendingFrame());
+    TEST_ASSERT_EQUAL(lw::ShowStatus::SkippedClean, bus.showAsync(lw::ShowCompletion{count_completion, &flush}));
+
+    simulatedWire.now = simulatedWire.busyUntil;
+    TEST_ASSERT_EQUAL(lw::ShowStatus::SkippedClean, bus.showAsync(lw::ShowCompletion{count_completion, &flush}));
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(simulatedWire.framesSent));
+    TEST_ASSERT_EQUAL_size_t(1U, first);
+    TEST_ASSERT_EQUAL_size_t(0U, held);
+
+    simulatedWire.now = simulatedWire.busyUntil;
+    TEST_ASSERT_TRUE(bus.pollCompletion());
+    TEST_ASSERT_EQUAL_size_t(1U, held);
+    TEST_ASSERT_EQUAL_size_t(0U, flush);
+
+    // A held frame replaced by a newer one completes when it is replaced.
+    size_t replaced = 0;
+    size_t newest = 0;
+    bus.pixels()[1] = TestColor{7, 8, 9};
+    TEST_ASSERT_EQUAL(lw::ShowStatus::Queued, bus.showAsync());
+    bus.pixels()[1] = TestColor{1, 1, 1};
+    TEST_ASSERT_EQUAL(lw::ShowStatus::Queued, bus.showAsync(lw::ShowCompletion{count_completion, &replaced}));
+    bus.pixels()[1] = TestColor{2, 2, 2};
+    TEST_ASSERT_EQUAL(lw::ShowStatus::Queued, bus.showAsync(lw::ShowCompletion{count_completion, &newest}));
+    TEST_ASSERT_EQUAL_size_t(1U, replaced);
+    TEST_ASSERT_EQUAL_size_t(0U, newest);
+
+    simulatedWire.now = simulatedWire.busyUntil;
+    bus.show();
+    simulatedWire.now = simulatedWire.busyUntil;
+    TEST_ASSERT_TRUE(bus.pollCompletion());
+    TEST_ASSERT_EQUAL_size_t(1U, newest);
+    TEST_ASSERT_EQUAL_UINT8(2U, bus.protocol().captured[1]['R']);
+}
+
+class ChunkCollectingTransport : public lw::transports::ITransport
+{
+  public:
+    using TransportSettingsType = MockTransportSettings;
+    static constexpr bool PreservesBuffer = true;
+    static constexpr bool StreamsChunks = true;
+
+    explicit ChunkCollectingTransport(TransportSettingsType) {}
+
+    void begin() override {}
+
+    void transmitBytes(lw::span<uint8_t> data) override
+    {
+        largestChunk = std::max(largestChunk, data.size());
+        received.insert(received.end(), data.begin(), data.end());
+    }
+
+    std::vector<uint8_t> received{};
+    size_t largestChunk{0};
+};
+
+void test_streaming_show_sends_full_frame_without_protocol_buffer(void)
+{
+    using Protocol = lw::protocols::Ws2812xProtocol<TestColor>;
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+
+    lw::busses::PixelBus<Protocol, ChunkCollectingTransport> bus(500, settings, MockTransportSettings{});
+    TEST_ASSERT_TRUE(bus.setStreaming(true, 256, 2));
+    TEST_ASSERT_TRUE(bus.isStreaming());
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(bus.protocolBuffer().size()));
+
+    auto root = bus.rootPixels();
+    for (size_t index = 0; index < root.size(); ++index)
+    {
+        root[index] = TestColor{static_cast<uint8_t>(index), static_cast<uint8_t>(index >> 1), 0x5A};
+    }
+    bus.pixels();
+    bus.begin();
+    bus.show();
+
+    Protocol reference(500, settings);
+    std::vector<uint8_t> expected(reference.requiredBufferSizeBytes(), 0);
+    reference.update(lw::span<const TestColor>{root.data(), root.size()},
+                     lw::span<uint8_t>{expected.data(), expected.size()});
+
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.size()),
+                             static_cast<uint32_t>(bus.transport().received.size()));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), bus.transport().received.data(), expected.size());
+    TEST_ASSERT_TRUE(bus.transport().largestChunk <= 256U);
+
+    // Disabling streaming restores the persistent protocol buffer.
+    TEST_ASSERT_FALSE(bus.setStreaming(false));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.size()), static_cast<uint32_t>(bus.protocolBuffer().size()));
+
+    // Protocols without a streaming encoder stay on the buffered path.
+    lw::busses::PixelBus<MockProtocol, MockTransport> buffered(4, MockProtocolSettings{}, MockTransportSettings{});
+    TEST_ASSERT_FALSE(buffered.setStreaming(true));
+    TEST_ASSERT_FALSE(buffered.isStreaming());
+}
+
+// Queues chunks the way a DMA transport does and reads each one only when its simulated
+// transfer completes, counting chunks that changed while they were queued.
+class QueuedChunkTransport : public lw::transports::ITransport
+{
+  public:
+    using TransportSettingsType = MockTransportSettings;
+    static constexpr bool PreservesBuffer = true;
+    static constexpr bool StreamsChunks = true;
+    static constexpr size_t StreamChunksInFlight = 2;
+
+    explicit QueuedChunkTransport(TransportSettingsType) {}
+
+    void begin() override {}
+
+    void transmitBytes(lw::span<uint8_t> data) override
+    {
+        // A full queue blocks until its oldest chunk is on the wire.
+        if (queued.size() == StreamChunksInFlight)
+        {
+            completeOldest();
+        }
+
+        queued.push_back(QueuedChunk{data, std::vector<uint8_t>(data.begin(), data.end())});
+    }
+
+    bool isReadyToUpdate() const override { return queued.empty(); }
+
+    void completeAll()
+    {
+        while (!queued.empty())
+        {
+            completeOldest();
+        }
+    }
+
+    std::vector<uint8_t> wire{};
+    size_t overwrittenChunks{0};
+
+  private:
+    struct QueuedChunk
+    {
+        lw::span<uint8_t> data;
+        std::vector<uint8_t> handedOver;
+    };
+
+    void completeOldest()
+    {
+        const QueuedChunk& chunk = queued.front();
+        if (!std::equal(chunk.data.begin(), chunk.data.end(), chunk.handedOver.begin()))
+        {
+            ++overwrittenChunks;
+        }
+
+        wire.insert(wire.end(), chunk.data.begin(), chunk.data.end());
+        queued.erase(queued.begin());
+    }
+
+    std::vector<QueuedChunk> queued{};
+};
+
+void test_streaming_leaves_queued_chunks_intact_until_they_complete(void)
+{
+    using Protocol = lw::protocols::Ws2812xProtocol<TestColor>;
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+
+    // One chunk is asked for; the ring adds enough for the two the transport keeps queued.
+    lw::busses::PixelBus<Protocol, QueuedChunkTransport> bus(500, settings, MockTransportSettings{});
+    TEST_ASSERT_TRUE(bus.setStreaming(true, 128, 1));
+
+    auto root = bus.rootPixels();
+    for (size_t index = 0; index < root.size(); ++index)
+    {
+        root[index] = TestColor{static_cast<uint8_t>(index * 3), static_cast<uint8_t>(index), 0x33};
+    }
+    bus.pixels();
+    bus.begin();
+    bus.show();
+    TEST_ASSERT_FALSE(bus.transport().isReadyToUpdate());
+    bus.transport().completeAll();
+
+    Protocol reference(500, settings);
+    std::vector<uint8_t> expected(reference.requiredBufferSizeBytes(), 0);
+    reference.update(lw::span<const TestColor>{root.data(), root.size()},
+                     lw::span<uint8_t>{expected.data(), expected.size()});
+
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(bus.transport().overwrittenChunks));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.size()), static_cast<uint32_t>(bus.transport().wire.size()));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), bus.transport().wire.data(), expected.size());
+
+    // A transport that may restart its transfer on every call cannot take chunks.
+    lw::busses::PixelBus<Protocol, MockTransport> whole(500, settings, MockTransportSettings{});
+    TEST_ASSERT_FALSE(whole.setStreaming(true));
+    TEST_ASSERT_FALSE(whole.isStreaming());
+}
+
+void test_streaming_shades_chunks_without_frame_sized_scratch(void)
+{
+    using Protocol = lw::protocols::Ws2812xProtocol<TestColor>;
+    using Shader = lw::shaders::GammaShader<TestColor>;
+    using Bus = lw::busses::PixelBus<Protocol, ChunkCollectingTransport, Shader>;
+    static_assert(Bus::FusesShader && Bus::SupportsStreaming, "gamma shades each streamed chunk");
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+
+    // Chunks that split pixels, over a frame of several partial shade blocks.
+    Bus bus(LW_FUSED_SHADE_BLOCK_PIXELS * 3 + 5, settings, MockTransportSettings{}, Shader{});
+    TEST_ASSERT_TRUE(bus.setStreaming(true, 100, 2));
+
+    auto root = bus.rootPixels();
+    for (size_t index = 0; index < root.size(); ++index)
+    {
+        root[index] = TestColor{static_cast<uint8_t>(index * 5), static_cast<uint8_t>(200 - index), 0x90};
+    }
+    bus.pixels();
+    bus.begin();
+    bus.show();
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(bus.shaderScratch().size()));
+
+    std::vector<TestColor> shaded(root.begin(), root.end());
+    Shader{}.apply(lw::span<TestColor>{shaded.data(), shaded.size()});
+    Protocol reference(static_cast<lw::PixelCount>(shaded.size()), settings);
+    std::vector<uint8_t> expected(reference.requiredBufferSizeBytes(), 0);
+    reference.update(lw::span<const TestColor>{shaded.data(), shaded.size()},
+                     lw::span<uint8_t>{expected.data(), expected.size()});
+
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.size()),
+                             static_cast<uint32_t>(bus.transport().received.size()));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), bus.transport().received.data(), expected.size());
+}
+
+template <typename TProtocol>
+std::vector<uint8_t> expected_truncated_frame(const TProtocol& protocol, const std::vector<uint8_t>& fullFrame,
+                                              size_t pixelCount)
+{
+    const size_t payload = protocol.truncatedPayloadSize(pixelCount);
+    const size_t latch = protocol.truncatedLatchSize(pixelCount);
+    std::vector<uint8_t> frame(fullFrame.begin(), fullFrame.begin() + payload);
+    frame.insert(frame.end(), fullFrame.end() - latch, fullFrame.end());
+    return frame;
+}
+
+template <typename TProtocol>
+std::vector<uint8_t> reference_frame(lw::span<const TestColor> colors, const typename TProtocol::SettingsType& settings)
+{
+    TProtocol reference(static_cast<lw::PixelCount>(colors.size()), settings);
+    std::vector<uint8_t> frame(reference.requiredBufferSizeBytes(), 0);
+    reference.update(colors, lw::span<uint8_t>{frame.data(), frame.size()});
+    return frame;
+}
+
+template <typename TProtocol>
+void assert_truncated_transmission_sends_modified_prefix(const typename TProtocol::SettingsType& settings)
+{
+    constexpr size_t PixelCount = 300;
+    lw::busses::PixelBus<TProtocol, ChunkCollectingTransport> bus(PixelCount, settings, MockTransportSettings{});
+    TEST_ASSERT_TRUE(bus.setTruncatedTransmission(true));
+    bus.begin();
+
+    auto root = bus.rootPixels();
+    for (size_t index = 0; index < root.size(); ++index)
+    {
+        root[index] = TestColor{static_cast<uint8_t>(index), 0x11, static_cast<uint8_t>(index * 3)};
+    }
+    bus.pixels();
+    bus.show();
+
+    // The first frame has no known strip state behind it and goes out whole.
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(bus.protocolBuffer().size()),
+                             static_cast<uint32_t>(bus.transport().received.size()));
+
+    auto edited = bus.editPixels(5, 10);
+    std::fill(edited.begin(), edited.end(), TestColor{0xAA, 0xBB, 0xCC});
+    bus.editPixels(40, 2)[1] = TestColor{1, 2, 3};
+    bus.transport().received.clear();
+    bus.show();
+
+    const lw::span<const TestColor> colors{root.data(), root.size()};
+    const std::vector<uint8_t> fullFrame = reference_frame<TProtocol>(colors, settings);
+    const auto expected = expected_truncated_frame(bus.protocol(), fullFrame, 42);
+    TEST_ASSERT_TRUE(expected.size() < fullFrame.size());
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.size()),
+                             static_cast<uint32_t>(bus.transport().received.size()));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), bus.transport().received.data(), expected.size());
+
+    // The pixels the latch was moved over are restored, so a longer prefix is correct.
+    bus.editPixels(60, 1)[0] = TestColor{4, 5, 6};
+    bus.transport().received.clear();
+    bus.show();
+    const auto longer = expected_truncated_frame(bus.protocol(), reference_frame<TProtocol>(colors, settings), 61);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(longer.size()),
+                             static_cast<uint32_t>(bus.transport().received.size()));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(longer.data(), bus.transport().received.data(), longer.size());
+
+    // Whole-bus access cannot bound the change and restores a full frame.
+    bus.pixels();
+    bus.transport().received.clear();
+    bus.show();
+    const std::vector<uint8_t> restored = reference_frame<TProtocol>(colors, settings);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(restored.size()),
+                             static_cast<uint32_t>(bus.transport().received.size()));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(restored.data(), bus.transport().received.data(), restored.size());
+}
+
+void test_truncated_transmission_sends_prefix_through_last_modified_pixel(void)
+{
+    assert_truncated_transmission_sends_modified_prefix<lw::protocols::Ws2812xProtocol<TestColor>>(
+        lw::protocols::Ws2812xProtocolSettings{{}, lw::ChannelOrder::GRB::value});
+    assert_truncated_transmission_sends_modified_prefix<lw::protocols::Apa102Protocol<TestColor>>(
+        lw::protocols::Apa102ProtocolSettings{});
+}
+
+// Stand-in for a DMA transport: each transmitBytes() call restarts the transfer on the
+// caller's buffer, and the bytes reach the wire only when the test completes it.
+class AsyncWireTransport : public lw::transports::ITransport
+{
+  public:
+    using TransportSettingsType = MockTransportSettings;
+    static constexpr bool PreservesBuffer = true;
+
+    explicit AsyncWireTransport(TransportSettingsType) {}
+
+    void begin() override {}
+
+    void beginTransaction() override { callsInTransaction = 0; }
+
+    void transmitBytes(lw::span<uint8_t> data) override
+    {
+        ++callsInTransaction;
+        inFlight = data;
+    }
+
+    bool isReadyToUpdate() const override { return inFlight.empty(); }
+
+    void complete()
+    {
+        wire.assign(inFlight.begin(), inFlight.end());
+        inFlight = lw::span<uint8_t>{};
+    }
+
+    size_t callsInTransaction{0};
+    lw::span<uint8_t> inFlight{};
+    std::vector<uint8_t> wire{};
+};
+
+template <typename TProtocol>
+void assert_truncated_frame_is_one_transfer(const typename TProtocol::SettingsType& settings)
+{
+    constexpr size_t PixelCount = 100;
+    lw::busses::PixelBus<TProtocol, AsyncWireTransport> bus(PixelCount, settings, MockTransportSettings{});
+    TEST_ASSERT_TRUE(bus.setTruncatedTransmission(true));
+    bus.begin();
+
+    auto root = bus.rootPixels();
+    for (size_t index = 0; index < root.size(); ++index)
+    {
+        root[index] = TestColor{0x21, static_cast<uint8_t>(index), static_cast<uint8_t>(index * 5)};
+    }
+    const lw::span<const TestColor> colors{root.data(), root.size()};
+    bus.pixels();
+    bus.show();
+    bus.transport().complete();
+
+    for (const size_t edited : {10U, 3U, 57U, 11U})
+    {
+        bus.editPixels(edited, 1)[0] = TestColor{static_cast<uint8_t>(edited), 0xEE, 0x01};
+        TEST_ASSERT_EQUAL(lw::ShowStatus::Queued, bus.showAsync());
+        TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(bus.transport().callsInTransaction));
+        bus.transport().complete();
+
+        const auto expected =
+            expected_truncated_frame(bus.protocol(), reference_frame<TProtocol>(colors, settings), edited + 1);
+        TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.size()),
+                                 static_cast<uint32_t>(bus.transport().wire.size()));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), bus.transport().wire.data(), expected.size());
+    }
+}
+
+void test_truncated_frame_reaches_async_transport_as_one_transfer(void)
+{
+    assert_truncated_frame_is_one_transfer<lw::protocols::Ws2812xProtocol<TestColor>>(
+        lw::protocols::Ws2812xProtocolSettings{{}, lw::ChannelOrder::GRB::value});
+    assert_truncated_frame_is_one_transfer<lw::protocols::Apa102Protocol<TestColor>>(
+        lw::protocols::Apa102ProtocolSettings{});
+}
+
+class GatedCollectingTransport : public ChunkCollectingTransport
+{
+  public:
+    using ChunkCollectingTransport::ChunkCollectingTransport;
+
+    bool isReadyToUpdate() const override { return ready; }
+
+    bool ready{true};
+};
+
+void test_truncated_transmission_covers_frames_skipped_by_double_buffering(void)
+{
+    using Protocol = lw::protocols::Ws2812xProtocol<TestColor>;
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+
+    lw::busses::PixelBus<Protocol, GatedCollectingTransport> bus(64, settings, MockTransportSettings{});
+    TEST_ASSERT_TRUE(bus.setTruncatedTransmission(true));
+    bus.setDoubleBuffered(true);
+    bus.begin();
+    bus.show();
+
+    // Two frames are encoded while the wire is busy; the one sent must cover both.
+    bus.transport().ready = false;
+    bus.editPixels(30, 1)[0] = TestColor{9, 9, 9};
+    bus.show();
+    bus.editPixels(2, 1)[0] = TestColor{7, 7, 7};
+    bus.show();
+    TEST_ASSERT_TRUE(bus.hasPendingFrame());
+
+    bus.transport().received.clear();
+    bus.transport().ready = true;
+    bus.show();
+    TEST_ASSERT_FALSE(bus.hasPendingFrame());
+    TEST_ASSERT_EQUAL_UINT32(
+        static_cast<uint32_t>(bus.protocol().truncatedPayloadSize(31) + bus.protocol().truncatedLatchSize(31)),
+        static_cast<uint32_t>(bus.transport().received.size()));
+}
+
+void test_truncated_transmission_requires_protocol_support(void)
+{
+    lw::busses::PixelBus<MockProtocol, MockTransport> bus(4, MockProtocolSettings{}, MockTransportSettings{});
+    TEST_ASSERT_FALSE(bus.setTruncatedTransmission(true));
+    TEST_ASSERT_FALSE(bus.isTruncatedTransmission());
+
+    // HD108's end frame is all ones, which downstream pixels would latch as white.
+    TEST_ASSERT_FALSE(lw::protocols::ProtocolSupportsTruncation<lw::protocols::Hd108Protocol<TestColor>>);
+    TEST_ASSERT_TRUE(lw::protocols::ProtocolSupportsTruncation<lw::protocols::Apa102Protocol<TestColor>>);
+}
+
+template <typename TBus, typename TShader>
+void assert_protocol_buffer_matches_two_phase_encode(TBus& bus, const typename TBus::ProtocolSettingsType& settings,
+                                                     TShader referenceShader)
+{
+    using Protocol = typename TBus::ProtocolType;
+
+    std::vector<TestColor> shaded(bus.rootPixels().begin(), bus.rootPixels().end());
+    referenceShader.apply(lw::span<TestColor>{shaded.data(), shaded.size()});
+
+    Protocol reference(static_cast<lw::PixelCount>(bus.pixelCount()), settings);
+    std::vector<uint8_t> expected(reference.requiredBufferSizeBytes(), 0);
+    reference.update(lw::span<const TestColor>{shaded.data(), shaded.size()},
+                     lw::span<uint8_t>{expected.data(), expected.size()});
+
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.size()), static_cast<uint32_t>(bus.protocolBuffer().size()));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), bus.protocolBuffer().data(), expected.size());
+}
+
+template <typename TProtocol>
+void assert_pointwise_shader_fuses_into_encode(const typename TProtocol::SettingsType& settings)
+{
+    using Shader = lw::shaders::GammaShader<TestColor>;
+    using Bus = lw::busses::PixelBus<TProtocol, ChunkCollectingTransport, Shader>;
+    static_assert(Bus::FusesShader && !Bus::UsesShaderScratch, "gamma shades inside the encode loop");
+    static_assert(Bus::UsesPartialUpdate, "pointwise shading keeps dirty-range updates");
+
+    // Not a multiple of the shade block size, so the last block is partial.
+    Bus bus(LW_FUSED_SHADE_BLOCK_PIXELS * 2 + 5, settings, MockTransportSettings{}, Shader{});
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(bus.shaderScratch().size()));
+    bus.begin();
+
+    auto root = bus.rootPixels();
+    for (size_t index = 0; index < root.size(); ++index)
+    {
+        root[index] = TestColor{static_cast<uint8_t>(index * 7), static_cast<uint8_t>(255 - index), 0x80};
+    }
+    const std::vector<TestColor> unshaded(root.begin(), root.end());
+    bus.pixels();
+    bus.show();
+
+    assert_protocol_buffer_matches_two_phase_encode(bus, settings, Shader{});
+    TEST_ASSERT_TRUE(std::equal(unshaded.begin(), unshaded.end(), root.begin()));
+
+    // Dirty ranges are shaded and re-encoded on their own.
+    auto edited = bus.editPixels(LW_FUSED_SHADE_BLOCK_PIXELS - 2, 5);
+    std::fill(edited.begin(), edited.end(), TestColor{0x40, 0xC0, 0x10});
+    bus.show();
+    assert_protocol_buffer_matches_two_phase_encode(bus, settings, Shader{});
+}
+
+void test_pointwise_shader_fuses_into_encode_without_scratch(void)
+{
+    assert_pointwise_shader_fuses_into_encode<lw::protocols::Ws2812xProtocol<TestColor>>(
+        lw::protocols::Ws2812xProtocolSettings{{}, lw::ChannelOrder::GRB::value});
+    assert_pointwise_shader_fuses_into_encode<lw::protocols::Apa102Protocol<TestColor>>(
+        lw::protocols::Apa102ProtocolSettings{});
+    assert_pointwise_shader_fuses_into_encode<lw::protocols::Hd108Protocol<TestColor>>(
+        lw::protocols::Hd108ProtocolSettings{});
+}
+
+void test_frame_statistics_shader_fuses_after_its_statistics_pass(void)
+{
+    using Shader = lw::shaders::CurrentLimiterShader<TestColor>;
+    using Bus = lw::busses::PixelBus<lw::protocols::Apa102Protocol<TestColor>, ChunkCollectingTransport, Shader>;
+    static_assert(Bus::FusesShader && Bus::ShadesWholeFrame, "limiter fuses but depends on the whole frame");
+    static_assert(!Bus::UsesPartialUpdate, "a budget change can touch every pixel");
+
+    Shader::SettingsType limiter{};
+    limiter.maxMilliamps = 400;
+    limiter.milliampsPerChannel = {20, 20, 20};
+
+    Bus bus(40, lw::protocols::Apa102ProtocolSettings{}, MockTransportSettings{}, Shader{limiter});
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(bus.shaderScratch().size()));
+    bus.begin();
+
+    auto root = bus.rootPixels();
+    std::fill(root.begin(), root.end(), TestColor{0xFF, 0xA0, 0x60});
+    bus.pixels();
+    bus.show();
+
+    TEST_ASSERT_TRUE(bus.shader().lastEstimatedMilliamps() <= limiter.maxMilliamps);
+    assert_protocol_buffer_matches_two_phase_encode(bus, lw::protocols::Apa102ProtocolSettings{}, Shader{limiter});
+    TEST_ASSERT_TRUE(root[0] == (TestColor{0xFF, 0xA0, 0x60}));
+}
+
+template <typename TBus> bool bus_buffers_lie_within(TBus& bus, const std::vector<uint8_t>& arena)
+{
+    const auto within = [&](const void* pointer, size_t bytes)
+    {
+        const auto* first = static_cast<const uint8_t*>(pointer);
+        return bytes == 0 || (first >= arena.data() && (first + bytes) <= (arena.data() + arena.size()));
+    };
+
+    return within(bus.rootPixels().data(), bus.rootPixels().size() * sizeof(TestColor)) &&
+           within(bus.shaderScratch().data(), bus.shaderScratch().size() * sizeof(TestColor)) &&
+           within(bus.protocolBuffer().data(), bus.protocolBuffer().size());
+}
+
+void test_supplied_buffers_from_one_arena_back_many_buses(void)
+{
+    using Protocol = lw::protocols::Ws2812xProtocol<TestColor>;
+    using PlainBus = lw::busses::PixelBus<Protocol, MockTransport>;
+    using ShadedBus = lw::busses::PixelBus<Protocol, MockTransport, IncrementRedShader>;
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+
+    constexpr auto plainRequirements = PlainBus::bufferRequirements(5, Protocol::SettingsType{});
+    static_assert(plainRequirements.rootPixels == 5 && plainRequirements.shaderScratch == 0,
+                  "requirements are available at compile time");
+    const auto shadedRequirements = ShadedBus::bufferRequirements(7, settings);
+    TEST_ASSERT_EQUAL_UINT32(7U, static_cast<uint32_t>(shadedRequirements.shaderScratch));
+
+    std::vector<uint8_t> arenaStorage(plainRequirements.arenaBytes<TestColor>() * 2 +
+                                      shadedRequirements.arenaBytes<TestColor>());
+    lw::busses::BufferArena arena{lw::span<uint8_t>{arenaStorage.data(), arenaStorage.size()}};
+
+    PlainBus first(5, settings, MockTransportSettings{}, arena.takeBusBuffers<TestColor>(plainRequirements));
+    PlainBus second(5, settings, MockTransportSettings{}, arena.takeBusBuffers<TestColor>(plainRequirements));
+    ShadedBus shaded(7, settings, MockTransportSettings{}, IncrementRedShader{},
+                     arena.takeBusBuffers<TestColor>(shadedRequirements));
+    PlainBus owning(5, settings, MockTransportSettings{});
+
+    TEST_ASSERT_TRUE(first.hasValidBuffers() && second.hasValidBuffers() && shaded.hasValidBuffers());
+    TEST_ASSERT_TRUE(bus_buffers_lie_within(first, arenaStorage));
+    TEST_ASSERT_TRUE(bus_buffers_lie_within(second, arenaStorage));
+    TEST_ASSERT_TRUE(bus_buffers_lie_within(shaded, arenaStorage));
+    TEST_ASSERT_TRUE(first.rootPixels().data() != second.rootPixels().data());
+    TEST_ASSERT_EQUAL_UINT32(7U, static_cast<uint32_t>(shaded.shaderScratch().size()));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(owning.protocolBuffer().size()),
+                             static_cast<uint32_t>(plainRequirements.protocolBytes));
+
+    for (auto* bus : {&first, &owning})
+    {
+        auto root = bus->rootPixels();
+        for (size_t index = 0; index < root.size(); ++index)
+        {
+            root[index] = TestColor{static_cast<uint8_t>(index + 1), 0x22, 0x33};
+        }
+        bus->pixels();
+        bus->show();
+    }
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(owning.protocolBuffer().data(), first.protocolBuffer().data(),
+                                  owning.protocolBuffer().size());
+
+    // Double buffering adds an owned back buffer; the supplied one stays in rotation.
+    first.setDoubleBuffered(true);
+    first.pixels()[0] = TestColor{9, 9, 9};
+    first.show();
+    TEST_ASSERT_FALSE(bus_buffers_lie_within(first, arenaStorage));
+    first.pixels()[0] = TestColor{8, 8, 8};
+    first.show();
+    TEST_ASSERT_TRUE(bus_buffers_lie_within(first, arenaStorage));
+    first.setDoubleBuffered(false);
+    TEST_ASSERT_TRUE(bus_buffers_lie_within(first, arenaStorage));
+}
+
+void test_undersized_supplied_buffers_leave_bus_empty(void)
+{
+    using Protocol = lw::protocols::Ws2812xProtocol<TestColor>;
+    using Bus = lw::busses::PixelBus<Protocol, MockTransport>;
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+    const auto requirements = Bus::bufferRequirements(4, settings);
+
+    std::vector<TestColor> pixels(requirements.rootPixels);
+    std::vector<uint8_t> protocolBytes(requirements.protocolBytes - 1);
+    lw::busses::BusBuffers<TestColor> buffers{};
+    buffers.rootPixels = lw::span<TestColor>{pixels.data(), pixels.size()};
+    buffers.protocolBuffer = lw::span<uint8_t>{protocolBytes.data(), protocolBytes.size()};
+
+    Bus bus(4, settings, MockTransportSettings{}, buffers);
+    TEST_ASSERT_FALSE(bus.hasValidBuffers());
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(bus.pixelCount()));
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(bus.pixels().size()));
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(bus.protocolBuffer().size()));
+
+    bus.show();
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(bus.transport().beginTransactionCount));
+}
+
+#if !LW_PIXEL_COUNT_16BIT
+void test_bus_addresses_pixel_counts_beyond_16_bits(void)
+{
+    using Protocol = lw::protocols::Ws2812xProtocol<TestColor>;
+    constexpr size_t PixelCount = 200000;
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+
+    lw::busses::PixelBus<Protocol, lw::transports::NilTransport> bus(PixelCount, settings,
+                                                                     lw::transports::NilTransportSettings{});
+    TEST_ASSERT_EQUAL_UINT32(PixelCount, static_cast<uint32_t>(bus.pixelCount()));
+    TEST_ASSERT_EQUAL_UINT32(PixelCount, static_cast<uint32_t>(bus.protocol().pixelCount()));
+    TEST_ASSERT_EQUAL_UINT32(PixelCount, static_cast<uint32_t>(bus.rootPixels().size()));
+    TEST_ASSERT_EQUAL_UINT32(PixelCount, static_cast<uint32_t>(bus.pixels().size()));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Protocol::requiredBufferSize(PixelCount, settings)),
+                             static_cast<uint32_t>(bus.protocolBuffer().size()));
+
+    bus.begin();
+    bus.pixels()[PixelCount - 1] = TestColor{0x12, 0x34, 0x56};
+    bus.show();
+
+    // Pixels past index 65,535 are encoded in place, not wrapped onto the start of the strip.
+    const auto& protocol = bus.protocol();
+    const size_t stride = protocol.truncatedPayloadSize(1) - protocol.truncatedPayloadSize(0);
+    const auto encodedAt = [&](size_t index)
+    {
+        const uint8_t* pixel = bus.protocolBuffer().data() + protocol.truncatedPayloadSize(index);
+        return std::vector<uint8_t>(pixel, pixel + stride);
+    };
+
+    TEST_ASSERT_TRUE(encodedAt(PixelCount - 1) != encodedAt(PixelCount - 2));
+    TEST_ASSERT_TRUE(encodedAt(PixelCount - 1 - 65536) == encodedAt(PixelCount - 2));
+}
+#endif
 } // namespace
 
 void setUp(void)
@@ -255,5 +1388,30 @@ int main(int argc, char** argv)
     RUN_TEST(test_nil_shader_constructor_keeps_scratch_empty_and_uses_root_directly);
     RUN_TEST(test_platform_default_transport_type_constructs_and_updates);
     RUN_TEST(test_platform_default_transport_template_default_constructs);
+    RUN_TEST(test_dirty_ranges_use_partial_update_after_first_full_frame);
+    RUN_TEST(test_dirty_ranges_fall_back_to_full_update_without_capability);
+    RUN_TEST(test_dirty_ranges_partial_frames_match_full_encode_for_fixed_stride_protocols);
+    RUN_TEST(test_dirty_ranges_re_encode_whole_frame_when_transport_mutates_buffer);
+    RUN_TEST(test_frame_timing_records_stages_and_skipped_shows);
+    RUN_TEST(test_frame_timing_records_one_wire_encoding_as_serialize);
+    RUN_TEST(test_frame_timing_keeps_rolling_window_percentiles);
+    RUN_TEST(test_frame_timing_counts_concurrent_shows_exactly);
+    RUN_TEST(test_double_buffered_show_overlaps_encode_with_transmission);
+    RUN_TEST(test_double_buffered_show_holds_frame_until_transport_ready);
+    RUN_TEST(test_double_buffered_show_async_completes_held_frames);
+    RUN_TEST(test_streaming_show_sends_full_frame_without_protocol_buffer);
+    RUN_TEST(test_streaming_leaves_queued_chunks_intact_until_they_complete);
+    RUN_TEST(test_streaming_shades_chunks_without_frame_sized_scratch);
+    RUN_TEST(test_truncated_transmission_sends_prefix_through_last_modified_pixel);
+    RUN_TEST(test_truncated_frame_reaches_async_transport_as_one_transfer);
+    RUN_TEST(test_truncated_transmission_covers_frames_skipped_by_double_buffering);
+    RUN_TEST(test_truncated_transmission_requires_protocol_support);
+    RUN_TEST(test_pointwise_shader_fuses_into_encode_without_scratch);
+    RUN_TEST(test_frame_statistics_shader_fuses_after_its_statistics_pass);
+    RUN_TEST(test_supplied_buffers_from_one_arena_back_many_buses);
+    RUN_TEST(test_undersized_supplied_buffers_leave_bus_empty);
+#if !LW_PIXEL_COUNT_16BIT
+    RUN_TEST(test_bus_addresses_pixel_counts_beyond_16_bits);
+#endif
     return UNITY_END();
 }
@@ -0,0 +1,267 @@
+#include <unity.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "AllocationCounter.h"
+#include "buses/BusBuffers.h"
+#include "buses/PixelBus.h"
+#include "buses/StaticPixelBus.h"
+#include "colors/Color.h"
+#include "colors/GammaShader.h"
+#include "colors/IShader.h"
+#include "protocols/DotStarProtocol.h"
+#include "protocols/ProtocolAliases.h"
+#include "protocols/Ws2812xProtocol.h"
+#include "transports/ITransport.h"
+#include "transports/NilTransport.h"
+
+namespace
+{
+using TestColor = lw::Rgb8Color;
+using Ws2812xSpec = lw::protocols::Ws2812x<TestColor>;
+
+constexpr size_t StaticPixelCount = 60;
+
+struct CountingTransportSettings
+{
+    bool invert{false};
+};
+
+// Sums transmitted bytes without storing them, so it never allocates.
+class CountingTransport : public lw::transports::ITransport
+{
+  public:
+    using TransportSettingsType = CountingTransportSettings;
+    static constexpr bool PreservesBuffer = true;
+
+    explicit CountingTransport(CountingTransportSettings = {}) {}
+
+    void begin() override {}
+
+    void beginTransaction() override {}
+
+    void endTransaction() override { ++transactions; }
+
+    void transmitBytes(lw::span<uint8_t> data) override { bytes += data.size(); }
+
+    size_t bytes{0};
+    size_t transactions{0};
+};
+
+// Frame-wide shader without a fused path, so it runs on the shader scratch.
+class HalveShader : public lw::shaders::IShader<TestColor>
+{
+  public:
+    void apply(lw::span<TestColor> colors) override
+    {
+        for (auto& color : colors)
+        {
+            for (size_t channel = 0; channel < TestColor::ChannelCount; ++channel)
+            {
+                color.channelAtIndex(channel) = static_cast<uint8_t>(color.channelAtIndex(channel) / 2);
+            }
+        }
+    }
+};
+
+lw::busses::StaticPixelBus<StaticPixelCount, Ws2812xSpec, lw::transports::NilTransport> namespaceScopeBus;
+
+template <typename TSpan> void fill_gradient(TSpan pixels)
+{
+    for (size_t index = 0; index < pixels.size(); ++index)
+    {
+        pixels[index] = TestColor{static_cast<uint8_t>(index * 5), static_cast<uint8_t>(200 - index), 0x30};
+    }
+}
+
+template <typename TStaticBus, typename TDynamicBus>
+void assert_protocol_buffers_match(const TStaticBus& staticBus, const TDynamicBus& dynamicBus)
+{
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(dynamicBus.protocolBuffer().size()),
+                             static_cast<uint32_t>(staticBus.protocolBuffer().size()));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(dynamicBus.protocolBuffer().data(), staticBus.protocolBuffer().data(),
+                                  dynamicBus.protocolBuffer().size());
+}
+
+void test_namespace_scope_bus_keeps_all_storage_inline(void)
+{
+    using Bus = decltype(namespaceScopeBus);
+    static_assert(Bus::ProtocolBufferCapacity ==
+                      Bus::ProtocolType::requiredBufferSize(StaticPixelCount, Ws2812xSpec::defaultSettings()),
+                  "capacity is the protocol's compile-time buffer size");
+
+    const auto* begin = reinterpret_cast<const uint8_t*>(&namespaceScopeBus);
+    const auto* end = begin + sizeof(namespaceScopeBus);
+    const auto* pixels = reinterpret_cast<const uint8_t*>(namespaceScopeBus.rootPixels().data());
+    const auto* protocolBytes = namespaceScopeBus.protocolBuffer().data();
+
+    TEST_ASSERT_TRUE(pixels >= begin && pixels < end);
+    TEST_ASSERT_TRUE(protocolBytes >= begin && protocolBytes < end);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(StaticPixelCount),
+                             static_cast<uint32_t>(namespaceScopeBus.rootPixels().size()));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Bus::ProtocolBufferCapacity),
+                             static_cast<uint32_t>(namespaceScopeBus.protocolBuffer().size()));
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(namespaceScopeBus.shaderScratch().size()));
+}
+
+// The bus's storage and its default settings are constant expressions, so a
+// namespace-scope bus needs no dynamic initialization beyond binding its spans.
+void test_storage_and_settings_are_constant_initializable(void)
+{
+    using Bus = decltype(namespaceScopeBus);
+    using Storage = lw::busses::StaticBusStorage<TestColor, StaticPixelCount, 0, Bus::ProtocolBufferCapacity>;
+    static_assert(std::is_same<Bus::StorageType, Storage>::value,
+                  "the static bus runs the shared pipeline on inline storage");
+
+    constexpr Bus::StorageType storage{};
+    static_assert(storage.pixels[StaticPixelCount - 1].channelAtIndex(0) == 0, "pixels start black");
+    static_assert(storage.protocolBuffer[Bus::ProtocolBufferCapacity - 1] == 0, "protocol bytes start cleared");
+
+    constexpr Bus::ProtocolSettingsType protocolSettings = Ws2812xSpec::defaultSettings();
+    constexpr Bus::TransportSettingsType transportSettings{};
+    static_assert(protocolSettings.suffixResetMultiplier == 1, "default settings are constant expressions");
+    static_assert(!transportSettings.invert, "transport settings are constant expressions");
+
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(sizeof(storage)), static_cast<uint32_t>(sizeof(Bus::StorageType)));
+}
+
+void test_construction_and_show_do_not_allocate(void)
+{
+    lw::busses::PixelBus<Ws2812xSpec, CountingTransport> reference(StaticPixelCount, CountingTransportSettings{});
+    reference.begin();
+    fill_gradient(reference.rootPixels());
+    reference.pixels();
+    reference.show();
+
+    using Bus = lw::busses::StaticPixelBus<StaticPixelCount, Ws2812xSpec, CountingTransport>;
+    lw::test::NoAllocationScope scope;
+    Bus bus{CountingTransportSettings{}};
+    bus.begin();
+    fill_gradient(bus.rootPixels());
+    bus.pixels();
+    bus.show();
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(scope.count()));
+    assert_protocol_buffers_match(bus, reference);
+
+    // Dirty-range frames re-encode in place.
+    static_assert(Bus::UsesPartialUpdate, "Ws2812x re-encodes dirty ranges");
+    bus.editPixels(7, 3)[1] = TestColor{1, 2, 3};
+    reference.editPixels(7, 3)[1] = TestColor{1, 2, 3};
+    bus.show();
+    reference.show();
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(scope.count()));
+    assert_protocol_buffers_match(bus, reference);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(2 * bus.protocolBuffer().size()),
+                             static_cast<uint32_t>(bus.transport().bytes));
+}
+
+void test_fused_and_scratch_shaders_match_pixel_bus_without_allocating(void)
+{
+    using Gamma = lw::shaders::GammaShader<TestColor>;
+    using FusedBus = lw::busses::StaticPixelBus<StaticPixelCount, Ws2812xSpec, CountingTransport, Gamma>;
+    using ScratchBus = lw::busses::StaticPixelBus<StaticPixelCount, Ws2812xSpec, CountingTransport, HalveShader>;
+    static_assert(FusedBus::FusesShader && !FusedBus::UsesShaderScratch, "gamma fuses into the encode loop");
+    static_assert(ScratchBus::UsesShaderScratch, "frame shader runs on the static scratch");
+
+    lw::busses::PixelBus<Ws2812xSpec, CountingTransport, Gamma> fusedReference(StaticPixelCount,
+                                                                               CountingTransportSettings{}, Gamma{});
+    lw::busses::PixelBus<Ws2812xSpec, CountingTransport, HalveShader> scratchReference(
+        StaticPixelCount, CountingTransportSettings{}, HalveShader{});
+    fill_gradient(fusedReference.rootPixels());
+    fill_gradient(scratchReference.rootPixels());
+    fusedReference.pixels();
+    scratchReference.pixels();
+    fusedReference.show();
+    scratchReference.show();
+
+    lw::test::NoAllocationScope scope;
+    FusedBus fused{CountingTransportSettings{}, Gamma{}};
+    ScratchBus scratch{CountingTransportSettings{}, HalveShader{}};
+    fill_gradient(fused.rootPixels());
+    fill_gradient(scratch.rootPixels());
+    fused.pixels();
+    scratch.pixels();
+    fused.show();
+    scratch.show();
+
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(scope.count()));
+    assert_protocol_buffers_match(fused, fusedReference);
+    assert_protocol_buffers_match(scratch, scratchReference);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(StaticPixelCount),
+                             static_cast<uint32_t>(scratch.shaderScratch().size()));
+}
+
+void test_truncated_transmission_matches_pixel_bus(void)
+{
+    using Protocol = lw::protocols::Apa102Protocol<TestColor>;
+    lw::busses::PixelBus<Protocol, CountingTransport> reference(StaticPixelCount, Protocol::SettingsType{},
+                                                                CountingTransportSettings{});
+    lw::busses::StaticPixelBus<StaticPixelCount, Protocol, CountingTransport> bus{Protocol::SettingsType{},
+                                                                                  CountingTransportSettings{}};
+    TEST_ASSERT_TRUE(bus.setTruncatedTransmission(true));
+    reference.setTruncatedTransmission(true);
+
+    bus.show();
+    reference.show();
+
+    lw::test::NoAllocationScope scope;
+    bus.transport().bytes = 0;
+    reference.transport().bytes = 0;
+    bus.editPixels(12, 2)[0] = TestColor{0x10, 0x20, 0x30};
+    reference.editPixels(12, 2)[0] = TestColor{0x10, 0x20, 0x30};
+    bus.show();
+    reference.show();
+
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(scope.count()));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(reference.transport().bytes),
+                             static_cast<uint32_t>(bus.transport().bytes));
+    TEST_ASSERT_TRUE(bus.transport().bytes < bus.protocolBuffer().size());
+    assert_protocol_buffers_match(bus, reference);
+}
+
+void test_explicit_capacity_covers_settings_beyond_defaults(void)
+{
+    using Protocol = Ws2812xSpec::ProtocolType;
+    auto settings = Ws2812xSpec::defaultSettings();
+    settings.suffixResetMultiplier = 4;
+
+    constexpr size_t Capacity = Protocol::requiredBufferSize(StaticPixelCount, [] {
+        auto longReset = Ws2812xSpec::defaultSettings();
+        longReset.suffixResetMultiplier = 4;
+        return longReset;
+    }());
+    static_assert(Capacity > lw::busses::detail::StaticProtocolBufferSize<Ws2812xSpec, StaticPixelCount>,
+                  "a longer reset needs more than the default capacity");
+
+    lw::busses::StaticPixelBus<StaticPixelCount, Ws2812xSpec, CountingTransport, lw::NilShader<TestColor>, Capacity>
+        bus{settings, CountingTransportSettings{}};
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Capacity), static_cast<uint32_t>(bus.protocolBuffer().size()));
+
+    bus.pixels();
+    bus.show();
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Capacity), static_cast<uint32_t>(bus.transport().bytes));
+}
+
+} // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_namespace_scope_bus_keeps_all_storage_inline);
+    RUN_TEST(test_storage_and_settings_are_constant_initializable);
+    RUN_TEST(test_construction_and_show_do_not_allocate);
+    RUN_TEST(test_fused_and_scratch_shaders_match_pixel_bus_without_allocating);
+    RUN_TEST(test_truncated_transmission_matches_pixel_bus);
+    RUN_TEST(test_explicit_capacity_covers_settings_beyond_defaults);
+    return UNITY_END();
+}
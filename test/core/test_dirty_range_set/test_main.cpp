@@ -0,0 +1,106 @@
+#include <unity.h>
+
+#include <cstddef>
+
+#include "core/DirtyRangeSet.h"
+
+namespace
+{
+template <size_t N> void assert_range(const lw::DirtyRangeSet<N>& set, size_t index, size_t first, size_t end)
+{
+    TEST_ASSERT_TRUE(index < set.size());
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(first), static_cast<uint32_t>(set[index].first));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(end), static_cast<uint32_t>(set[index].end));
+}
+
+void test_add_keeps_disjoint_ranges_sorted(void)
+{
+    lw::DirtyRangeSet<4> set;
+    set.add(20, 25);
+    set.add(2, 4);
+    set.add(10, 11);
+
+    TEST_ASSERT_EQUAL_UINT32(3U, static_cast<uint32_t>(set.size()));
+    assert_range(set, 0, 2, 4);
+    assert_range(set, 1, 10, 11);
+    assert_range(set, 2, 20, 25);
+    TEST_ASSERT_EQUAL_UINT32(8U, static_cast<uint32_t>(set.pixelCount()));
+}
+
+void test_add_coalesces_overlapping_and_touching_ranges(void)
+{
+    lw::DirtyRangeSet<4> set;
+    set.add(2, 4);
+    set.add(4, 6);
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(set.size()));
+    assert_range(set, 0, 2, 6);
+
+    set.add(10, 12);
+    set.add(14, 16);
+    set.add(5, 15);
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(set.size()));
+    assert_range(set, 0, 2, 16);
+}
+
+void test_add_ignores_empty_ranges(void)
+{
+    lw::DirtyRangeSet<2> set;
+    set.add(5, 5);
+    set.add(7, 3);
+    TEST_ASSERT_TRUE(set.empty());
+}
+
+void test_overflow_merges_smallest_gap(void)
+{
+    lw::DirtyRangeSet<3> set;
+    set.add(0, 1);
+    set.add(10, 11);
+    set.add(100, 101);
+
+    // Gap to [10, 11) is 2, the smallest; the two merge into [10, 14).
+    set.add(13, 14);
+
+    TEST_ASSERT_EQUAL_UINT32(3U, static_cast<uint32_t>(set.size()));
+    assert_range(set, 0, 0, 1);
+    assert_range(set, 1, 10, 14);
+    assert_range(set, 2, 100, 101);
+
+    // The merged pair need not include the new range.
+    set.add(50, 60);
+    TEST_ASSERT_EQUAL_UINT32(3U, static_cast<uint32_t>(set.size()));
+    assert_range(set, 0, 0, 14);
+    assert_range(set, 1, 50, 60);
+    assert_range(set, 2, 100, 101);
+}
+
+void test_clear_resets_set(void)
+{
+    lw::DirtyRangeSet<2> set;
+    set.add(1, 3);
+    set.clear();
+    TEST_ASSERT_TRUE(set.empty());
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(set.pixelCount()));
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_add_keeps_disjoint_ranges_sorted);
+    RUN_TEST(test_add_coalesces_overlapping_and_touching_ranges);
+    RUN_TEST(test_add_ignores_empty_ranges);
+    RUN_TEST(test_overflow_merges_smallest_gap);
+    RUN_TEST(test_clear_resets_set);
+    return UNITY_END();
+}
@@ -1,8 +1,14 @@
 #include <unity.h>
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
 #include <vector>
 
+#include "AllocationCounter.h"
+#include "buses/BusBuffers.h"
 #include "colors/Color.h"
 #include "core/PixelView.h"
 
@@ -10,6 +16,39 @@ namespace
 {
 using Color = lw::Rgb8Color;
 
+// Eight 4-pixel chunks over one array, red channel holding the global index.
+struct EightChunkFixture
+{
+    EightChunkFixture()
+    {
+        for (size_t i = 0; i < pixels.size(); ++i)
+        {
+            pixels[i]['R'] = static_cast<uint8_t>(i);
+        }
+
+        for (size_t chunk = 0; chunk < chunks.size(); ++chunk)
+        {
+            chunks[chunk] = lw::span<Color>{pixels.data() + (chunk * 4), 4};
+        }
+    }
+
+    lw::PixelView<Color> view() { return lw::PixelView<Color>{lw::span<lw::span<Color>>(chunks.data(), chunks.size())}; }
+
+    std::array<Color, 32> pixels{};
+    std::array<lw::span<Color>, 8> chunks{};
+};
+
+void assertSequence(const lw::PixelView<Color>& view, uint8_t first, uint32_t count)
+{
+    TEST_ASSERT_EQUAL_UINT32(count, view.size());
+    uint8_t expected = first;
+    for (const auto& pixel : view)
+    {
+        TEST_ASSERT_EQUAL_UINT8(expected, pixel['R']);
+        ++expected;
+    }
+}
+
 void test_slice_returns_expected_subsection(void)
 {
     std::array<Color, 6> pixels = {Color{1, 2, 3},    Color{4, 5, 6},    Color{7, 8, 9},
@@ -105,6 +144,192 @@ void test_fill_pixels_indexed_uses_global_index(void)
         TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(i + 2U), pixels[i]['B']);
     }
 }
+void test_iterators_step_across_chunks_and_skip_empty_chunks(void)
+{
+    std::array<Color, 6> pixels{};
+    for (size_t i = 0; i < pixels.size(); ++i)
+    {
+        pixels[i]['R'] = static_cast<uint8_t>(i);
+    }
+
+    std::vector<lw::span<Color>> chunks;
+    chunks.emplace_back(pixels.data(), 0);
+    chunks.emplace_back(pixels.data(), 2);
+    chunks.emplace_back(pixels.data() + 2, 0);
+    chunks.emplace_back(pixels.data() + 2, 0);
+    chunks.emplace_back(pixels.data() + 2, 3);
+    chunks.emplace_back(pixels.data() + 5, 1);
+    chunks.emplace_back(pixels.data() + 6, 0);
+
+    lw::PixelView<Color> view{lw::span<lw::span<Color>>(chunks.data(), chunks.size())};
+    TEST_ASSERT_EQUAL_UINT32(6u, view.size());
+
+    uint8_t expected = 0;
+    for (const auto& pixel : view)
+    {
+        TEST_ASSERT_EQUAL_UINT8(expected, pixel['R']);
+        ++expected;
+    }
+    TEST_ASSERT_EQUAL_UINT8(6u, expected);
+
+    auto it = view.end();
+    for (int index = 5; index >= 0; --index)
+    {
+        --it;
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(index), (*it)['R']);
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(index), view[static_cast<uint32_t>(index)]['R']);
+    }
+    TEST_ASSERT_TRUE(it == view.begin());
+}
+
+void test_iterators_jump_to_any_position(void)
+{
+    std::array<Color, 10> pixels{};
+    for (size_t i = 0; i < pixels.size(); ++i)
+    {
+        pixels[i]['R'] = static_cast<uint8_t>(i);
+    }
+
+    std::vector<lw::span<Color>> chunks;
+    chunks.emplace_back(pixels.data(), 3);
+    chunks.emplace_back(pixels.data() + 3, 0);
+    chunks.emplace_back(pixels.data() + 3, 4);
+    chunks.emplace_back(pixels.data() + 7, 3);
+
+    lw::PixelView<Color> view{lw::span<lw::span<Color>>(chunks.data(), chunks.size())};
+    const lw::PixelView<Color>& constView = view;
+
+    for (uint32_t from = 0; from <= view.size(); ++from)
+    {
+        for (uint32_t to = 0; to <= view.size(); ++to)
+        {
+            auto it = view.begin() + from;
+            it += static_cast<std::ptrdiff_t>(to) - static_cast<std::ptrdiff_t>(from);
+            TEST_ASSERT_TRUE(it == view.begin() + to);
+            TEST_ASSERT_EQUAL_INT(static_cast<int>(to), static_cast<int>(it - view.begin()));
+            if (to < view.size())
+            {
+                TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(to), (*it)['R']);
+                TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(to), view.begin()[to]['R']);
+                TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(to), (*(constView.cend() - static_cast<std::ptrdiff_t>(view.size() - to)))['R']);
+            }
+        }
+    }
+
+    lw::PixelView<Color>::const_iterator converted = view.begin() + 4;
+    ++converted;
+    TEST_ASSERT_EQUAL_UINT8(5u, (*converted)['R']);
+    TEST_ASSERT_EQUAL_UINT8(9u, (*std::prev(constView.end()))['R']);
+}
+
+void test_concatenated_view_iterates_every_chunk(void)
+{
+    std::array<Color, 3> first = {Color{1, 0, 0}, Color{2, 0, 0}, Color{3, 0, 0}};
+    std::array<Color, 2> second = {Color{4, 0, 0}, Color{5, 0, 0}};
+
+    std::vector<lw::span<Color>> firstChunks{lw::span<Color>(first.data(), first.size())};
+    std::vector<lw::span<Color>> secondChunks{lw::span<Color>(second.data(), second.size())};
+    lw::PixelView<Color> a{lw::span<lw::span<Color>>(firstChunks.data(), firstChunks.size())};
+    lw::PixelView<Color> b{lw::span<lw::span<Color>>(secondChunks.data(), secondChunks.size())};
+
+    auto joined = a + b;
+    TEST_ASSERT_EQUAL_UINT32(5u, joined.size());
+
+    uint8_t expected = 1;
+    for (auto it = joined.begin(); it != joined.end(); ++it)
+    {
+        TEST_ASSERT_EQUAL_UINT8(expected, (*it)['R']);
+        ++expected;
+    }
+    TEST_ASSERT_EQUAL_UINT8(4u, joined[3]['R']);
+}
+void test_slices_and_concatenations_within_inline_capacity_do_not_allocate(void)
+{
+    EightChunkFixture fixture;
+    auto view = fixture.view();
+
+    lw::test::NoAllocationScope scope;
+    auto sliced = view.slice(5, 16);
+    auto tail = view.slice(30, 32);
+    auto joined = sliced + tail;
+    auto nested = joined.slice(1, 13);
+    const size_t allocations = scope.count();
+
+    TEST_ASSERT_EQUAL_UINT32(0u, static_cast<uint32_t>(allocations));
+    assertSequence(sliced, 5, 11);
+    TEST_ASSERT_EQUAL_UINT32(13u, joined.size());
+    TEST_ASSERT_EQUAL_UINT8(15u, joined[10]['R']);
+    TEST_ASSERT_EQUAL_UINT8(30u, joined[11]['R']);
+    TEST_ASSERT_EQUAL_UINT32(12u, nested.size());
+    TEST_ASSERT_EQUAL_UINT8(6u, nested[0]['R']);
+    TEST_ASSERT_EQUAL_UINT8(31u, nested[11]['R']);
+}
+
+void test_slices_beyond_inline_capacity_spill_to_caller_storage(void)
+{
+    EightChunkFixture fixture;
+    auto view = fixture.view();
+
+    std::array<lw::span<Color>, 8> spillChunks{};
+    std::array<uint32_t, 8> spillStarts{};
+    const lw::PixelViewStorage<Color> storage{lw::span<lw::span<Color>>{spillChunks.data(), spillChunks.size()},
+                                              lw::span<uint32_t>{spillStarts.data(), spillStarts.size()}};
+
+    lw::test::NoAllocationScope scope;
+    auto sliced = view.slice(1, 31, storage);
+    const size_t allocations = scope.count();
+
+    TEST_ASSERT_EQUAL_UINT32(0u, static_cast<uint32_t>(allocations));
+    TEST_ASSERT_EQUAL_PTR(spillChunks.data(), sliced.chunks().data());
+    assertSequence(sliced, 1, 30);
+    TEST_ASSERT_EQUAL_UINT8(17u, sliced[16]['R']);
+
+    auto heapSliced = view.slice(1, 31);
+    assertSequence(heapSliced, 1, 30);
+}
+
+void test_concatenation_spills_to_arena_storage(void)
+{
+    EightChunkFixture fixture;
+    auto view = fixture.view();
+
+    std::array<uint8_t, 512> arenaBytes{};
+    lw::busses::BufferArena arena{lw::span<uint8_t>{arenaBytes.data(), arenaBytes.size()}};
+    const auto storage = arena.takePixelViewStorage<Color>(16);
+    TEST_ASSERT_EQUAL_UINT32(16u, static_cast<uint32_t>(storage.chunks.size()));
+
+    lw::test::NoAllocationScope scope;
+    auto doubled = lw::PixelView<Color>::concatenate(storage, view, view);
+    const size_t allocations = scope.count();
+
+    TEST_ASSERT_EQUAL_UINT32(0u, static_cast<uint32_t>(allocations));
+    TEST_ASSERT_EQUAL_UINT32(64u, doubled.size());
+    TEST_ASSERT_EQUAL_UINT8(31u, doubled[31]['R']);
+    TEST_ASSERT_EQUAL_UINT8(0u, doubled[32]['R']);
+    TEST_ASSERT_EQUAL_UINT8(5u, doubled[37]['R']);
+}
+
+void test_copied_and_moved_views_keep_their_own_chunk_lists(void)
+{
+    EightChunkFixture fixture;
+    auto view = fixture.view();
+
+    lw::PixelView<Color> copy = view.slice(2, 10);
+    {
+        auto source = view.slice(12, 20);
+        copy = source;
+    }
+    assertSequence(copy, 12, 8);
+
+    lw::PixelView<Color> moved = std::move(copy);
+    assertSequence(moved, 12, 8);
+
+    auto heapSource = view.slice(0, 32);
+    lw::PixelView<Color> heapCopy = heapSource;
+    heapSource = view.slice(4, 6);
+    assertSequence(heapCopy, 0, 32);
+    assertSequence(heapSource, 4, 2);
+}
 } // namespace
 
 void setUp(void)
@@ -123,5 +348,12 @@ int main(int, char**)
     RUN_TEST(test_slice_clamps_to_bounds_and_handles_reverse_range);
     RUN_TEST(test_fill_pixels_solid_color_updates_all_chunks);
     RUN_TEST(test_fill_pixels_indexed_uses_global_index);
+    RUN_TEST(test_iterators_step_across_chunks_and_skip_empty_chunks);
+    RUN_TEST(test_iterators_jump_to_any_position);
+    RUN_TEST(test_concatenated_view_iterates_every_chunk);
+    RUN_TEST(test_slices_and_concatenations_within_inline_capacity_do_not_allocate);
+    RUN_TEST(test_slices_beyond_inline_capacity_spill_to_caller_storage);
+    RUN_TEST(test_concatenation_spills_to_arena_storage);
+    RUN_TEST(test_copied_and_moved_views_keep_their_own_chunk_lists);
     return UNITY_END();
 }
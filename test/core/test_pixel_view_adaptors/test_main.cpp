@@ -0,0 +1,269 @@
+#include <unity.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "AllocationCounter.h"
+#include "ChunkedPixels.h"
+#include "colors/Color.h"
+#include "colors/palette/Palette.h"
+#include "core/IndexIterator.h"
+#include "core/PixelView.h"
+#include "core/PixelViewAdaptors.h"
+#include "core/PixelViewAlgorithms.h"
+
+namespace
+{
+using Color = lw::Rgb8Color;
+using Adaptor = lw::StridedPixelView<Color>;
+
+const Color FillColor{200, 201, 202};
+
+using ChunkedPixels = lw::test::ChunkedPixels<Color>;
+
+// 30 pixels over eight uneven chunks, one empty.
+const std::vector<size_t> Layout{5, 3, 0, 7, 1, 6, 4, 4};
+
+using AdaptorFactory = std::function<Adaptor(lw::PixelView<Color>&)>;
+
+struct AdaptorCase
+{
+    AdaptorFactory make;
+    std::vector<uint8_t> indexes;
+};
+
+std::vector<AdaptorCase> adaptorCases()
+{
+    return {
+        {[](lw::PixelView<Color>& view) { return lw::strideView(view, 3, 1); }, {1, 4, 7, 10, 13, 16, 19, 22, 25, 28}},
+        {[](lw::PixelView<Color>& view) { return lw::reverseView(view); },
+         {29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0}},
+        {[](lw::PixelView<Color>& view) { return lw::offsetView(view, 6, 11); }, {6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
+        {[](lw::PixelView<Color>& view) { return lw::interleaveView(view, 2, 1); },
+         {1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29}},
+        {[](lw::PixelView<Color>& view) { return lw::reverseView(lw::strideView(view, 4, 2)); },
+         {26, 22, 18, 14, 10, 6, 2}},
+        {[](lw::PixelView<Color>& view) { return lw::offsetView(lw::reverseView(view), 3, 9).strided(2); },
+         {26, 24, 22, 20, 18}},
+    };
+}
+
+void assertReads(Adaptor& adaptor, const std::vector<uint8_t>& indexes)
+{
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(indexes.size()), adaptor.size());
+
+    size_t position = 0;
+    for (const auto& pixel : adaptor)
+    {
+        TEST_ASSERT_EQUAL_UINT8(indexes[position], pixel['R']);
+        ++position;
+    }
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(indexes.size()), static_cast<uint32_t>(position));
+
+    const Adaptor& constAdaptor = adaptor;
+    for (uint32_t index = 0; index < adaptor.size(); ++index)
+    {
+        TEST_ASSERT_EQUAL_UINT8(indexes[index], adaptor[index]['R']);
+        TEST_ASSERT_EQUAL_UINT8(indexes[index], (*(adaptor.begin() + index))['R']);
+        TEST_ASSERT_EQUAL_UINT8(indexes[index], (*(constAdaptor.end() - (adaptor.size() - index)))['R']);
+    }
+}
+
+// Applies `operation` to the adaptor and `reference` to a copy of the pixels it
+// selects, then checks the whole backing array, untouched pixels included.
+template <typename TOperation, typename TReference>
+void assertMatchesReference(const AdaptorCase& adaptorCase, TOperation&& operation, TReference&& reference)
+{
+    ChunkedPixels actual(Layout);
+    Adaptor adaptor = adaptorCase.make(actual.view);
+    operation(adaptor);
+
+    ChunkedPixels expected(Layout);
+    std::vector<Color> selected;
+    for (const uint8_t index : adaptorCase.indexes)
+    {
+        selected.push_back(expected.pixels[index]);
+    }
+    reference(selected);
+    for (size_t position = 0; position < selected.size(); ++position)
+    {
+        expected.pixels[adaptorCase.indexes[position]] = selected[position];
+    }
+
+    for (size_t i = 0; i < actual.pixels.size(); ++i)
+    {
+        TEST_ASSERT_TRUE(expected.pixels[i] == actual.pixels[i]);
+    }
+}
+
+void test_adaptors_read_the_expected_pixels(void)
+{
+    for (const auto& adaptorCase : adaptorCases())
+    {
+        ChunkedPixels pixels(Layout);
+        Adaptor adaptor = adaptorCase.make(pixels.view);
+        assertReads(adaptor, adaptorCase.indexes);
+    }
+}
+
+void test_adaptors_write_through_to_the_view(void)
+{
+    ChunkedPixels pixels(Layout);
+    auto odd = lw::interleaveView(pixels.view, 2, 1);
+    for (auto& pixel : odd)
+    {
+        pixel['G'] = 9;
+    }
+
+    for (size_t i = 0; i < pixels.pixels.size(); ++i)
+    {
+        TEST_ASSERT_EQUAL_UINT8((i % 2 == 1) ? 9u : 0u, pixels.pixels[i]['G']);
+    }
+}
+
+void test_adaptors_clamp_to_the_view(void)
+{
+    ChunkedPixels pixels(Layout);
+    TEST_ASSERT_EQUAL_UINT32(0u, lw::offsetView(pixels.view, 30).size());
+    TEST_ASSERT_EQUAL_UINT32(0u, lw::strideView(pixels.view, 2, 40).size());
+    TEST_ASSERT_EQUAL_UINT32(1u, lw::strideView(pixels.view, 100).size());
+    TEST_ASSERT_EQUAL_UINT32(0u, lw::reverseView(lw::offsetView(pixels.view, 30)).size());
+    TEST_ASSERT_EQUAL_UINT32(4u, lw::offsetView(lw::reverseView(pixels.view), 26, 10).size());
+}
+
+void test_bulk_algorithms_on_adaptors_match_std_algorithms(void)
+{
+    for (const auto& adaptorCase : adaptorCases())
+    {
+        assertMatchesReference(
+            adaptorCase, [](Adaptor& adaptor) { lw::fillPixels(adaptor, FillColor); },
+            [](std::vector<Color>& selected) { std::fill(selected.begin(), selected.end(), FillColor); });
+
+        assertMatchesReference(
+            adaptorCase, [](Adaptor& adaptor) { lw::reversePixels(adaptor); },
+            [](std::vector<Color>& selected) { std::reverse(selected.begin(), selected.end()); });
+
+        for (uint32_t count = 0; count <= 12; ++count)
+        {
+            assertMatchesReference(
+                adaptorCase, [count](Adaptor& adaptor) { lw::shiftPixelsLeft(adaptor, count, FillColor); },
+                [count](std::vector<Color>& selected)
+                {
+                    const size_t moved = std::min<size_t>(count, selected.size());
+                    std::copy(selected.begin() + moved, selected.end(), selected.begin());
+                    std::fill(selected.end() - moved, selected.end(), FillColor);
+                });
+
+            assertMatchesReference(
+                adaptorCase, [count](Adaptor& adaptor) { lw::shiftPixelsRight(adaptor, count, FillColor); },
+                [count](std::vector<Color>& selected)
+                {
+                    const size_t moved = std::min<size_t>(count, selected.size());
+                    std::copy_backward(selected.begin(), selected.end() - moved, selected.end());
+                    std::fill(selected.begin(), selected.begin() + moved, FillColor);
+                });
+
+            assertMatchesReference(
+                adaptorCase, [count](Adaptor& adaptor) { lw::rotatePixelsLeft(adaptor, count); },
+                [count](std::vector<Color>& selected)
+                { std::rotate(selected.begin(), selected.begin() + (count % selected.size()), selected.end()); });
+
+            assertMatchesReference(
+                adaptorCase, [count](Adaptor& adaptor) { lw::rotatePixelsRight(adaptor, count); },
+                [count](std::vector<Color>& selected)
+                { std::rotate(selected.rbegin(), selected.rbegin() + (count % selected.size()), selected.rend()); });
+        }
+    }
+}
+
+void test_copies_between_views_and_adaptors(void)
+{
+    ChunkedPixels source(Layout);
+    ChunkedPixels target(Layout);
+
+    auto reversedTarget = lw::reverseView(target.view);
+    TEST_ASSERT_EQUAL_UINT32(30u, lw::copyPixels(reversedTarget, source.view));
+    for (size_t i = 0; i < target.pixels.size(); ++i)
+    {
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(29 - i), target.pixels[i]['R']);
+    }
+
+    ChunkedPixels plain(Layout);
+    TEST_ASSERT_EQUAL_UINT32(10u, lw::copyPixels(plain.view, lw::strideView(source.view, 3)));
+    for (size_t i = 0; i < 10; ++i)
+    {
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(i * 3), plain.pixels[i]['R']);
+    }
+
+    const std::array<Color, 3> fill{FillColor, FillColor, FillColor};
+    TEST_ASSERT_EQUAL_UINT32(3u, lw::copyPixelsFrom(lw::strideView(plain.view, 10),
+                                                    lw::span<const Color>{fill.data(), fill.size()}));
+    TEST_ASSERT_TRUE(plain.pixels[20] == FillColor);
+    TEST_ASSERT_EQUAL_UINT8(21u, plain.pixels[21]['R']);
+}
+
+void test_sample_palette_writes_through_adaptors(void)
+{
+    using lw::colors::palettes::PaletteStop;
+
+    const std::array<PaletteStop<Color>, 2> stops{PaletteStop<Color>{0, Color(0, 0, 0)},
+                                                  PaletteStop<Color>{255, Color(255, 255, 255)}};
+    const lw::colors::palettes::Palette<Color> palette(
+        lw::span<const PaletteStop<Color>>(stops.data(), stops.size()));
+
+    std::array<Color, 15> expected{};
+    lw::colors::palettes::samplePalette(palette, lw::IndexRange(0, 17, expected.size()),
+                                        lw::span<Color>(expected.data(), expected.size()));
+
+    ChunkedPixels pixels(Layout);
+    const size_t written = lw::colors::palettes::samplePalette(palette, lw::IndexRange(0, 17, expected.size()),
+                                                               lw::reverseView(lw::interleaveView(pixels.view, 2, 0)));
+
+    TEST_ASSERT_EQUAL_UINT32(15u, static_cast<uint32_t>(written));
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        TEST_ASSERT_TRUE(expected[i] == pixels.pixels[28 - (2 * i)]);
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>((2 * i) + 1), pixels.pixels[(2 * i) + 1]['R']);
+    }
+}
+
+void test_adaptors_and_their_algorithms_do_not_allocate(void)
+{
+    ChunkedPixels pixels(Layout);
+
+    lw::test::NoAllocationScope scope;
+    auto lanes = lw::interleaveView(pixels.view, 3, 2);
+    auto reversed = lw::reverseView(lanes);
+    lw::rotatePixelsLeft(reversed, 2);
+    lw::shiftPixelsRight(lw::offsetView(pixels.view, 4, 20), 3, FillColor);
+    lw::reversePixels(lw::strideView(pixels.view, 2));
+    const size_t allocations = scope.count();
+
+    TEST_ASSERT_EQUAL_UINT32(0u, static_cast<uint32_t>(allocations));
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int, char**)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_adaptors_read_the_expected_pixels);
+    RUN_TEST(test_adaptors_write_through_to_the_view);
+    RUN_TEST(test_adaptors_clamp_to_the_view);
+    RUN_TEST(test_bulk_algorithms_on_adaptors_match_std_algorithms);
+    RUN_TEST(test_copies_between_views_and_adaptors);
+    RUN_TEST(test_sample_palette_writes_through_adaptors);
+    RUN_TEST(test_adaptors_and_their_algorithms_do_not_allocate);
+    return UNITY_END();
+}
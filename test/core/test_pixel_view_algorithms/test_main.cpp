@@ -0,0 +1,199 @@
+#include <unity.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ChunkedPixels.h"
+#include "colors/Color.h"
+#include "core/PixelView.h"
+#include "core/PixelViewAlgorithms.h"
+
+namespace
+{
+using Color = lw::Rgb8Color;
+
+const Color FillColor{200, 201, 202};
+
+using ChunkedPixels = lw::test::ChunkedPixels<Color>;
+
+// Eight strips of an aggregate bus, uneven and with an empty one, plus a single chunk.
+const std::vector<std::vector<size_t>> Layouts{
+    {5, 3, 0, 7, 1, 6, 4, 4},
+    {30},
+};
+
+void assertMatches(const std::vector<Color>& expected, const std::vector<Color>& actual)
+{
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.size()), static_cast<uint32_t>(actual.size()));
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        TEST_ASSERT_TRUE(expected[i] == actual[i]);
+    }
+}
+
+void test_fill_and_copy_cover_every_chunk(void)
+{
+    for (const auto& layout : Layouts)
+    {
+        ChunkedPixels target(layout);
+        ChunkedPixels source({2, 9, 4, 15});
+        auto& targetView = target.view;
+        auto& sourceView = source.view;
+
+        lw::fillPixels(targetView, FillColor);
+        assertMatches(std::vector<Color>(target.pixels.size(), FillColor), target.pixels);
+
+        TEST_ASSERT_EQUAL_UINT32(30u, lw::copyPixels(targetView, sourceView));
+        assertMatches(source.pixels, target.pixels);
+
+        auto shortSource = sourceView.slice(3, 13);
+        ChunkedPixels fresh(layout);
+        auto& freshView = fresh.view;
+        std::vector<Color> expected = fresh.pixels;
+        std::copy(source.pixels.begin() + 3, source.pixels.begin() + 13, expected.begin());
+        TEST_ASSERT_EQUAL_UINT32(10u, lw::copyPixels(freshView, shortSource));
+        assertMatches(expected, fresh.pixels);
+    }
+}
+
+void test_copy_from_span_stops_at_the_shorter_side(void)
+{
+    ChunkedPixels target(Layouts[0]);
+    auto& view = target.view;
+    std::vector<Color> expected = target.pixels;
+
+    const std::array<Color, 12> source{Color{1, 1, 1}, Color{2, 2, 2},    Color{3, 3, 3},    Color{4, 4, 4},
+                                       Color{5, 5, 5}, Color{6, 6, 6},    Color{7, 7, 7},    Color{8, 8, 8},
+                                       Color{9, 9, 9}, Color{10, 10, 10}, Color{11, 11, 11}, Color{12, 12, 12}};
+    std::copy(source.begin(), source.end(), expected.begin());
+
+    TEST_ASSERT_EQUAL_UINT32(12u, lw::copyPixelsFrom(view, lw::span<const Color>{source.data(), source.size()}));
+    assertMatches(expected, target.pixels);
+
+    std::vector<Color> oversized(40, FillColor);
+    TEST_ASSERT_EQUAL_UINT32(30u,
+                             lw::copyPixelsFrom(view, lw::span<const Color>{oversized.data(), oversized.size()}));
+    assertMatches(std::vector<Color>(30, FillColor), target.pixels);
+}
+
+void test_shifts_match_std_shift_with_fill(void)
+{
+    for (const auto& layout : Layouts)
+    {
+        for (uint32_t count = 0; count <= 32; ++count)
+        {
+            ChunkedPixels left(layout);
+            auto& leftView = left.view;
+            std::vector<Color> expected = left.pixels;
+            const size_t moved = std::min<size_t>(count, expected.size());
+            std::copy(expected.begin() + moved, expected.end(), expected.begin());
+            std::fill(expected.end() - moved, expected.end(), FillColor);
+
+            lw::shiftPixelsLeft(leftView, count, FillColor);
+            assertMatches(expected, left.pixels);
+
+            ChunkedPixels right(layout);
+            auto& rightView = right.view;
+            expected = right.pixels;
+            std::copy_backward(expected.begin(), expected.end() - moved, expected.end());
+            std::fill(expected.begin(), expected.begin() + moved, FillColor);
+
+            lw::shiftPixelsRight(rightView, count, FillColor);
+            assertMatches(expected, right.pixels);
+        }
+    }
+}
+
+void test_rotations_match_std_rotate_across_chunk_boundaries(void)
+{
+    for (const auto& layout : Layouts)
+    {
+        for (uint32_t count = 0; count <= 65; ++count)
+        {
+            ChunkedPixels left(layout);
+            auto& leftView = left.view;
+            std::vector<Color> expected = left.pixels;
+            std::rotate(expected.begin(), expected.begin() + (count % expected.size()), expected.end());
+
+            lw::rotatePixelsLeft(leftView, count);
+            assertMatches(expected, left.pixels);
+
+            ChunkedPixels right(layout);
+            auto& rightView = right.view;
+            expected = right.pixels;
+            std::rotate(expected.rbegin(), expected.rbegin() + (count % expected.size()), expected.rend());
+
+            lw::rotatePixelsRight(rightView, count);
+            assertMatches(expected, right.pixels);
+        }
+    }
+}
+
+void test_large_rotations_reverse_in_place(void)
+{
+    ChunkedPixels pixels({40, 0, 25, 35});
+    auto& view = pixels.view;
+    std::vector<Color> expected = pixels.pixels;
+
+    std::rotate(expected.begin(), expected.begin() + 47, expected.end());
+    lw::rotatePixelsLeft(view, 47);
+    assertMatches(expected, pixels.pixels);
+}
+
+void test_reverse_matches_std_reverse_for_every_sub_range(void)
+{
+    ChunkedPixels reference(Layouts[0]);
+    for (uint32_t first = 0; first <= 30; ++first)
+    {
+        for (uint32_t last = first; last <= 30; ++last)
+        {
+            ChunkedPixels pixels(Layouts[0]);
+            auto& view = pixels.view;
+            auto range = view.slice(first, last);
+            std::vector<Color> expected = reference.pixels;
+            std::reverse(expected.begin() + first, expected.begin() + last);
+
+            lw::reversePixels(range);
+            assertMatches(expected, pixels.pixels);
+        }
+    }
+}
+
+void test_empty_views_are_left_alone(void)
+{
+    std::vector<lw::span<Color>> chunks;
+    lw::PixelView<Color> empty{lw::span<lw::span<Color>>(chunks.data(), chunks.size())};
+
+    lw::fillPixels(empty, FillColor);
+    lw::shiftPixelsLeft(empty, 3, FillColor);
+    lw::shiftPixelsRight(empty, 3, FillColor);
+    lw::rotatePixelsLeft(empty, 3);
+    lw::rotatePixelsRight(empty, 3);
+    lw::reversePixels(empty);
+    TEST_ASSERT_EQUAL_UINT32(0u, lw::copyPixels(empty, empty));
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int, char**)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_fill_and_copy_cover_every_chunk);
+    RUN_TEST(test_copy_from_span_stops_at_the_shorter_side);
+    RUN_TEST(test_shifts_match_std_shift_with_fill);
+    RUN_TEST(test_rotations_match_std_rotate_across_chunk_boundaries);
+    RUN_TEST(test_large_rotations_reverse_in_place);
+    RUN_TEST(test_reverse_matches_std_reverse_for_every_sub_range);
+    RUN_TEST(test_empty_views_are_left_alone);
+    return UNITY_END();
+}
@@ -0,0 +1,237 @@
+#include <unity.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "ChunkedPixels.h"
+#include "colors/Color.h"
+#include "core/Executor.h"
+#include "core/PixelView.h"
+#include "core/PixelViewExecution.h"
+#include "core/ThreadPoolExecutor.h"
+
+namespace
+{
+using Color = lw::Rgb8Color;
+
+constexpr uint32_t BatchPixels = LW_PIXEL_BATCH_PIXELS;
+
+using ChunkedPixels = lw::test::ChunkedPixels<Color>;
+
+// Strips of an aggregate bus, with chunks shorter than, straddling and spanning
+// several batches, plus an empty one.
+const std::vector<size_t> Layout{5, BatchPixels - 5, 0, 3 * BatchPixels + 17, 1, 2 * BatchPixels, 40};
+
+Color noise(uint32_t index)
+{
+    uint32_t hash = (index * 2654435761u) ^ (index >> 7);
+    hash ^= hash >> 13;
+    return Color{static_cast<uint8_t>(hash), static_cast<uint8_t>(hash >> 8), static_cast<uint8_t>(hash >> 16)};
+}
+
+std::vector<Color> sequentialFrame()
+{
+    ChunkedPixels pixels(Layout);
+    auto& view = pixels.view;
+    lw::fillPixelsIndexed(view, noise);
+    return pixels.pixels;
+}
+
+struct Batch
+{
+    uint32_t first;
+    size_t count;
+    const Color* data;
+
+    bool operator<(const Batch& other) const { return first < other.first; }
+
+    bool operator==(const Batch& other) const
+    {
+        return first == other.first && count == other.count && data == other.data;
+    }
+};
+
+// Records every batch handed out, from any thread.
+template <typename TPolicy> std::vector<Batch> recordBatches(TPolicy&& policy, ChunkedPixels& pixels)
+{
+    std::mutex mutex;
+    std::vector<Batch> batches;
+    auto& view = pixels.view;
+    lw::fillPixelBatches(std::forward<TPolicy>(policy), view,
+                         [&](uint32_t first, lw::span<Color> out)
+                         {
+                             for (size_t i = 0; i < out.size(); ++i)
+                             {
+                                 out[i] = noise(first + static_cast<uint32_t>(i));
+                             }
+
+                             std::lock_guard<std::mutex> lock(mutex);
+                             batches.push_back(Batch{first, out.size(), out.data()});
+                         });
+    std::sort(batches.begin(), batches.end());
+    return batches;
+}
+
+void test_every_policy_matches_the_sequential_frame(void)
+{
+    const std::vector<Color> expected = sequentialFrame();
+    lw::InlineExecutor inlineExecutor;
+    lw::ThreadPoolExecutor pool(4);
+
+    auto check = [&](auto&& policy)
+    {
+        ChunkedPixels pixels(Layout);
+        auto& view = pixels.view;
+        lw::fillPixelsIndexed(policy, view, noise);
+        TEST_ASSERT_TRUE(expected == pixels.pixels);
+    };
+
+    check(lw::execution::seq);
+    check(lw::execution::unseq);
+    check(lw::execution::par(inlineExecutor));
+    check(lw::execution::ParallelPolicy{});
+    for (const uint32_t minTaskPixels : {0u, 1u, 100u, BatchPixels, 4096u})
+    {
+        check(lw::execution::par(pool, minTaskPixels));
+    }
+}
+
+void test_batches_stay_within_chunks_and_batch_boundaries(void)
+{
+    ChunkedPixels pixels(Layout);
+    const std::vector<Batch> batches = recordBatches(lw::execution::seq, pixels);
+
+    uint32_t next = 0;
+    for (const Batch& batch : batches)
+    {
+        TEST_ASSERT_EQUAL_UINT32(next, batch.first);
+        TEST_ASSERT_TRUE(batch.count > 0);
+        TEST_ASSERT_TRUE(batch.count <= BatchPixels);
+        TEST_ASSERT_TRUE((batch.first % BatchPixels) + batch.count <= BatchPixels);
+        TEST_ASSERT_TRUE(batch.data == pixels.pixels.data() + batch.first);
+
+        const bool insideOneChunk =
+            std::any_of(pixels.chunks.begin(), pixels.chunks.end(),
+                        [&](const lw::span<Color>& chunk)
+                        {
+                            return batch.data >= chunk.data() && batch.data + batch.count <= chunk.data() + chunk.size();
+                        });
+        TEST_ASSERT_TRUE(insideOneChunk);
+        next += static_cast<uint32_t>(batch.count);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(pixels.pixels.size()), next);
+}
+
+void test_batches_do_not_depend_on_policy_or_worker_count(void)
+{
+    ChunkedPixels reference(Layout);
+    const std::vector<Batch> expected = recordBatches(lw::execution::seq, reference);
+
+    auto check = [&](auto&& policy)
+    {
+        ChunkedPixels pixels(Layout);
+        std::vector<Batch> batches = recordBatches(policy, pixels);
+        // Rebase onto the reference buffer before comparing pointers.
+        for (Batch& batch : batches)
+        {
+            batch.data = reference.pixels.data() + (batch.data - pixels.pixels.data());
+        }
+
+        TEST_ASSERT_TRUE(expected == batches);
+        TEST_ASSERT_TRUE(reference.pixels == pixels.pixels);
+    };
+
+    check(lw::execution::unseq);
+    for (const size_t workers : {1u, 2u, 3u, 8u})
+    {
+        lw::ThreadPoolExecutor pool(workers);
+        check(lw::execution::par(pool, 1));
+        check(lw::execution::par(pool, 3 * BatchPixels));
+    }
+}
+
+void test_sequenced_generators_are_called_in_index_order(void)
+{
+    ChunkedPixels pixels(Layout);
+    auto& view = pixels.view;
+    uint32_t expectedIndex = 0;
+    bool inOrder = true;
+
+    lw::fillPixelsIndexed(lw::execution::seq, view,
+                          [&](uint32_t index)
+                          {
+                              inOrder = inOrder && (index == expectedIndex);
+                              ++expectedIndex;
+                              return noise(index);
+                          });
+
+    TEST_ASSERT_TRUE(inOrder);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(pixels.pixels.size()), expectedIndex);
+}
+
+void test_parallel_fill_writes_each_pixel_once(void)
+{
+    ChunkedPixels pixels(Layout);
+    auto& view = pixels.view;
+    std::vector<std::atomic<uint32_t>> calls(pixels.pixels.size());
+    lw::ThreadPoolExecutor pool(4);
+
+    lw::fillPixelsIndexed(lw::execution::par(pool, 1), view,
+                          [&](uint32_t index)
+                          {
+                              calls[index].fetch_add(1);
+                              return noise(index);
+                          });
+
+    for (const auto& count : calls)
+    {
+        TEST_ASSERT_EQUAL_UINT32(1u, count.load());
+    }
+}
+
+void test_empty_views_never_call_the_generator(void)
+{
+    std::vector<lw::span<Color>> chunks{lw::span<Color>{}, lw::span<Color>{}};
+    lw::PixelView<Color> empty{lw::span<lw::span<Color>>(chunks.data(), chunks.size())};
+    lw::ThreadPoolExecutor pool(2);
+    uint32_t calls = 0;
+    auto generator = [&](uint32_t)
+    {
+        ++calls;
+        return Color{};
+    };
+
+    lw::fillPixelsIndexed(lw::execution::seq, empty, generator);
+    lw::fillPixelsIndexed(lw::execution::unseq, empty, generator);
+    lw::fillPixelsIndexed(lw::execution::par(pool, 1), empty, generator);
+    lw::fillPixelBatches(empty, [&](uint32_t, lw::span<Color>) { ++calls; });
+
+    TEST_ASSERT_EQUAL_UINT32(0u, calls);
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int, char**)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_every_policy_matches_the_sequential_frame);
+    RUN_TEST(test_batches_stay_within_chunks_and_batch_boundaries);
+    RUN_TEST(test_batches_do_not_depend_on_policy_or_worker_count);
+    RUN_TEST(test_sequenced_generators_are_called_in_index_order);
+    RUN_TEST(test_parallel_fill_writes_each_pixel_once);
+    RUN_TEST(test_empty_views_never_call_the_generator);
+    return UNITY_END();
+}
@@ -0,0 +1,89 @@
+#include <unity.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "core/Executor.h"
+#include "core/ThreadPoolExecutor.h"
+
+namespace
+{
+void test_inline_executor_runs_indices_in_order(void)
+{
+    lw::InlineExecutor executor;
+    std::vector<size_t> order{};
+
+    lw::parallelFor(&executor, 5, [&](size_t index) { order.push_back(index); });
+
+    const std::vector<size_t> expected{0, 1, 2, 3, 4};
+    TEST_ASSERT_TRUE(order == expected);
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(executor.workerCount()));
+}
+
+void test_thread_pool_runs_every_index_exactly_once(void)
+{
+    lw::ThreadPoolExecutor executor(4);
+    TEST_ASSERT_EQUAL_UINT32(4U, static_cast<uint32_t>(executor.workerCount()));
+
+    for (size_t count : {0U, 1U, 3U, 4U, 37U, 1000U})
+    {
+        std::vector<std::atomic<uint32_t>> hits(count);
+        lw::parallelFor(&executor, count, [&](size_t index) { hits[index].fetch_add(1); });
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            TEST_ASSERT_EQUAL_UINT32(1U, hits[index].load());
+        }
+    }
+}
+
+void test_thread_pool_steals_from_a_stalled_worker(void)
+{
+    constexpr uint32_t TaskCount = 8;
+    lw::ThreadPoolExecutor executor(2);
+    std::atomic<uint32_t> done{0};
+    uint32_t doneWhileStalled = 0;
+
+    // Whichever worker runs index 0 stalls until the other has finished every other
+    // index, including the rest of the stalled worker's own slice.
+    lw::parallelFor(&executor, TaskCount,
+                    [&](size_t index)
+                    {
+                        if (index != 0)
+                        {
+                            done.fetch_add(1);
+                            return;
+                        }
+
+                        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+                        while (done.load() < TaskCount - 1 && std::chrono::steady_clock::now() < deadline)
+                        {
+                            std::this_thread::yield();
+                        }
+
+                        doneWhileStalled = done.load();
+                    });
+
+    TEST_ASSERT_EQUAL_UINT32(TaskCount - 1, doneWhileStalled);
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int, char**)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_inline_executor_runs_indices_in_order);
+    RUN_TEST(test_thread_pool_runs_every_index_exactly_once);
+    RUN_TEST(test_thread_pool_steals_from_a_stalled_worker);
+    return UNITY_END();
+}
@@ -0,0 +1,167 @@
+#include <unity.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "protocols/BitStreamWriter.h"
+
+namespace
+{
+struct Field
+{
+    uint32_t value;
+    uint8_t bits;
+};
+
+// One bit at a time, the way the bit-packed protocols used to serialize.
+std::vector<uint8_t> pack_reference(const std::vector<Field>& fields)
+{
+    size_t totalBits = 0;
+    for (const auto& field : fields)
+    {
+        totalBits += field.bits;
+    }
+
+    std::vector<uint8_t> bytes((totalBits + 7) / 8, 0);
+    size_t bitPos = 0;
+    for (const auto& field : fields)
+    {
+        for (uint8_t bit = field.bits; bit > 0; --bit)
+        {
+            if ((field.value >> (bit - 1)) & 1u)
+            {
+                bytes[bitPos / 8] |= static_cast<uint8_t>(0x80 >> (bitPos % 8));
+            }
+            ++bitPos;
+        }
+    }
+
+    return bytes;
+}
+
+std::vector<Field> make_random_fields(size_t count, uint8_t maxBits)
+{
+    std::vector<Field> fields;
+    uint32_t state = 0x13579BDFu;
+    for (size_t index = 0; index < count; ++index)
+    {
+        state = (state * 1664525u) + 1013904223u;
+        const uint8_t bits = static_cast<uint8_t>((state >> 24) % (maxBits + 1u));
+        state = (state * 1664525u) + 1013904223u;
+        fields.push_back(Field{state, bits});
+    }
+
+    return fields;
+}
+
+template <typename TWord> std::vector<uint8_t> pack_with_writer(const std::vector<Field>& fields, size_t outputSize)
+{
+    std::vector<uint8_t> bytes(outputSize, 0xAA);
+    lw::protocols::BitStreamWriter<TWord> writer{lw::span<uint8_t>{bytes.data(), bytes.size()}};
+    for (const auto& field : fields)
+    {
+        writer.write(field.value, field.bits);
+    }
+
+    const size_t written = writer.finish();
+    TEST_ASSERT_EQUAL_UINT32(outputSize, static_cast<uint32_t>(written));
+    return bytes;
+}
+
+template <typename TWord> void assert_random_fields_match_reference(void)
+{
+    using Writer = lw::protocols::BitStreamWriter<TWord>;
+
+    for (size_t count : {0u, 1u, 3u, 17u, 250u})
+    {
+        const auto fields = make_random_fields(count, Writer::MaxFieldBits);
+        const auto expected = pack_reference(fields);
+        const auto actual = pack_with_writer<TWord>(fields, expected.size());
+        TEST_ASSERT_EQUAL_UINT32(expected.size(), static_cast<uint32_t>(actual.size()));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), actual.data(), expected.size());
+    }
+}
+
+void test_32_bit_word_matches_per_bit_reference(void)
+{
+    assert_random_fields_match_reference<uint32_t>();
+}
+
+void test_64_bit_word_matches_per_bit_reference(void)
+{
+    assert_random_fields_match_reference<uint64_t>();
+}
+
+void test_write_zeros_matches_reference_at_every_alignment(void)
+{
+    for (uint8_t lead = 0; lead < 8; ++lead)
+    {
+        for (size_t zeros : {0u, 1u, 7u, 8u, 9u, 50u, 131u})
+        {
+            std::vector<Field> fields{Field{0x7Fu, lead}};
+            for (size_t remaining = zeros; remaining > 0;)
+            {
+                const uint8_t chunk = static_cast<uint8_t>((remaining < 16) ? remaining : 16);
+                fields.push_back(Field{0, chunk});
+                remaining -= chunk;
+            }
+            fields.push_back(Field{0x1FFFFFFu, 25});
+
+            const auto expected = pack_reference(fields);
+            std::vector<uint8_t> actual(expected.size(), 0xAA);
+            lw::protocols::BitStreamWriter<> writer{lw::span<uint8_t>{actual.data(), actual.size()}};
+            writer.write(0x7Fu, lead);
+            writer.writeZeros(zeros);
+            writer.write(0x1FFFFFFu, 25);
+            TEST_ASSERT_EQUAL_UINT32(expected.size(), static_cast<uint32_t>(writer.finish()));
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), actual.data(), expected.size());
+        }
+    }
+}
+
+void test_finish_pads_final_byte_with_zero_bits(void)
+{
+    std::vector<uint8_t> bytes(2, 0xAA);
+    lw::protocols::BitStreamWriter<> writer{lw::span<uint8_t>{bytes.data(), bytes.size()}};
+    writer.write(0x1FFu, 9);
+
+    TEST_ASSERT_EQUAL_UINT32(2U, static_cast<uint32_t>(writer.finish()));
+    TEST_ASSERT_EQUAL_UINT8(0xFF, bytes[0]);
+    TEST_ASSERT_EQUAL_UINT8(0x80, bytes[1]);
+}
+
+void test_writes_past_output_end_are_dropped(void)
+{
+    std::vector<uint8_t> bytes(4, 0x00);
+    lw::protocols::BitStreamWriter<uint32_t> writer{lw::span<uint8_t>{bytes.data(), 3}};
+    writer.write(0xFFFFFFu, 24);
+    writer.write(0xFFFFFFu, 24);
+    writer.writeZeros(40);
+
+    TEST_ASSERT_EQUAL_UINT32(3U, static_cast<uint32_t>(writer.finish()));
+    TEST_ASSERT_EQUAL_UINT8(0x00, bytes[3]);
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_32_bit_word_matches_per_bit_reference);
+    RUN_TEST(test_64_bit_word_matches_per_bit_reference);
+    RUN_TEST(test_write_zeros_matches_reference_at_every_alignment);
+    RUN_TEST(test_finish_pads_final_byte_with_zero_bits);
+    RUN_TEST(test_writes_past_output_end_are_dropped);
+    return UNITY_END();
+}
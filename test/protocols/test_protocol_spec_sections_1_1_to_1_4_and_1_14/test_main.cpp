@@ -1,5 +1,6 @@
 #include <unity.h>
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <vector>
@@ -40,6 +41,44 @@ std::vector<uint8_t> slice_bytes(const std::vector<uint8_t>& value, size_t offse
     return std::vector<uint8_t>{value.begin() + offset, value.begin() + offset + length};
 }
 
+template <typename TColor> std::vector<TColor> make_pattern_colors(size_t count)
+{
+    std::vector<TColor> colors(count);
+    uint16_t seed = 0x2468;
+    for (auto& color : colors)
+    {
+        for (auto channel : TColor::channelIndexes())
+        {
+            seed = static_cast<uint16_t>((seed * 25173u) + 13849u);
+            color[channel] = static_cast<typename TColor::ComponentType>(seed);
+        }
+    }
+
+    return colors;
+}
+
+template <typename TRuntimeProtocol, typename TFixedProtocol>
+void assert_fixed_channel_order_matches_runtime(const typename TRuntimeProtocol::SettingsType& settings,
+                                                const std::vector<typename TRuntimeProtocol::InterfaceColorType>& colors)
+{
+    using ColorType = typename TRuntimeProtocol::InterfaceColorType;
+    const lw::span<const ColorType> input{colors.data(), colors.size()};
+    const auto pixelCount = static_cast<uint16_t>(colors.size());
+
+    TRuntimeProtocol runtimeProtocol(pixelCount, settings);
+    auto runtimeBuffer = bind_protocol_buffer(runtimeProtocol);
+    runtimeProtocol.update(input, as_span(runtimeBuffer));
+
+    // The fixed order must win over whatever the settings string says.
+    auto fixedSettings = settings;
+    fixedSettings.channelOrder = nullptr;
+    TFixedProtocol fixedProtocol(pixelCount, fixedSettings);
+    auto fixedBuffer = bind_protocol_buffer(fixedProtocol);
+    fixedProtocol.update(input, as_span(fixedBuffer));
+
+    assert_bytes_equal(fixedBuffer, runtimeBuffer);
+}
+
 std::vector<uint8_t> encode_ws2812x_payload(const std::vector<uint8_t>& raw)
 {
     const size_t payloadSize = lw::transports::OneWireEncoding::expandedPayloadSizeBytes(
@@ -165,6 +204,146 @@ void test_1_1_6_and_1_1_7_dotstar_oversized_and_channel_order_edge_contract(void
     }
 }
 
+void test_1_1_8_dotstar_compile_time_channel_order_matches_runtime(void)
+{
+    using namespace lw::protocols;
+
+    lw::protocols::Apa102ProtocolSettings apaSettings{};
+    apaSettings.channelOrder = lw::ChannelOrder::GRB::value;
+    assert_fixed_channel_order_matches_runtime<Apa102Protocol<lw::Rgb8Color>,
+                                               Apa102Protocol<lw::Rgb8Color, lw::Rgb8Color, lw::ChannelOrder::GRB>>(
+        apaSettings, make_pattern_colors<lw::Rgb8Color>(37));
+
+    lw::protocols::Hd108ProtocolSettings hdSettings{};
+    hdSettings.channelOrder = lw::ChannelOrder::BGRW::value;
+    assert_fixed_channel_order_matches_runtime<
+        Hd108Protocol<lw::Rgbw16Color, lw::Rgbw16Color>,
+        Hd108Protocol<lw::Rgbw16Color, lw::Rgbw16Color, lw::ChannelOrder::BGRW>>(
+        hdSettings, make_pattern_colors<lw::Rgbw16Color>(37));
+}
+
+// Smallest 5-bit level whose full PWM range still reaches `brightest`.
+uint32_t minimum_hdr_level(uint32_t brightest)
+{
+    return std::max<uint32_t>(1u, ((brightest * 31u) + 0xFFFEu) / 0xFFFFu);
+}
+
+void test_1_1_9_dotstar_hdr_picks_smallest_brightness_and_rescales_pwm(void)
+{
+    auto colors = make_pattern_colors<lw::Rgb16Color>(64);
+    colors[0] = lw::Rgb16Color{0xFFFF, 0xFFFF, 0xFFFF};
+    colors[1] = lw::Rgb16Color{0x0000, 0x0000, 0x0000};
+    colors[2] = lw::Rgb16Color{0x0100, 0x0080, 0x0001};
+    for (size_t index = 3; index < 24; ++index)
+    {
+        // Dim pixels are the ones HDR exists for.
+        colors[index] = lw::Rgb16Color{static_cast<uint16_t>(colors[index]['R'] >> 6),
+                                       static_cast<uint16_t>(colors[index]['G'] >> 7),
+                                       static_cast<uint16_t>(colors[index]['B'] >> 5)};
+    }
+
+    lw::protocols::Apa102ProtocolSettings settings{{}, lw::ChannelOrder::RGB::value};
+    settings.highDynamicRange = true;
+    lw::protocols::Apa102Protocol<lw::Rgb16Color, lw::Rgb8Color> protocol(static_cast<uint16_t>(colors.size()),
+                                                                          settings);
+    auto protocolBuffer = bind_protocol_buffer(protocol);
+    protocol.update(lw::span<const lw::Rgb16Color>{colors.data(), colors.size()}, as_span(protocolBuffer));
+
+    const std::vector<uint8_t> fullWhite{0xFF, 0xFF, 0xFF, 0xFF};
+    assert_bytes_equal(slice_bytes(protocolBuffer, 4, 4), fullWhite);
+    const std::vector<uint8_t> black{0xE1, 0x00, 0x00, 0x00};
+    assert_bytes_equal(slice_bytes(protocolBuffer, 8, 4), black);
+    const std::vector<uint8_t> dim{0xE1, 31, 15, 0};
+    assert_bytes_equal(slice_bytes(protocolBuffer, 12, 4), dim);
+
+    for (size_t index = 0; index < colors.size(); ++index)
+    {
+        const uint8_t* pixel = protocolBuffer.data() + 4 + (index * 4);
+        const uint32_t level = pixel[0] & 0x1Fu;
+        TEST_ASSERT_EQUAL_UINT8(0xE0, pixel[0] & 0xE0);
+
+        uint32_t brightest = 0;
+        for (auto channel : lw::Rgb16Color::channelIndexes())
+        {
+            brightest = std::max<uint32_t>(brightest, colors[index][channel]);
+        }
+        // Selection works on the high byte, so it may sit one level above the exact minimum.
+        TEST_ASSERT_UINT32_WITHIN(1u, minimum_hdr_level(brightest), level);
+        TEST_ASSERT_TRUE(level >= minimum_hdr_level(brightest));
+
+        for (size_t channel = 0; channel < 3; ++channel)
+        {
+            const uint32_t expected = colors[index].channelAtIndex(channel);
+            const uint32_t reconstructed =
+                ((pixel[1 + channel] * level * 0xFFFFu) + ((31u * 255u) / 2u)) / (31u * 255u);
+            const uint32_t halfStep = ((level * 0xFFFFu) / (31u * 255u * 2u)) + 1u;
+            TEST_ASSERT_UINT32_WITHIN(halfStep, expected, reconstructed);
+        }
+    }
+}
+
+void test_1_1_10_hd108_hdr_picks_smallest_current_gain_and_rescales_pwm(void)
+{
+    auto colors = make_pattern_colors<lw::Rgb16Color>(64);
+    colors[0] = lw::Rgb16Color{0xFFFF, 0xFFFF, 0xFFFF};
+    colors[1] = lw::Rgb16Color{0x0100, 0x0080, 0x0001};
+    for (size_t index = 2; index < 24; ++index)
+    {
+        colors[index] = lw::Rgb16Color{static_cast<uint16_t>(colors[index]['R'] >> 5),
+                                       static_cast<uint16_t>(colors[index]['G'] >> 6),
+                                       static_cast<uint16_t>(colors[index]['B'] >> 4)};
+    }
+
+    lw::protocols::Hd108ProtocolSettings settings{{}, lw::ChannelOrder::RGB::value};
+    settings.highDynamicRange = true;
+    lw::protocols::Hd108Protocol<lw::Rgb16Color, lw::Rgb16Color> protocol(static_cast<uint16_t>(colors.size()),
+                                                                          settings);
+    auto protocolBuffer = bind_protocol_buffer(protocol);
+    protocol.update(lw::span<const lw::Rgb16Color>{colors.data(), colors.size()}, as_span(protocolBuffer));
+
+    const std::vector<uint8_t> fullWhite{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    assert_bytes_equal(slice_bytes(protocolBuffer, 16, 8), fullWhite);
+
+    for (size_t index = 0; index < colors.size(); ++index)
+    {
+        const uint8_t* pixel = protocolBuffer.data() + 16 + (index * 8);
+        const uint32_t header = (static_cast<uint32_t>(pixel[0]) << 8) | pixel[1];
+        const uint32_t level = header & 0x1Fu;
+        TEST_ASSERT_EQUAL_UINT32(0x8000u | (level << 10) | (level << 5) | level, header);
+
+        uint32_t brightest = 0;
+        for (auto channel : lw::Rgb16Color::channelIndexes())
+        {
+            brightest = std::max<uint32_t>(brightest, colors[index][channel]);
+        }
+        TEST_ASSERT_UINT32_WITHIN(1u, minimum_hdr_level(brightest), level);
+        TEST_ASSERT_TRUE(level >= minimum_hdr_level(brightest));
+
+        for (size_t channel = 0; channel < 3; ++channel)
+        {
+            const uint32_t expected = colors[index].channelAtIndex(channel);
+            const uint32_t pwm = (static_cast<uint32_t>(pixel[2 + (channel * 2)]) << 8) | pixel[3 + (channel * 2)];
+            const uint32_t reconstructed = (pwm * level + 15u) / 31u;
+            TEST_ASSERT_UINT32_WITHIN(1u, expected, reconstructed);
+        }
+    }
+}
+
+void test_1_1_11_dotstar_hdr_disabled_by_default(void)
+{
+    const auto colors = make_pattern_colors<lw::Rgb16Color>(9);
+    const lw::span<const lw::Rgb16Color> input{colors.data(), colors.size()};
+
+    lw::protocols::Apa102Protocol<lw::Rgb16Color, lw::Rgb8Color> protocol(9, lw::protocols::Apa102ProtocolSettings{});
+    auto protocolBuffer = bind_protocol_buffer(protocol);
+    protocol.update(input, as_span(protocolBuffer));
+
+    for (size_t index = 0; index < colors.size(); ++index)
+    {
+        TEST_ASSERT_EQUAL_UINT8(0xFF, protocolBuffer[4 + (index * 4)]);
+    }
+}
+
 void test_1_3_1_ws2801_serialization_order_variants(void)
 {
     const std::array<lw::Rgb8Color, 2> colors{lw::Rgb8Color{1, 2, 3}, lw::Rgb8Color{4, 5, 6}};
@@ -355,6 +534,66 @@ void test_1_14_5_ws2812x_oversized_span_contract(void)
         static_cast<uint32_t>(encode_ws2812x_payload(std::vector<uint8_t>{2, 1, 3, 5, 4, 6}).size()),
         static_cast<uint32_t>(protocolBuffer.size()));
 }
+
+void test_1_14_6_ws2812x_single_pass_encoding_matches_two_step_reference(void)
+{
+    const auto fourStepTiming = lw::transports::OneWireTiming::fromTargetKbps<
+        lw::transports::EncodedClockDataBitPattern::FourStep>(800);
+
+    std::vector<lw::Rgbw16Color> colors(257);
+    uint16_t seed = 0x1357;
+    for (auto& color : colors)
+    {
+        for (char channel : {'R', 'G', 'B', 'W'})
+        {
+            seed = static_cast<uint16_t>((seed * 25173u) + 13849u);
+            color[channel] = seed;
+        }
+    }
+
+    lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRBW::value, fourStepTiming, 2, 3};
+    lw::protocols::Ws2812xProtocol<lw::Rgbw16Color> protocol(static_cast<uint16_t>(colors.size()), settings);
+    auto protocolBuffer = bind_protocol_buffer(protocol);
+    std::fill(protocolBuffer.begin(), protocolBuffer.end(), 0xEE);
+    protocol.update(lw::span<const lw::Rgbw16Color>{colors.data(), colors.size()}, as_span(protocolBuffer));
+
+    std::vector<uint8_t> raw;
+    for (const auto& color : colors)
+    {
+        for (char channel : {'G', 'R', 'B', 'W'})
+        {
+            raw.push_back(static_cast<uint8_t>(color[channel] >> 8));
+            raw.push_back(static_cast<uint8_t>(color[channel] & 0xFF));
+        }
+    }
+
+    std::vector<uint8_t> expected(protocolBuffer.size(), 0);
+    const size_t expectedSize = lw::transports::OneWireEncoding::encodeWithResets(
+        raw.data(), raw.size(), expected.data(), expected.size(), fourStepTiming, 0, 2, 3, false);
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(protocolBuffer.size()), static_cast<uint32_t>(expectedSize));
+    assert_bytes_equal(protocolBuffer, expected);
+}
+
+void test_1_14_7_ws2812x_compile_time_channel_order_matches_runtime(void)
+{
+    using namespace lw::protocols;
+
+    lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+    assert_fixed_channel_order_matches_runtime<Ws2812xProtocol<lw::Rgb8Color>,
+                                               Ws2812xProtocol<lw::Rgb8Color, lw::Rgb8Color, lw::ChannelOrder::GRB>>(
+        settings, make_pattern_colors<lw::Rgb8Color>(61));
+
+    // A longer fixed order is truncated to the color channel count, like the runtime path.
+    settings.channelOrder = lw::ChannelOrder::GRBW::value;
+    assert_fixed_channel_order_matches_runtime<Ws2812xProtocol<lw::Rgb16Color>,
+                                               Ws2812xProtocol<lw::Rgb16Color, lw::Rgb16Color, lw::ChannelOrder::GRBW>>(
+        settings, make_pattern_colors<lw::Rgb16Color>(61));
+
+    settings.channelOrder = lw::ChannelOrder::WRGB::value;
+    assert_fixed_channel_order_matches_runtime<Ws2812xProtocol<lw::Rgbw8Color>,
+                                               Ws2812xProtocol<lw::Rgbw8Color, lw::Rgbw8Color, lw::ChannelOrder::WRGB>>(
+        settings, make_pattern_colors<lw::Rgbw8Color>(61));
+}
 } // namespace
 
 void setUp(void)
@@ -382,6 +621,10 @@ int main(int argc, char** argv)
     RUN_TEST(test_1_1_3_and_1_1_4_dotstar_fixed_brightness_and_luminance_serialization);
     RUN_TEST(test_1_1_5_dotstar_framing_and_transaction_sequence);
     RUN_TEST(test_1_1_6_and_1_1_7_dotstar_oversized_and_channel_order_edge_contract);
+    RUN_TEST(test_1_1_8_dotstar_compile_time_channel_order_matches_runtime);
+    RUN_TEST(test_1_1_9_dotstar_hdr_picks_smallest_brightness_and_rescales_pwm);
+    RUN_TEST(test_1_1_10_hd108_hdr_picks_smallest_current_gain_and_rescales_pwm);
+    RUN_TEST(test_1_1_11_dotstar_hdr_disabled_by_default);
     RUN_TEST(test_1_3_1_ws2801_serialization_order_variants);
     RUN_TEST(test_1_3_2_ws2801_transaction_and_latch_timing);
     RUN_TEST(test_1_3_3_ws2801_oversized_and_channel_order_edge_contract);
@@ -391,5 +634,7 @@ int main(int argc, char** argv)
     RUN_TEST(test_1_14_2_channel_order_count_resolution);
     RUN_TEST(test_1_14_4_ws2812x_readiness_wait_loop_contract);
     RUN_TEST(test_1_14_5_ws2812x_oversized_span_contract);
+    RUN_TEST(test_1_14_6_ws2812x_single_pass_encoding_matches_two_step_reference);
+    RUN_TEST(test_1_14_7_ws2812x_compile_time_channel_order_matches_runtime);
     return UNITY_END();
 }
@@ -1,5 +1,6 @@
 #include <unity.h>
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <vector>
@@ -44,6 +45,44 @@ std::vector<uint8_t> slice_bytes(const std::vector<uint8_t>& value, size_t offse
     return std::vector<uint8_t>{value.begin() + offset, value.begin() + offset + length};
 }
 
+template <typename TColor> std::vector<TColor> make_pattern_colors(size_t count)
+{
+    std::vector<TColor> colors(count);
+    uint16_t seed = 0x2468;
+    for (auto& color : colors)
+    {
+        for (auto channel : TColor::channelIndexes())
+        {
+            seed = static_cast<uint16_t>((seed * 25173u) + 13849u);
+            color[channel] = static_cast<typename TColor::ComponentType>(seed);
+        }
+    }
+
+    return colors;
+}
+
+template <typename TRuntimeProtocol, typename TFixedProtocol>
+void assert_fixed_channel_order_matches_runtime(const typename TRuntimeProtocol::SettingsType& settings,
+                                                const std::vector<typename TRuntimeProtocol::InterfaceColorType>& colors)
+{
+    using ColorType = typename TRuntimeProtocol::InterfaceColorType;
+    const lw::span<const ColorType> input{colors.data(), colors.size()};
+    const auto pixelCount = static_cast<uint16_t>(colors.size());
+
+    TRuntimeProtocol runtimeProtocol(pixelCount, settings);
+    auto runtimeBuffer = bind_protocol_buffer(runtimeProtocol);
+    runtimeProtocol.update(input, as_span(runtimeBuffer));
+
+    // The fixed order must win over whatever the settings string says.
+    auto fixedSettings = settings;
+    fixedSettings.channelOrder = nullptr;
+    TFixedProtocol fixedProtocol(pixelCount, fixedSettings);
+    auto fixedBuffer = bind_protocol_buffer(fixedProtocol);
+    fixedProtocol.update(input, as_span(fixedBuffer));
+
+    assert_bytes_equal(fixedBuffer, runtimeBuffer);
+}
+
 std::vector<uint8_t> encode_onewire_payload(const std::vector<uint8_t>& raw,
                                             const lw::transports::OneWireTiming& timing, bool protocolIdleHigh = false,
                                             uint8_t prefixResetMultiplier = 1, uint8_t suffixResetMultiplier = 1)
@@ -262,6 +301,18 @@ void test_1_8_4_sm168x_oversized_and_order_safety(void)
     }
 }
 
+void test_1_8_5_sm168x_compile_time_channel_order_matches_runtime(void)
+{
+    using namespace lw::protocols;
+
+    lw::protocols::Sm168xProtocolSettings settings{};
+    settings.channelOrder = lw::ChannelOrder::GRBW::value;
+    settings.gains = {1, 2, 3, 4, 15};
+    assert_fixed_channel_order_matches_runtime<Sm168xProtocol<lw::Rgbw8Color>,
+                                               Sm168xProtocol<lw::Rgbw8Color, lw::Rgbw8Color, lw::ChannelOrder::GRBW>>(
+        settings, make_pattern_colors<lw::Rgbw8Color>(29));
+}
+
 void test_1_9_1_sm16716_buffer_size_and_start_bit_prefix(void)
 {
     lw::protocols::Sm16716ProtocolT<> protocol(
@@ -294,6 +345,52 @@ void test_1_9_3_sm16716_oversized_and_order_safety(void)
     }
 }
 
+// Bit-at-a-time SM16716 serializer, the layout the word-level writer must reproduce.
+std::vector<uint8_t> sm16716_per_bit_reference(const std::vector<lw::Rgb8Color>& colors, size_t pixelCount)
+{
+    std::vector<uint8_t> bytes((50 + (pixelCount * 25) + 7) / 8, 0);
+    size_t bitPos = 50;
+    auto setBit = [&](size_t position) { bytes[position / 8] |= static_cast<uint8_t>(0x80 >> (position % 8)); };
+
+    for (size_t index = 0; index < std::min(colors.size(), pixelCount); ++index)
+    {
+        setBit(bitPos++);
+        for (const char channel : {'G', 'R', 'B'})
+        {
+            const uint8_t value = colors[index][channel];
+            for (uint8_t bit = 0; bit < 8; ++bit, ++bitPos)
+            {
+                if (value & (0x80 >> bit))
+                {
+                    setBit(bitPos);
+                }
+            }
+        }
+    }
+
+    return bytes;
+}
+
+void test_1_9_4_sm16716_word_writer_matches_per_bit_reference(void)
+{
+    for (size_t pixelCount : {1u, 2u, 7u, 8u, 9u, 33u, 100u})
+    {
+        for (size_t colorCount : {pixelCount, pixelCount / 2})
+        {
+            const auto colors = make_pattern_colors<lw::Rgb8Color>(colorCount);
+            lw::protocols::Sm16716ProtocolT<> protocol(
+                static_cast<uint16_t>(pixelCount),
+                lw::protocols::Sm16716ProtocolSettings{{}, lw::ChannelOrder::GRB::value});
+
+            // Stale bytes must not leak through; the frame is fully rewritten.
+            std::vector<uint8_t> protocolBuffer(protocol.requiredBufferSizeBytes(), 0xA5);
+            protocol.update(lw::span<const lw::Rgb8Color>{colors.data(), colors.size()}, as_span(protocolBuffer));
+
+            assert_bytes_equal(protocolBuffer, sm16716_per_bit_reference(colors, pixelCount));
+        }
+    }
+}
+
 void test_1_11_1_and_1_11_3_tlc59711_header_encoding_and_latch_guard(void)
 {
     lw::protocols::Tlc59711Settings cfg{};
@@ -382,6 +479,19 @@ void test_1_12_4_tm1814_oversized_and_order_safety(void)
     }
 }
 
+void test_1_12_5_tm1814_compile_time_channel_order_matches_runtime(void)
+{
+    using namespace lw::protocols;
+
+    lw::protocols::Tm1814ProtocolSettings settings{};
+    settings.channelOrder = lw::ChannelOrder::GRBW::value;
+    settings.current.redMilliAmps = 100;
+    settings.current.whiteMilliAmps = 300;
+    assert_fixed_channel_order_matches_runtime<Tm1814ProtocolT<lw::Rgbw16Color>,
+                                               Tm1814ProtocolT<lw::Rgbw16Color, lw::ChannelOrder::GRBW>>(
+        settings, make_pattern_colors<lw::Rgbw16Color>(29));
+}
+
 void test_1_13_1_and_1_13_2_tm1914_mode_matrix_inversion_and_payload_order(void)
 {
     auto run_mode = [&](lw::protocols::Tm1914Mode mode, uint8_t expectedMode)
@@ -446,6 +556,17 @@ void test_1_13_3_tm1914_oversized_and_order_safety(void)
             static_cast<uint32_t>(protocolBuffer.size()));
     }
 }
+
+void test_1_13_4_tm1914_compile_time_channel_order_matches_runtime(void)
+{
+    using namespace lw::protocols;
+
+    lw::protocols::Tm1914ProtocolSettings settings{};
+    settings.channelOrder = lw::ChannelOrder::BGR::value;
+    assert_fixed_channel_order_matches_runtime<Tm1914ProtocolT<lw::Rgb8Color>,
+                                               Tm1914ProtocolT<lw::Rgb8Color, lw::ChannelOrder::BGR>>(
+        settings, make_pattern_colors<lw::Rgb8Color>(29));
+}
 } // namespace
 
 void setUp(void)
@@ -479,12 +600,16 @@ int main(int argc, char** argv)
     RUN_TEST(test_1_8_1_sm168x_variant_resolution_and_frame_sizing);
     RUN_TEST(test_1_8_3_sm168x_settings_trailer_encoding_masks);
     RUN_TEST(test_1_8_4_sm168x_oversized_and_order_safety);
+    RUN_TEST(test_1_8_5_sm168x_compile_time_channel_order_matches_runtime);
     RUN_TEST(test_1_9_1_sm16716_buffer_size_and_start_bit_prefix);
     RUN_TEST(test_1_9_3_sm16716_oversized_and_order_safety);
+    RUN_TEST(test_1_9_4_sm16716_word_writer_matches_per_bit_reference);
     RUN_TEST(test_1_11_1_and_1_11_3_tlc59711_header_encoding_and_latch_guard);
     RUN_TEST(test_1_12_1_1_12_2_1_12_3_tm1814_currents_inversion_and_payload_order);
     RUN_TEST(test_1_12_4_tm1814_oversized_and_order_safety);
+    RUN_TEST(test_1_12_5_tm1814_compile_time_channel_order_matches_runtime);
     RUN_TEST(test_1_13_1_and_1_13_2_tm1914_mode_matrix_inversion_and_payload_order);
     RUN_TEST(test_1_13_3_tm1914_oversized_and_order_safety);
+    RUN_TEST(test_1_13_4_tm1914_compile_time_channel_order_matches_runtime);
     return UNITY_END();
 }
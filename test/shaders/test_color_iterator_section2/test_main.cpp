@@ -18,7 +18,7 @@ bool try_advance_iterator(TestIterator& it, std::ptrdiff_t delta)
 {
     if (delta >= 0)
     {
-        const uint32_t maxPosition = std::numeric_limits<uint16_t>::max();
+        const uint32_t maxPosition = std::numeric_limits<lw::PixelCount>::max();
         const uint32_t position = it.position();
         const uint32_t add = static_cast<uint32_t>(delta);
         if (add > (maxPosition - position))
@@ -202,9 +202,10 @@ void test_2_2_4_stl_interop_with_std_copy(void)
     }
 }
 
-void test_2_3_1_p0_span_size_truncation(void)
+void test_2_3_1_p0_span_size_beyond_16_bits(void)
 {
     constexpr size_t OversizeCount = static_cast<size_t>(std::numeric_limits<uint16_t>::max()) + 10U;
+    constexpr auto ExpectedCount = static_cast<lw::PixelCount>(OversizeCount);
     std::vector<TestColor> oversized(OversizeCount);
 
     lw::SpanColorSourceT<TestColor> source(oversized.data(), oversized.size());
@@ -213,10 +214,9 @@ void test_2_3_1_p0_span_size_truncation(void)
     const auto end = source.end();
     const auto observedDistance = end - begin;
 
-    TEST_ASSERT_EQUAL_UINT16(static_cast<uint16_t>(OversizeCount), end.position());
-    TEST_ASSERT_EQUAL_INT32(static_cast<int32_t>(static_cast<uint16_t>(OversizeCount)),
-                            static_cast<int32_t>(observedDistance));
-    TEST_ASSERT_TRUE(static_cast<size_t>(observedDistance) < OversizeCount);
+    // Positions are `PixelCount`: exact by default, truncated under LW_PIXEL_COUNT_16BIT.
+    TEST_ASSERT_EQUAL_UINT32(ExpectedCount, end.position());
+    TEST_ASSERT_EQUAL_INT32(static_cast<int32_t>(ExpectedCount), static_cast<int32_t>(observedDistance));
 }
 
 void test_2_3_2_p0_iterator_arithmetic_overflow_underflow_guarded(void)
@@ -226,19 +226,19 @@ void test_2_3_2_p0_iterator_arithmetic_overflow_underflow_guarded(void)
     TestIterator low([&](uint16_t idx) -> TestColor& { return buffer[idx % buffer.size()]; }, 0);
 
     TestIterator high([&](uint16_t idx) -> TestColor& { return buffer[idx % buffer.size()]; },
-                      std::numeric_limits<uint16_t>::max());
+                      std::numeric_limits<lw::PixelCount>::max());
 
     TEST_ASSERT_FALSE(try_advance_iterator(low, -1));
-    TEST_ASSERT_EQUAL_UINT16(0, low.position());
+    TEST_ASSERT_EQUAL_UINT32(0, low.position());
 
     TEST_ASSERT_FALSE(try_advance_iterator(high, +1));
-    TEST_ASSERT_EQUAL_UINT16(std::numeric_limits<uint16_t>::max(), high.position());
+    TEST_ASSERT_EQUAL_UINT32(std::numeric_limits<lw::PixelCount>::max(), high.position());
 
     TEST_ASSERT_TRUE(try_advance_iterator(low, +1));
-    TEST_ASSERT_EQUAL_UINT16(1, low.position());
+    TEST_ASSERT_EQUAL_UINT32(1, low.position());
 
     TEST_ASSERT_TRUE(try_advance_iterator(high, -1));
-    TEST_ASSERT_EQUAL_UINT16(static_cast<uint16_t>(std::numeric_limits<uint16_t>::max() - 1), high.position());
+    TEST_ASSERT_EQUAL_UINT32(static_cast<lw::PixelCount>(std::numeric_limits<lw::PixelCount>::max() - 1), high.position());
 }
 
 void test_2_3_3_position_only_equality_caveat(void)
@@ -286,7 +286,7 @@ int main(int argc, char** argv)
     RUN_TEST(test_2_2_2_solid_color_source_mutability_contract);
     RUN_TEST(test_2_2_3_span_color_source_constructor_equivalence);
     RUN_TEST(test_2_2_4_stl_interop_with_std_copy);
-    RUN_TEST(test_2_3_1_p0_span_size_truncation);
+    RUN_TEST(test_2_3_1_p0_span_size_beyond_16_bits);
     RUN_TEST(test_2_3_2_p0_iterator_arithmetic_overflow_underflow_guarded);
     RUN_TEST(test_2_3_3_position_only_equality_caveat);
     RUN_TEST(test_2_3_4_default_constructed_iterator_contract);
@@ -372,6 +372,40 @@ void test_3_3_3_scale_clamp_and_rounding_stability(void)
         TEST_ASSERT_TRUE(frame[0] == original[0]);
     }
 }
+void test_3_3_4_statistics_pass_then_apply_one_matches_apply(void)
+{
+    static_assert(lw::shaders::ShaderSupportsFusedApply<Shader>, "limiter shades pixels one at a time");
+    static_assert(lw::shaders::ShaderHasFramePass<Shader>, "limiter needs whole-frame statistics");
+    static_assert(!lw::shaders::ShaderIsPointwise<Shader>, "limiter output depends on the whole frame");
+
+    const std::vector<Color> source{Color{255, 200, 150, 100, 50}, Color{10, 20, 30, 40, 50},
+                                    Color{255, 255, 255, 255, 255}};
+    const std::array<uint32_t, 3> budgets{0, 5000, 150};
+
+    for (const uint32_t budget : budgets)
+    {
+        Settings settings = make_reference_settings();
+        settings.maxMilliamps = budget;
+
+        Shader whole(settings);
+        auto expected = source;
+        whole.apply(lw::span<Color>{expected.data(), expected.size()});
+
+        Shader fused(settings);
+        auto actual = source;
+        fused.prepare(lw::span<const Color>{source.data(), source.size()});
+        for (auto& color : actual)
+        {
+            fused.applyOne(color);
+        }
+
+        for (size_t index = 0; index < source.size(); ++index)
+        {
+            TEST_ASSERT_TRUE(expected[index] == actual[index]);
+        }
+        TEST_ASSERT_EQUAL_UINT32(whole.lastEstimatedMilliamps(), fused.lastEstimatedMilliamps());
+    }
+}
 } // namespace
 
 void setUp(void)
@@ -400,5 +434,6 @@ int main(int argc, char** argv)
     RUN_TEST(test_3_3_1_empty_frame_behavior);
     RUN_TEST(test_3_3_2_extreme_component_values);
     RUN_TEST(test_3_3_3_scale_clamp_and_rounding_stability);
+    RUN_TEST(test_3_3_4_statistics_pass_then_apply_one_matches_apply);
     return UNITY_END();
 }
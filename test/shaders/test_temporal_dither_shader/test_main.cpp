@@ -0,0 +1,226 @@
+#include <unity.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "AllocationCounter.h"
+#include "buses/PixelBus.h"
+#include "colors/Color.h"
+#include "colors/TemporalDitherShader.h"
+#include "protocols/Ws2812xProtocol.h"
+#include "transports/NilTransport.h"
+
+namespace
+{
+using Color = lw::Rgb16Color;
+using Shader = lw::TemporalDitherShader<Color>;
+
+constexpr size_t FramesPerCycle = 256;
+
+std::vector<uint32_t> sum_levels_over_frames(Shader& shader, const std::vector<Color>& source, size_t frames)
+{
+    std::vector<uint32_t> sums(source.size() * Color::ChannelCount, 0);
+    std::vector<Color> frame(source.size());
+
+    for (size_t index = 0; index < frames; ++index)
+    {
+        frame = source;
+        shader.apply(lw::span<Color>{frame.data(), frame.size()});
+
+        for (size_t pixel = 0; pixel < frame.size(); ++pixel)
+        {
+            for (size_t channel = 0; channel < Color::ChannelCount; ++channel)
+            {
+                const uint16_t component = frame[pixel].channelAtIndex(channel);
+                sums[(pixel * Color::ChannelCount) + channel] += static_cast<uint32_t>(component >> 8);
+            }
+        }
+    }
+
+    return sums;
+}
+
+void test_average_over_256_frames_matches_16_bit_input(void)
+{
+    std::vector<Color> source;
+    for (uint32_t value = 0; value < 0xFE00u; value += 0x0101u)
+    {
+        source.push_back(Color{static_cast<uint16_t>(value), static_cast<uint16_t>(value + 0x37u),
+                               static_cast<uint16_t>(value ^ 0x00A5u)});
+    }
+
+    Shader shader{source.size()};
+    const auto sums = sum_levels_over_frames(shader, source, FramesPerCycle);
+
+    for (size_t pixel = 0; pixel < source.size(); ++pixel)
+    {
+        for (size_t channel = 0; channel < Color::ChannelCount; ++channel)
+        {
+            // 256 frames of 8-bit levels sum to exactly the 16-bit value.
+            TEST_ASSERT_EQUAL_UINT32(source[pixel].channelAtIndex(channel),
+                                     sums[(pixel * Color::ChannelCount) + channel]);
+        }
+    }
+}
+
+void test_output_levels_stay_adjacent_to_truncated_value(void)
+{
+    const std::vector<Color> source{Color{0x1280, 0x0001, 0x00FF}};
+    Shader shader{source.size()};
+    std::vector<Color> frame(1);
+
+    for (size_t index = 0; index < FramesPerCycle; ++index)
+    {
+        frame = source;
+        shader.apply(lw::span<Color>{frame.data(), frame.size()});
+
+        for (size_t channel = 0; channel < Color::ChannelCount; ++channel)
+        {
+            const uint16_t truncated = static_cast<uint16_t>(source[0].channelAtIndex(channel) >> 8);
+            const uint16_t level = static_cast<uint16_t>(frame[0].channelAtIndex(channel) >> 8);
+            TEST_ASSERT_EQUAL_UINT16(0, static_cast<uint16_t>(frame[0].channelAtIndex(channel) & 0x00FFu));
+            TEST_ASSERT_TRUE(level == truncated || level == truncated + 1);
+        }
+    }
+}
+
+void test_exact_8_bit_levels_pass_through_without_flicker(void)
+{
+    const std::vector<Color> source{Color{0x0000, 0x4000, 0xFF00}};
+    Shader shader{source.size()};
+    std::vector<Color> frame(1);
+
+    for (size_t index = 0; index < 16; ++index)
+    {
+        frame = source;
+        shader.apply(lw::span<Color>{frame.data(), frame.size()});
+
+        TEST_ASSERT_EQUAL_UINT16(0x0000, frame[0]['R']);
+        TEST_ASSERT_EQUAL_UINT16(0x4000, frame[0]['G']);
+        TEST_ASSERT_EQUAL_UINT16(0xFF00, frame[0]['B']);
+    }
+}
+
+void test_top_level_saturates_instead_of_wrapping(void)
+{
+    const std::vector<Color> source{Color{0xFFFF, 0xFF80, 0xFEFF}};
+    Shader shader{source.size()};
+    std::vector<Color> frame(1);
+
+    for (size_t index = 0; index < FramesPerCycle; ++index)
+    {
+        frame = source;
+        shader.apply(lw::span<Color>{frame.data(), frame.size()});
+
+        TEST_ASSERT_EQUAL_UINT16(0xFF00, frame[0]['R']);
+        TEST_ASSERT_EQUAL_UINT16(0xFF00, frame[0]['G']);
+        TEST_ASSERT_TRUE(frame[0]['B'] == 0xFE00 || frame[0]['B'] == 0xFF00);
+    }
+}
+
+void test_reset_restarts_error_sequence(void)
+{
+    const std::vector<Color> source{Color{0x2040, 0x10C0, 0x0001}, Color{0x7F7F, 0x0080, 0x8001}};
+    Shader shader{source.size()};
+
+    const auto first = sum_levels_over_frames(shader, source, 7);
+    shader.reset();
+    const auto second = sum_levels_over_frames(shader, source, 7);
+
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(first.data(), second.data(), first.size());
+}
+
+void test_caller_storage_matches_owned_accumulator(void)
+{
+    const std::vector<Color> source{Color{0x2040, 0x10C0, 0x0001}, Color{0x7F7F, 0x0080, 0x8001}};
+    std::vector<uint8_t> storage(Shader::errorBytes(source.size()), 0xEE);
+
+    Shader owned{source.size()};
+    Shader supplied{lw::span<uint8_t>{storage.data(), storage.size()}};
+
+    const auto ownedSums = sum_levels_over_frames(owned, source, 37);
+    const auto suppliedSums = sum_levels_over_frames(supplied, source, 37);
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(ownedSums.data(), suppliedSums.data(), ownedSums.size());
+}
+
+void test_apply_never_allocates_and_truncates_pixels_beyond_accumulator(void)
+{
+    Shader shader{1};
+    std::array<Color, 2> frame{};
+
+    for (size_t index = 0; index < 4; ++index)
+    {
+        frame = {Color{0x1280, 0x1280, 0x1280}, Color{0x12FF, 0x0001, 0xFF80}};
+        lw::test::NoAllocationScope noAllocations;
+        shader.apply(lw::span<Color>{frame.data(), frame.size()});
+        TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(noAllocations.count()));
+
+        TEST_ASSERT_EQUAL_UINT16(0x1200, frame[1]['R']);
+        TEST_ASSERT_EQUAL_UINT16(0x0000, frame[1]['G']);
+        TEST_ASSERT_EQUAL_UINT16(0xFF00, frame[1]['B']);
+    }
+}
+
+class FrameRecordingTransport : public lw::transports::ITransport
+{
+  public:
+    using TransportSettingsType = lw::transports::NilTransportSettings;
+
+    explicit FrameRecordingTransport(TransportSettingsType) {}
+
+    void begin() override {}
+
+    void transmitBytes(lw::span<uint8_t> data) override { frames.emplace_back(data.begin(), data.end()); }
+
+    std::vector<std::vector<uint8_t>> frames{};
+};
+
+void test_bus_keeps_sending_frames_while_pixels_stay_the_same(void)
+{
+    using Protocol = lw::protocols::Ws2812xProtocol<Color, lw::Rgb8Color>;
+    using Bus = lw::busses::PixelBus<Protocol, FrameRecordingTransport, Shader>;
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+
+    Bus bus(1, settings, lw::transports::NilTransportSettings{}, Shader{1});
+    bus.begin();
+    bus.pixels()[0] = Color{0x1280, 0x1280, 0x1280};
+
+    for (size_t index = 0; index < 4; ++index)
+    {
+        bus.show();
+    }
+
+    // A half-way low byte alternates the 8-bit level between 0x12 and 0x13.
+    const auto& frames = bus.transport().frames;
+    TEST_ASSERT_EQUAL_UINT32(4U, static_cast<uint32_t>(frames.size()));
+    TEST_ASSERT_TRUE(frames[0] != frames[1]);
+    TEST_ASSERT_TRUE(frames[0] == frames[2]);
+    TEST_ASSERT_TRUE(frames[1] == frames[3]);
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_average_over_256_frames_matches_16_bit_input);
+    RUN_TEST(test_output_levels_stay_adjacent_to_truncated_value);
+    RUN_TEST(test_exact_8_bit_levels_pass_through_without_flicker);
+    RUN_TEST(test_top_level_saturates_instead_of_wrapping);
+    RUN_TEST(test_reset_restarts_error_sequence);
+    RUN_TEST(test_caller_storage_matches_owned_accumulator);
+    RUN_TEST(test_apply_never_allocates_and_truncates_pixels_beyond_accumulator);
+    RUN_TEST(test_bus_keeps_sending_frames_while_pixels_stay_the_same);
+    return UNITY_END();
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global operator new so tests can assert that code stays allocation
+// free. Replacement allocation functions may be defined only once per program, so
+// include this header from exactly one translation unit of a test binary.
+
+namespace lw::test
+{
+namespace detail
+{
+inline size_t allocationCount = 0;
+inline bool countAllocations = false;
+} // namespace detail
+
+// Counts every heap allocation in the process while it is alive.
+struct NoAllocationScope
+{
+    NoAllocationScope()
+    {
+        detail::allocationCount = 0;
+        detail::countAllocations = true;
+    }
+
+    ~NoAllocationScope() { detail::countAllocations = false; }
+
+    NoAllocationScope(const NoAllocationScope&) = delete;
+    NoAllocationScope& operator=(const NoAllocationScope&) = delete;
+
+    size_t count() const { return detail::allocationCount; }
+};
+} // namespace lw::test
+
+void* operator new(std::size_t size)
+{
+    if (lw::test::detail::countAllocations)
+    {
+        ++lw::test::detail::allocationCount;
+    }
+
+    void* memory = std::malloc((size == 0) ? 1 : size);
+    if (memory == nullptr)
+    {
+        std::abort();
+    }
+
+    return memory;
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace lw::test
+{
+// Representative strip sizes: a short strip, a typical installation, a large matrix.
+inline constexpr std::array<size_t, 3> BenchPixelCounts{60, 1000, 10000};
+
+// Keeps every size at roughly the same total work, so small strips still measure
+// well above timer resolution.
+inline size_t benchIterations(size_t pixelCount)
+{
+    constexpr size_t PixelsPerRun = 2000000;
+    const size_t iterations = (pixelCount == 0) ? PixelsPerRun : PixelsPerRun / pixelCount;
+    return (iterations < 20) ? 20 : iterations;
+}
+
+template <typename TFunction> double measureNsPerIteration(size_t iterations, TFunction&& function)
+{
+    function();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+    {
+        function();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    const double totalNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+    return (iterations == 0) ? 0.0 : totalNs / static_cast<double>(iterations);
+}
+
+// Prints a readable line and a JSON object per result. With LW_BENCH_JSON set in the
+// environment, the JSON lines are also appended to that file so runs can be compared.
+// `bytesPerIteration` is what one iteration produces; 0 leaves bytes_per_second at 0.
+inline void reportBenchmark(const char* name, size_t pixelCount, double nsPerIteration, size_t bytesPerIteration = 0)
+{
+    const double nsPerPixel = (pixelCount == 0) ? 0.0 : nsPerIteration / static_cast<double>(pixelCount);
+    const double bytesPerSecond =
+        (nsPerIteration <= 0.0) ? 0.0 : static_cast<double>(bytesPerIteration) * 1.0e9 / nsPerIteration;
+    std::printf("[bench] %-48s %10.1f ns/frame %8.3f ns/pixel\n", name, nsPerIteration, nsPerPixel);
+
+    char json[256];
+    std::snprintf(json, sizeof(json),
+                  "{\"name\":\"%s\",\"pixels\":%zu,\"ns_per_frame\":%.1f,\"ns_per_pixel\":%.3f,\"bytes_per_second\":%.0f}",
+                  name, pixelCount, nsPerIteration, nsPerPixel, bytesPerSecond);
+    std::printf("[bench-json] %s\n", json);
+
+    const char* path = std::getenv("LW_BENCH_JSON");
+    if (path != nullptr && path[0] != '\0')
+    {
+        if (std::FILE* file = std::fopen(path, "a"))
+        {
+            std::fprintf(file, "%s\n", json);
+            std::fclose(file);
+        }
+    }
+}
+
+// Keeps the optimizer from discarding benchmarked work.
+inline void doNotOptimize(const void* value)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(value) : "memory");
+#else
+    static volatile const void* sink = nullptr;
+    sink = value;
+#endif
+}
+
+// Deterministic pseudo-random frame content.
+template <typename TColor> std::vector<TColor> makeBenchColors(size_t count, uint32_t seed = 0xBADC0DEu)
+{
+    std::vector<TColor> colors(count);
+    uint32_t state = seed;
+    for (auto& color : colors)
+    {
+        for (size_t channel = 0; channel < TColor::ChannelCount; ++channel)
+        {
+            state = (state * 1664525u) + 1013904223u;
+            color.channelAtIndex(channel) = static_cast<typename TColor::ComponentType>(state >> 16);
+        }
+    }
+    return colors;
+}
+} // namespace lw::test
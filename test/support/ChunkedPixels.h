@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "colors/Color.h"
+#include "core/PixelView.h"
+
+namespace lw::test
+{
+// Pixels split into chunks of the given sizes, zeros included, the way an aggregate
+// bus strings its strips together. Each pixel starts as {index, index >> 8, 7}, so
+// moved pixels can be traced. `view` points into this object, which is therefore not
+// copyable.
+template <typename TColor = Rgb8Color> struct ChunkedPixels
+{
+    explicit ChunkedPixels(const std::vector<size_t>& chunkSizes)
+        : pixels(indexedPixels(chunkSizes)), chunks(makeChunks(pixels, chunkSizes)),
+          view{span<span<TColor>>(chunks.data(), chunks.size())}
+    {
+    }
+
+    ChunkedPixels(const ChunkedPixels&) = delete;
+    ChunkedPixels& operator=(const ChunkedPixels&) = delete;
+
+    std::vector<TColor> pixels;
+    std::vector<span<TColor>> chunks;
+    PixelView<TColor> view;
+
+  private:
+    static std::vector<TColor> indexedPixels(const std::vector<size_t>& chunkSizes)
+    {
+        size_t total = 0;
+        for (const size_t size : chunkSizes)
+        {
+            total += size;
+        }
+
+        std::vector<TColor> indexed(total);
+        for (size_t i = 0; i < total; ++i)
+        {
+            indexed[i] = TColor{static_cast<uint8_t>(i), static_cast<uint8_t>(i >> 8), 7};
+        }
+
+        return indexed;
+    }
+
+    static std::vector<span<TColor>> makeChunks(std::vector<TColor>& pixels, const std::vector<size_t>& chunkSizes)
+    {
+        std::vector<span<TColor>> chunks;
+        size_t first = 0;
+        for (const size_t size : chunkSizes)
+        {
+            chunks.emplace_back(pixels.data() + first, size);
+            first += size;
+        }
+
+        return chunks;
+    }
+};
+
+} // namespace lw::test
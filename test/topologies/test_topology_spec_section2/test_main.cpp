@@ -166,6 +166,27 @@ void test_2_3_4_topology_rotation_preference_integration(void)
     TEST_ASSERT_EQUAL_UINT16(0, static_cast<uint16_t>(topology.map(0, 0)));
     TEST_ASSERT_EQUAL_UINT16(5, static_cast<uint16_t>(topology.map(2, 0)));
 }
+
+#if !LW_PIXEL_COUNT_16BIT
+void test_2_3_5_topology_indexes_beyond_16_bits(void)
+{
+    lw::TopologySettings settings{400,  300, GM(AxisOrder::RowsFirst, LinePattern::Serpentine, QuarterTurn::None),
+                                  2,    1,   GM(AxisOrder::RowsFirst, LinePattern::Progressive, QuarterTurn::None),
+                                  false};
+    lw::Topology topology(settings);
+
+    TEST_ASSERT_EQUAL_UINT32(800, topology.width());
+    TEST_ASSERT_EQUAL_UINT32(240000, static_cast<uint32_t>(topology.pixelCount()));
+    TEST_ASSERT_EQUAL_UINT32(299 * 400 + 399, static_cast<uint32_t>(topology.map(0, 299)));
+    TEST_ASSERT_EQUAL_UINT32(120000 + 299 * 400, static_cast<uint32_t>(topology.map(799, 299)));
+
+    const lw::Topology strip = lw::Topology::linear(200000);
+    TEST_ASSERT_EQUAL_UINT32(200000, static_cast<uint32_t>(strip.pixelCount()));
+    TEST_ASSERT_EQUAL_UINT32(199999, static_cast<uint32_t>(strip.map(199999, 0)));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(lw::Topology::InvalidIndex),
+                             static_cast<uint32_t>(strip.map(200000, 0)));
+}
+#endif
 } // namespace
 
 void setUp(void)
@@ -188,5 +209,8 @@ int main(int argc, char** argv)
     RUN_TEST(test_2_3_2_topology_global_index_mapping_no_rotation);
     RUN_TEST(test_2_3_3_topology_out_of_bounds_and_zero_dimension_guard);
     RUN_TEST(test_2_3_4_topology_rotation_preference_integration);
+#if !LW_PIXEL_COUNT_16BIT
+    RUN_TEST(test_2_3_5_topology_indexes_beyond_16_bits);
+#endif
     return UNITY_END();
 }
@@ -0,0 +1,134 @@
+#include <unity.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "transports/OneWireEncoding.h"
+#include "transports/OneWireEncodingBackend.h"
+
+namespace
+{
+using lw::transports::OneWireEncoding;
+using lw::transports::detail::BitwiseOneWireEncodingBackend;
+using lw::transports::detail::SwarOneWireEncodingBackend;
+using lw::transports::detail::TableOneWireEncodingBackend;
+
+struct SymbolSet
+{
+    uint8_t one;
+    uint8_t zero;
+    uint8_t bits;
+};
+
+const std::array<SymbolSet, 4> SymbolSets{
+    SymbolSet{OneWireEncoding::EncodedOne3Step, OneWireEncoding::EncodedZero3Step, 3},
+    SymbolSet{OneWireEncoding::EncodedOne4Step, OneWireEncoding::EncodedZero4Step, 4},
+    SymbolSet{static_cast<uint8_t>(~OneWireEncoding::EncodedOne3Step & 0x07),
+              static_cast<uint8_t>(~OneWireEncoding::EncodedZero3Step & 0x07), 3},
+    SymbolSet{static_cast<uint8_t>(~OneWireEncoding::EncodedOne4Step & 0x0F),
+              static_cast<uint8_t>(~OneWireEncoding::EncodedZero4Step & 0x0F), 4},
+};
+
+std::vector<uint8_t> make_source(size_t size)
+{
+    std::vector<uint8_t> source(size);
+    uint32_t state = 0x12345678u;
+    for (auto& value : source)
+    {
+        state = (state * 1664525u) + 1013904223u;
+        value = static_cast<uint8_t>(state >> 24);
+    }
+    return source;
+}
+
+template <typename TBackend> std::vector<uint8_t> encode_with(const std::vector<uint8_t>& source, const SymbolSet& set)
+{
+    std::vector<uint8_t> buffer(source.size() * set.bits, 0);
+    std::copy(source.begin(), source.end(), buffer.begin());
+    TBackend::encodeReverseInPlace(buffer.data(), source.size(), set.one, set.zero, set.bits);
+    return buffer;
+}
+
+void assert_vectors_equal(const std::vector<uint8_t>& expected, const std::vector<uint8_t>& actual)
+{
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.size()), static_cast<uint32_t>(actual.size()));
+    for (size_t index = 0; index < expected.size(); ++index)
+    {
+        TEST_ASSERT_EQUAL_HEX8(expected[index], actual[index]);
+    }
+}
+
+void test_expand_byte_matches_reference_for_every_value(void)
+{
+    for (const auto& set : SymbolSets)
+    {
+        for (uint32_t value = 0; value < 256; ++value)
+        {
+            const uint32_t expected =
+                BitwiseOneWireEncodingBackend::expandByte(static_cast<uint8_t>(value), set.one, set.zero, set.bits);
+            TEST_ASSERT_EQUAL_HEX32(expected, TableOneWireEncodingBackend::expandByte(static_cast<uint8_t>(value),
+                                                                                      set.one, set.zero, set.bits));
+            TEST_ASSERT_EQUAL_HEX32(expected, SwarOneWireEncodingBackend::expandByte(static_cast<uint8_t>(value),
+                                                                                     set.one, set.zero, set.bits));
+        }
+    }
+}
+
+void test_reverse_in_place_matches_reference_for_even_and_odd_lengths(void)
+{
+    const std::array<size_t, 6> sizes{0, 1, 2, 3, 17, 300};
+    for (const auto size : sizes)
+    {
+        const auto source = make_source(size);
+        for (const auto& set : SymbolSets)
+        {
+            const auto expected = encode_with<BitwiseOneWireEncodingBackend>(source, set);
+            assert_vectors_equal(expected, encode_with<TableOneWireEncodingBackend>(source, set));
+            assert_vectors_equal(expected, encode_with<SwarOneWireEncodingBackend>(source, set));
+        }
+    }
+}
+
+void test_encode_with_resets_uses_expected_symbols_and_idle_high_fill(void)
+{
+    std::array<uint8_t, 1> source{0xA0};
+
+    std::vector<uint8_t> threeStep(3, 0);
+    TEST_ASSERT_EQUAL_UINT32(3U, static_cast<uint32_t>(OneWireEncoding::encodeWithResetBytes(
+                                     source.data(), source.size(), threeStep.data(), threeStep.size(),
+                                     lw::transports::timing::Ws2812x, 0, 0, false)));
+    // 1010 0000 -> 110 100 110 100 100 100 100 100
+    assert_vectors_equal(std::vector<uint8_t>{0xD3, 0x49, 0x24}, threeStep);
+
+    const auto fourStepTiming = lw::transports::OneWireTiming::fromTargetKbps<
+        lw::transports::EncodedClockDataBitPattern::FourStep>(800);
+    std::vector<uint8_t> fourStepIdleHigh(1 + 4 + 1, 0);
+    source[0] = 0xA0;
+    TEST_ASSERT_EQUAL_UINT32(6U, static_cast<uint32_t>(OneWireEncoding::encodeWithResetBytes(
+                                     source.data(), source.size(), fourStepIdleHigh.data(), fourStepIdleHigh.size(),
+                                     fourStepTiming, 1, 1, true)));
+    // inverted 1110 1000 1110 1000 1000 1000 1000 1000
+    assert_vectors_equal(std::vector<uint8_t>{0xFF, 0x17, 0x17, 0x77, 0x77, 0xFF}, fourStepIdleHigh);
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_expand_byte_matches_reference_for_every_value);
+    RUN_TEST(test_reverse_in_place_matches_reference_for_even_and_odd_lengths);
+    RUN_TEST(test_encode_with_resets_uses_expected_symbols_and_idle_high_fill);
+    return UNITY_END();
+}
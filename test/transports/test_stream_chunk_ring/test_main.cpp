@@ -0,0 +1,152 @@
+#include <unity.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "colors/Color.h"
+#include "protocols/Ws2812xProtocol.h"
+#include "transports/ITransport.h"
+#include "transports/StreamChunkRing.h"
+
+namespace
+{
+// Simulated consumer: records every chunk the ring hands over, as a DMA engine would drain it.
+class ChunkConsumerTransport : public lw::transports::ITransport
+{
+  public:
+    void begin() override {}
+
+    void beginTransaction() override { ++transactions; }
+
+    void transmitBytes(lw::span<uint8_t> data) override
+    {
+        chunkSizes.push_back(data.size());
+        chunkAddresses.push_back(data.data());
+        received.insert(received.end(), data.begin(), data.end());
+    }
+
+    std::vector<uint8_t> received{};
+    std::vector<size_t> chunkSizes{};
+    std::vector<const uint8_t*> chunkAddresses{};
+    size_t transactions{0};
+};
+
+template <typename TColor> std::vector<TColor> make_colors(size_t count)
+{
+    std::vector<TColor> colors(count);
+    uint16_t seed = 0x7531;
+    for (auto& color : colors)
+    {
+        for (auto channel : TColor::channelIndexes())
+        {
+            seed = static_cast<uint16_t>((seed * 25173u) + 13849u);
+            color[channel] = static_cast<typename TColor::ComponentType>(seed);
+        }
+    }
+
+    return colors;
+}
+
+template <typename TColor>
+void assert_streamed_frame_matches_full_frame(const lw::protocols::Ws2812xProtocolSettings& settings,
+                                              uint16_t pixelCount, size_t colorCount, size_t chunkBytes)
+{
+    const auto colors = make_colors<TColor>(colorCount);
+    const lw::span<const TColor> input{colors.data(), colors.size()};
+
+    lw::protocols::Ws2812xProtocol<TColor> protocol(pixelCount, settings);
+    std::vector<uint8_t> fullFrame(protocol.requiredBufferSizeBytes(), 0);
+    protocol.update(input, lw::span<uint8_t>{fullFrame.data(), fullFrame.size()});
+
+    std::vector<uint8_t> storage(chunkBytes * 2, 0);
+    lw::transports::StreamChunkRing ring{lw::span<uint8_t>{storage.data(), storage.size()}, 2};
+    ChunkConsumerTransport consumer;
+
+    protocol.beginStream(input);
+    const size_t total = ring.transmit(consumer, protocol);
+
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(fullFrame.size()), static_cast<uint32_t>(total));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(fullFrame.size()), static_cast<uint32_t>(consumer.received.size()));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(fullFrame.data(), consumer.received.data(), fullFrame.size());
+    TEST_ASSERT_EQUAL_UINT32(1U, static_cast<uint32_t>(consumer.transactions));
+
+    for (size_t index = 0; index < consumer.chunkSizes.size(); ++index)
+    {
+        TEST_ASSERT_TRUE(consumer.chunkSizes[index] <= chunkBytes);
+        TEST_ASSERT_TRUE(consumer.chunkAddresses[index] == storage.data() + ((index % 2) * chunkBytes));
+    }
+}
+
+void test_streamed_ws2812x_frame_matches_full_frame_for_any_chunk_size(void)
+{
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+    for (size_t chunkBytes : {1U, 5U, 9U, 64U, 1000U, 1024U})
+    {
+        assert_streamed_frame_matches_full_frame<lw::Rgb8Color>(settings, 300, 300, chunkBytes);
+    }
+}
+
+void test_streamed_ws2812x_frame_matches_full_frame_for_wide_pixels_and_resets(void)
+{
+    lw::protocols::Ws2812xProtocolSettings settings{
+        {},
+        lw::ChannelOrder::GRBW::value,
+        lw::transports::OneWireTiming::fromTargetKbps<lw::transports::EncodedClockDataBitPattern::FourStep>(800),
+        2,
+        3};
+
+    for (size_t chunkBytes : {3U, 31U, 1024U})
+    {
+        assert_streamed_frame_matches_full_frame<lw::Rgbw16Color>(settings, 2000, 2000, chunkBytes);
+    }
+}
+
+void test_streamed_ws2812x_frame_pads_missing_pixels_with_black(void)
+{
+    const lw::protocols::Ws2812xProtocolSettings settings{{}, lw::ChannelOrder::GRB::value};
+    assert_streamed_frame_matches_full_frame<lw::Rgb8Color>(settings, 40, 13, 17);
+    assert_streamed_frame_matches_full_frame<lw::Rgb8Color>(settings, 40, 0, 64);
+}
+
+void test_stream_restarts_from_frame_start(void)
+{
+    const auto colors = make_colors<lw::Rgb8Color>(10);
+    const lw::span<const lw::Rgb8Color> input{colors.data(), colors.size()};
+    lw::protocols::Ws2812xProtocol<lw::Rgb8Color> protocol(10, lw::protocols::Ws2812xProtocolSettings{});
+
+    std::vector<uint8_t> chunk(16, 0);
+    protocol.beginStream(input);
+    TEST_ASSERT_EQUAL_UINT32(16U, static_cast<uint32_t>(protocol.encodeNext(lw::span<uint8_t>{chunk.data(), 16})));
+    const std::vector<uint8_t> firstChunk = chunk;
+
+    protocol.beginStream(input);
+    protocol.encodeNext(lw::span<uint8_t>{chunk.data(), chunk.size()});
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(firstChunk.data(), chunk.data(), chunk.size());
+
+    while (protocol.encodeNext(lw::span<uint8_t>{chunk.data(), chunk.size()}) != 0)
+    {
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, static_cast<uint32_t>(protocol.encodeNext(lw::span<uint8_t>{chunk.data(), 16})));
+}
+} // namespace
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_streamed_ws2812x_frame_matches_full_frame_for_any_chunk_size);
+    RUN_TEST(test_streamed_ws2812x_frame_matches_full_frame_for_wide_pixels_and_resets);
+    RUN_TEST(test_streamed_ws2812x_frame_pads_missing_pixels_with_black);
+    RUN_TEST(test_stream_restarts_from_frame_start);
+    return UNITY_END();
+}